@@ -30,7 +30,8 @@ Couleur Couleur::blend(const Couleur& other) const {
     int blendedRouge = (getRouge() + other.getRouge()) / 2;
     int blendedVert = (getVert() + other.getVert()) / 2;
     int blendedBleu = (getBleu() + other.getBleu()) / 2;
-    return Couleur(blendedRouge, blendedVert, blendedBleu);
+    // La moyenne de deux composantes valides reste valide
+    return Couleur(UNCHECKED, blendedRouge, blendedVert, blendedBleu);
 }
 
 // Surcharge des opérateurs
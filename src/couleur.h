@@ -8,6 +8,7 @@
 
 #include <iostream>
 #include <stdexcept>
+#include "geometry/geometry_utils.h"
 
 /**
  * @class Couleur
@@ -39,6 +40,22 @@ class Couleur {
          */
         Couleur(int rouge = 255, int vert = 255, int bleu = 255);
 
+        /**
+         * @brief Constructeur sans validation, pour les composantes déjà connues valides.
+         * @param rouge La composante rouge (0-255, non vérifié).
+         * @param vert La composante verte (0-255, non vérifié).
+         * @param bleu La composante bleue (0-255, non vérifié).
+         */
+        Couleur(Unchecked, int rouge, int vert, int bleu) noexcept : rouge(rouge), vert(vert), bleu(bleu) {}
+
+        /**
+         * @brief Vérifie que trois composantes forment une couleur valide.
+         * @return true si chaque composante est dans [0, 255], false sinon.
+         */
+        static bool isValid(int rouge, int vert, int bleu) noexcept {
+            return rouge >= 0 && rouge <= 255 && vert >= 0 && vert <= 255 && bleu >= 0 && bleu <= 255;
+        }
+
         /**
          * @brief Constructeur par copie de la classe Couleur.
          * @param other La couleur à copier.
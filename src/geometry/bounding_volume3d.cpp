@@ -0,0 +1,100 @@
+#include "bounding_volume3d.h"
+#include "transform3d.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+BoundingBox3D::BoundingBox3D()
+    : minCorner(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+      maxCorner(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()) {}
+
+BoundingBox3D::BoundingBox3D(const Point3D& minCorner, const Point3D& maxCorner)
+    : minCorner(minCorner), maxCorner(maxCorner) {
+    if (minCorner.getX() > maxCorner.getX() || minCorner.getY() > maxCorner.getY() || minCorner.getZ() > maxCorner.getZ()) {
+        throw std::invalid_argument("Le coin minimal doit être inférieur ou égal au coin maximal.");
+    }
+}
+
+void BoundingBox3D::expand(const Point3D& point) {
+    minCorner = Point3D::min(minCorner, point);
+    maxCorner = Point3D::max(maxCorner, point);
+}
+
+void BoundingBox3D::expand(const BoundingBox3D& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    expand(other.minCorner);
+    expand(other.maxCorner);
+}
+
+void BoundingBox3D::expand(const Point3D* points, std::size_t count) {
+    Point3D::minMax(points, count, minCorner, maxCorner);
+}
+
+float BoundingBox3D::surfaceArea() const {
+    if (isEmpty()) {
+        return 0.0f;
+    }
+    Point3D d = maxCorner - minCorner;
+    return 2.0f * (d.getX() * d.getY() + d.getY() * d.getZ() + d.getZ() * d.getX());
+}
+
+bool BoundingBox3D::contains(const Point3D& point) const {
+    return point.getX() >= minCorner.getX() && point.getX() <= maxCorner.getX() &&
+           point.getY() >= minCorner.getY() && point.getY() <= maxCorner.getY() &&
+           point.getZ() >= minCorner.getZ() && point.getZ() <= maxCorner.getZ();
+}
+
+bool BoundingBox3D::intersects(const BoundingBox3D& other) const {
+    return minCorner.getX() <= other.maxCorner.getX() && maxCorner.getX() >= other.minCorner.getX() &&
+           minCorner.getY() <= other.maxCorner.getY() && maxCorner.getY() >= other.minCorner.getY() &&
+           minCorner.getZ() <= other.maxCorner.getZ() && maxCorner.getZ() >= other.minCorner.getZ();
+}
+
+// Méthode centre-demi-dimensions : e'_i = somme_j |m_ij| e_j
+BoundingBox3D BoundingBox3D::transformed(const Transform3D& transform) const {
+    if (isEmpty()) {
+        return *this;
+    }
+    Point3D c = transform.apply(center());
+    Point3D e = halfExtent();
+    float extent[3];
+    for (int row = 0; row < 3; ++row) {
+        extent[row] = std::abs(transform.at(row, 0)) * e.getX() +
+                      std::abs(transform.at(row, 1)) * e.getY() +
+                      std::abs(transform.at(row, 2)) * e.getZ();
+    }
+    Point3D half(extent[0], extent[1], extent[2]);
+    return BoundingBox3D(c - half, c + half);
+}
+
+std::ostream& operator<<(std::ostream& os, const BoundingBox3D& box) {
+    os << "BoundingBox3D[Min: " << box.minCorner << ", Max: " << box.maxCorner << "]";
+    return os;
+}
+
+BoundingSphere3D::BoundingSphere3D(const Point3D& center, float radius) : center(center), radius(radius) {
+    if (radius < 0) {
+        throw std::invalid_argument("Le rayon d'une sphère englobante ne peut pas être négatif.");
+    }
+}
+
+bool BoundingSphere3D::contains(const Point3D& point) const {
+    return center.distance(point) <= radius;
+}
+
+bool BoundingSphere3D::intersects(const BoundingSphere3D& other) const {
+    return center.distance(other.center) <= radius + other.radius;
+}
+
+BoundingBox3D BoundingSphere3D::boundingBox() const {
+    const Point3D half(radius, radius, radius);
+    return BoundingBox3D(center - half, center + half);
+}
+
+std::ostream& operator<<(std::ostream& os, const BoundingSphere3D& sphere) {
+    os << "BoundingSphere3D[Center: " << sphere.center << ", Radius: " << sphere.radius << "]";
+    return os;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file bounding_volume3d.h
+ * @brief Déclaration des volumes englobants BoundingBox3D (boîte alignée sur les axes) et BoundingSphere3D.
+ *
+ * Les volumes englobants résument l'étendue d'un objet pour les tests rapides
+ * (visibilité, intersections, structures d'accélération).
+ */
+#ifndef BOUNDING_VOLUME3D_H
+#define BOUNDING_VOLUME3D_H
+
+#include "point3d.h"
+#include <cstddef>
+#include <iostream>
+
+template <typename Scalar>
+class BasicTransform3D;
+using Transform3D = BasicTransform3D<float>;
+
+/**
+ * @class BoundingBox3D
+ * @brief Boîte englobante alignée sur les axes (AABB), définie par ses coins minimal et maximal.
+ *
+ * Une boîte construite par défaut est vide : l'étendre par un point donne la boîte réduite à ce point.
+ */
+class BoundingBox3D {
+    private:
+        Point3D minCorner; // Coin de coordonnées minimales.
+        Point3D maxCorner; // Coin de coordonnées maximales.
+
+    public:
+        /**
+         * @brief Constructeur par défaut (boîte vide).
+         */
+        BoundingBox3D();
+
+        /**
+         * @brief Constructeur à partir de deux coins.
+         * @param minCorner Le coin de coordonnées minimales.
+         * @param maxCorner Le coin de coordonnées maximales.
+         * @throw std::invalid_argument Si une coordonnée de minCorner dépasse celle de maxCorner.
+         */
+        BoundingBox3D(const Point3D& minCorner, const Point3D& maxCorner);
+
+        const Point3D& getMin() const { return minCorner; }
+        const Point3D& getMax() const { return maxCorner; }
+
+        /**
+         * @brief Indique si la boîte est vide (aucun point ajouté).
+         * @return true si la boîte est vide, false sinon.
+         */
+        bool isEmpty() const { return minCorner.getX() > maxCorner.getX(); }
+
+        /**
+         * @brief Étend la boîte pour contenir un point.
+         * @param point Le point à inclure.
+         */
+        void expand(const Point3D& point);
+
+        /**
+         * @brief Étend la boîte pour contenir une autre boîte.
+         * @param other La boîte à inclure.
+         */
+        void expand(const BoundingBox3D& other);
+
+        /**
+         * @brief Étend la boîte pour contenir une série de points (min/max vectoriels en une passe).
+         * @param points Les points à inclure.
+         * @param count Le nombre de points.
+         */
+        void expand(const Point3D* points, std::size_t count);
+
+        /**
+         * @brief Calcule le centre de la boîte.
+         * @return Le centre de la boîte.
+         */
+        Point3D center() const { return (minCorner + maxCorner) * 0.5f; }
+
+        /**
+         * @brief Calcule les demi-dimensions de la boîte.
+         * @return Le vecteur des demi-dimensions selon x, y et z.
+         */
+        Point3D halfExtent() const { return (maxCorner - minCorner) * 0.5f; }
+
+        /**
+         * @brief Calcule l'aire de la surface de la boîte.
+         * @return L'aire de la surface (0 pour une boîte vide).
+         */
+        float surfaceArea() const;
+
+        /**
+         * @brief Vérifie si un point est dans la boîte (bords compris).
+         * @param point Le point à tester.
+         * @return true si le point est dans la boîte, false sinon.
+         */
+        bool contains(const Point3D& point) const;
+
+        /**
+         * @brief Vérifie si deux boîtes se chevauchent (bords compris).
+         * @param other L'autre boîte.
+         * @return true si les boîtes se chevauchent, false sinon.
+         */
+        bool intersects(const BoundingBox3D& other) const;
+
+        /**
+         * @brief Calcule la boîte englobant l'image de cette boîte par une transformation affine.
+         *
+         * Le centre est transformé, et chaque demi-dimension de l'image est la somme des
+         * demi-dimensions pondérées par les valeurs absolues des coefficients de la matrice (O(1)).
+         *
+         * @param transform La transformation à appliquer.
+         * @return La boîte transformée.
+         */
+        BoundingBox3D transformed(const Transform3D& transform) const;
+
+        /**
+         * @brief Surcharge de l'opérateur d'insertion pour afficher la boîte.
+         * @param os Le flux de sortie.
+         * @param box La boîte à afficher.
+         * @return Le flux de sortie modifié.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const BoundingBox3D& box);
+};
+
+/**
+ * @class BoundingSphere3D
+ * @brief Sphère englobante, définie par son centre et son rayon.
+ */
+class BoundingSphere3D {
+    private:
+        Point3D center; // Centre de la sphère.
+        float radius;   // Rayon de la sphère (positif ou nul).
+
+    public:
+        /**
+         * @brief Constructeur (par défaut : sphère de rayon nul à l'origine).
+         * @param center Le centre de la sphère.
+         * @param radius Le rayon de la sphère.
+         * @throw std::invalid_argument Si le rayon est négatif.
+         */
+        BoundingSphere3D(const Point3D& center = Point3D(), float radius = 0.0f);
+
+        const Point3D& getCenter() const { return center; }
+        float getRadius() const { return radius; }
+
+        /**
+         * @brief Vérifie si un point est dans la sphère (bord compris).
+         * @param point Le point à tester.
+         * @return true si le point est dans la sphère, false sinon.
+         */
+        bool contains(const Point3D& point) const;
+
+        /**
+         * @brief Vérifie si deux sphères se chevauchent (bords compris).
+         * @param other L'autre sphère.
+         * @return true si les sphères se chevauchent, false sinon.
+         */
+        bool intersects(const BoundingSphere3D& other) const;
+
+        /**
+         * @brief Calcule la boîte alignée sur les axes qui englobe la sphère.
+         * @return La boîte de centre celui de la sphère et de demi-côté son rayon.
+         */
+        BoundingBox3D boundingBox() const;
+
+        /**
+         * @brief Surcharge de l'opérateur d'insertion pour afficher la sphère.
+         * @param os Le flux de sortie.
+         * @param sphere La sphère à afficher.
+         * @return Le flux de sortie modifié.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const BoundingSphere3D& sphere);
+};
+
+#endif // BOUNDING_VOLUME3D_H
@@ -0,0 +1,287 @@
+#include "bvh3d.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // Au-delà de cette profondeur, les nœuds sont coupés à la médiane : la profondeur reste bornée
+    constexpr int SAH_MAX_DEPTH = Bvh3D::MAX_DEPTH / 2;
+    // Coûts relatifs de la traversée d'un nœud et du test d'un objet
+    constexpr float TRAVERSAL_COST = 1.0f;
+    constexpr float ITEM_COST = 1.0f;
+
+    float axisValue(const Point3D& p, int axis) {
+        return axis == 0 ? p.getX() : (axis == 1 ? p.getY() : p.getZ());
+    }
+
+    // Carré de la distance d'un point à une boîte (0 à l'intérieur)
+    float squaredDistance(const Point3D& point, const BoundingBox3D& box) {
+        Point3D nearest = Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+        Point3D d = point - nearest;
+        return d.dotProduct(d);
+    }
+
+    struct Bin {
+        BoundingBox3D box;
+        uint32_t count = 0;
+    };
+}
+
+Bvh3D::Bvh3D(float rebuildThreshold) : rebuildThreshold(rebuildThreshold) {
+    if (rebuildThreshold < 1.0f) {
+        throw std::invalid_argument("Le seuil de reconstruction doit être supérieur ou égal à 1.");
+    }
+}
+
+void Bvh3D::build(const std::vector<BoundingBox3D>& bounds) {
+    itemBounds = bounds;
+    nodes.clear();
+    items.resize(bounds.size());
+    for (uint32_t i = 0; i < items.size(); ++i) {
+        items[i] = i;
+    }
+    builtCost = 0.0f;
+    if (items.empty()) {
+        return;
+    }
+    std::vector<Point3D> centroids(bounds.size());
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        centroids[i] = bounds[i].center();
+    }
+    // Au plus 2n - 1 nœuds : aucune réallocation pendant la construction
+    nodes.reserve(2 * items.size());
+    nodes.emplace_back();
+    buildNode(0, 0, static_cast<uint32_t>(items.size()), 0, centroids);
+    builtCost = sahCost();
+}
+
+void Bvh3D::buildNode(uint32_t node, uint32_t begin, uint32_t end, int depth, std::vector<Point3D>& centroids) {
+    BoundingBox3D box, centroidBox;
+    for (uint32_t i = begin; i < end; ++i) {
+        box.expand(itemBounds[items[i]]);
+        centroidBox.expand(centroids[items[i]]);
+    }
+    nodes[node].box = box;
+    nodes[node].firstItem = begin;
+    nodes[node].itemCount = end - begin;
+    nodes[node].leftChild = 0;
+    const uint32_t count = end - begin;
+    if (count <= BVH_MAX_LEAF_SIZE || depth >= MAX_DEPTH - 1) {
+        return;
+    }
+
+    // Axe de plus grande étendue des centroïdes
+    Point3D extent = centroidBox.getMax() - centroidBox.getMin();
+    int axis = 0;
+    if (extent.getY() > axisValue(extent, axis)) axis = 1;
+    if (extent.getZ() > axisValue(extent, axis)) axis = 2;
+    const float axisMin = axisValue(centroidBox.getMin(), axis);
+    const float axisExtent = axisValue(extent, axis);
+
+    uint32_t middle = begin + count / 2;
+    bool split = false;
+    if (depth < SAH_MAX_DEPTH && axisExtent > 0.0f) {
+        // Classes de centroïdes le long de l'axe, puis balayage des BVH_BIN_COUNT - 1 plans de coupe
+        std::array<Bin, BVH_BIN_COUNT> bins;
+        const float scale = BVH_BIN_COUNT / axisExtent;
+        auto binOf = [&](uint32_t item) {
+            int b = static_cast<int>((axisValue(centroids[item], axis) - axisMin) * scale);
+            return std::min(b, BVH_BIN_COUNT - 1);
+        };
+        for (uint32_t i = begin; i < end; ++i) {
+            Bin& bin = bins[binOf(items[i])];
+            bin.box.expand(itemBounds[items[i]]);
+            ++bin.count;
+        }
+        std::array<float, BVH_BIN_COUNT - 1> rightArea;
+        std::array<uint32_t, BVH_BIN_COUNT - 1> rightCount;
+        BoundingBox3D accumulated;
+        uint32_t accumulatedCount = 0;
+        for (int b = BVH_BIN_COUNT - 1; b > 0; --b) {
+            accumulated.expand(bins[b].box);
+            accumulatedCount += bins[b].count;
+            rightArea[b - 1] = accumulated.surfaceArea();
+            rightCount[b - 1] = accumulatedCount;
+        }
+        float bestCost = std::numeric_limits<float>::max();
+        int bestPlane = -1;
+        accumulated = BoundingBox3D();
+        accumulatedCount = 0;
+        for (int plane = 0; plane < BVH_BIN_COUNT - 1; ++plane) {
+            accumulated.expand(bins[plane].box);
+            accumulatedCount += bins[plane].count;
+            if (accumulatedCount == 0 || rightCount[plane] == 0) {
+                continue;
+            }
+            float cost = accumulated.surfaceArea() * accumulatedCount + rightArea[plane] * rightCount[plane];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPlane = plane;
+            }
+        }
+        // Coût de la coupe rapporté à celui d'une feuille contenant tous les objets
+        const float area = box.surfaceArea();
+        const float splitCost = TRAVERSAL_COST + ITEM_COST * (area > 0.0f ? bestCost / area : count);
+        if (bestPlane >= 0 && splitCost < ITEM_COST * count) {
+            middle = static_cast<uint32_t>(std::partition(items.begin() + begin, items.begin() + end,
+                                                          [&](uint32_t item) { return binOf(item) <= bestPlane; }) -
+                                           items.begin());
+            split = true;
+        } else if (count <= BVH_BIN_COUNT) {
+            // Une feuille coûte moins que toute coupe
+            return;
+        }
+    }
+    if (!split) {
+        // Coupe à la médiane : profondeur maximale atteinte, centroïdes confondus ou aucune coupe rentable
+        std::nth_element(items.begin() + begin, items.begin() + middle, items.begin() + end, [&](uint32_t a, uint32_t b) {
+            return axisValue(centroids[a], axis) < axisValue(centroids[b], axis);
+        });
+    }
+
+    const uint32_t left = static_cast<uint32_t>(nodes.size());
+    nodes.emplace_back();
+    nodes.emplace_back();
+    nodes[node].leftChild = left;
+    buildNode(left, begin, middle, depth + 1, centroids);
+    buildNode(left + 1, middle, end, depth + 1, centroids);
+}
+
+bool Bvh3D::refit(const std::vector<BoundingBox3D>& bounds) {
+    if (bounds.size() != itemBounds.size()) {
+        throw std::invalid_argument("Le nombre de boîtes doit être égal au nombre d'objets de la hiérarchie.");
+    }
+    itemBounds = bounds;
+    // Les enfants sont rangés après leur parent : un parcours à rebours traite les enfants d'abord
+    for (size_t n = nodes.size(); n-- > 0;) {
+        BvhNode& node = nodes[n];
+        node.box = BoundingBox3D();
+        if (node.isLeaf()) {
+            for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; ++i) {
+                node.box.expand(itemBounds[items[i]]);
+            }
+        } else {
+            node.box.expand(nodes[node.leftChild].box);
+            node.box.expand(nodes[node.leftChild + 1].box);
+        }
+    }
+    if (sahCost() > rebuildThreshold * builtCost) {
+        build(bounds);
+        ++rebuildCount;
+        return true;
+    }
+    return false;
+}
+
+float Bvh3D::sahCost() const {
+    if (nodes.empty()) {
+        return 0.0f;
+    }
+    float rootArea = nodes[0].box.surfaceArea();
+    float cost = 0.0f;
+    for (const BvhNode& node : nodes) {
+        float probability = rootArea > 0.0f ? node.box.surfaceArea() / rootArea : 1.0f;
+        cost += probability * (node.isLeaf() ? ITEM_COST * node.itemCount : TRAVERSAL_COST);
+    }
+    return cost;
+}
+
+void Bvh3D::queryFrustum(const Frustum3D& frustum, std::vector<uint32_t>& out) const {
+    forEachInFrustum(frustum, [&out](uint32_t item) { out.push_back(item); });
+}
+
+// Parcours en profondeur, enfant le plus proche d'abord ; un nœud plus loin que le meilleur objet est écarté
+bool Bvh3D::raycast(const Ray3D& ray, BvhRayHit& hit, float maxDistance) const {
+    if (nodes.empty()) {
+        return false;
+    }
+    float best = maxDistance;
+    bool found = false;
+    std::array<uint32_t, MAX_DEPTH + 1> stack;
+    int top = 0;
+    float t;
+    if (!ray.intersects(nodes[0].box, t, best)) {
+        return false;
+    }
+    stack[top++] = 0;
+    while (top > 0) {
+        const BvhNode& node = nodes[stack[--top]];
+        if (!ray.intersects(node.box, t, best)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; ++i) {
+                if (ray.intersects(itemBounds[items[i]], t, best) && (!found || t < best)) {
+                    best = t;
+                    hit.item = items[i];
+                    hit.distance = t;
+                    found = true;
+                }
+            }
+            continue;
+        }
+        float tLeft, tRight;
+        bool hitLeft = ray.intersects(nodes[node.leftChild].box, tLeft, best);
+        bool hitRight = ray.intersects(nodes[node.leftChild + 1].box, tRight, best);
+        if (hitLeft && hitRight) {
+            // Le plus proche est empilé en dernier pour être traité en premier
+            bool leftFirst = tLeft <= tRight;
+            stack[top++] = leftFirst ? node.leftChild + 1 : node.leftChild;
+            stack[top++] = leftFirst ? node.leftChild : node.leftChild + 1;
+        } else if (hitLeft) {
+            stack[top++] = node.leftChild;
+        } else if (hitRight) {
+            stack[top++] = node.leftChild + 1;
+        }
+    }
+    return found;
+}
+
+bool Bvh3D::nearest(const Point3D& point, uint32_t& item, float& distance) const {
+    if (nodes.empty()) {
+        return false;
+    }
+    float best = std::numeric_limits<float>::max();
+    std::array<uint32_t, MAX_DEPTH + 1> stack;
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const BvhNode& node = nodes[stack[--top]];
+        if (squaredDistance(point, node.box) >= best) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; ++i) {
+                float d = squaredDistance(point, itemBounds[items[i]]);
+                if (d < best) {
+                    best = d;
+                    item = items[i];
+                }
+            }
+            continue;
+        }
+        float dLeft = squaredDistance(point, nodes[node.leftChild].box);
+        float dRight = squaredDistance(point, nodes[node.leftChild + 1].box);
+        bool leftFirst = dLeft <= dRight;
+        stack[top++] = leftFirst ? node.leftChild + 1 : node.leftChild;
+        stack[top++] = leftFirst ? node.leftChild : node.leftChild + 1;
+    }
+    distance = std::sqrt(best);
+    return true;
+}
+
+int Bvh3D::depth() const {
+    if (nodes.empty()) {
+        return 0;
+    }
+    std::vector<int> nodeDepth(nodes.size(), 1);
+    int result = 1;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        result = std::max(result, nodeDepth[n]);
+        if (!nodes[n].isLeaf()) {
+            nodeDepth[nodes[n].leftChild] = nodeDepth[nodes[n].leftChild + 1] = nodeDepth[n] + 1;
+        }
+    }
+    return result;
+}
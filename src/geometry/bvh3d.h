@@ -0,0 +1,231 @@
+/**
+ * @file bvh3d.h
+ * @brief Déclaration de la classe Bvh3D : hiérarchie de boîtes englobantes sur les objets d'une scène.
+ *
+ * Sans structure d'accélération, chaque requête (visibilité, sélection par rayon, objet le plus
+ * proche) teste tous les objets. La hiérarchie regroupe les objets voisins sous des boîtes
+ * emboîtées : une requête écarte un sous-arbre entier dès que sa boîte ne la concerne pas.
+ */
+#ifndef BVH3D_H
+#define BVH3D_H
+
+#include "bounding_volume3d.h"
+#include "frustum3d.h"
+#include "ray3d.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Nombre de classes utilisées pour évaluer les plans de coupe (heuristique de surface).
+ */
+constexpr int BVH_BIN_COUNT = 16;
+
+/**
+ * @brief Nombre maximal d'objets par feuille.
+ */
+constexpr uint32_t BVH_MAX_LEAF_SIZE = 4;
+
+/**
+ * @brief Rapport de coût au-delà duquel refit reconstruit la hiérarchie.
+ */
+constexpr float DEFAULT_BVH_REBUILD_THRESHOLD = 1.5f;
+
+/**
+ * @struct BvhNode
+ * @brief Nœud de la hiérarchie : boîte englobante et plage d'objets du sous-arbre.
+ *
+ * Les objets d'un sous-arbre sont contigus dans l'ordre de la hiérarchie. Les deux enfants d'un
+ * nœud interne sont rangés côte à côte, après leur parent.
+ */
+struct BvhNode {
+    BoundingBox3D box;       ///< Boîte englobant les objets du sous-arbre.
+    uint32_t firstItem = 0;  ///< Premier objet du sous-arbre dans l'ordre de la hiérarchie.
+    uint32_t itemCount = 0;  ///< Nombre d'objets du sous-arbre.
+    uint32_t leftChild = 0;  ///< Enfant gauche (le droit le suit), 0 pour une feuille.
+
+    bool isLeaf() const { return leftChild == 0; }
+};
+
+/**
+ * @struct BvhRayHit
+ * @brief Résultat d'une requête par rayon : objet touché et distance d'entrée dans sa boîte.
+ */
+struct BvhRayHit {
+    uint32_t item = 0;      ///< Indice de l'objet.
+    float distance = 0.0f;  ///< Distance le long du rayon.
+};
+
+/**
+ * @class Bvh3D
+ * @brief Hiérarchie de boîtes englobantes construite par l'heuristique de surface (SAH) par classes.
+ *
+ * Les objets sont désignés par leur indice dans le tableau de boîtes passé à build. Lorsque les
+ * objets bougent, refit recalcule les boîtes sur place, des feuilles vers la racine, sans changer
+ * la topologie ; si le coût SAH de la hiérarchie dépasse alors rebuildThreshold fois celui de la
+ * dernière construction, la hiérarchie est reconstruite.
+ */
+class Bvh3D {
+    public:
+        /**
+         * @brief Profondeur maximale de la hiérarchie (taille des piles de parcours).
+         */
+        static constexpr int MAX_DEPTH = 64;
+
+    private:
+        std::vector<BvhNode> nodes;             // Nœuds, racine en 0.
+        std::vector<uint32_t> items;            // Indices des objets, dans l'ordre de la hiérarchie.
+        std::vector<BoundingBox3D> itemBounds;  // Boîte de chaque objet, par indice.
+        float rebuildThreshold;                 // Rapport de coût déclenchant une reconstruction.
+        float builtCost = 0.0f;                 // Coût SAH à la dernière construction.
+        size_t rebuildCount = 0;                // Reconstructions déclenchées par refit.
+
+        // Construit récursivement le sous-arbre du nœud donné sur les objets items[begin, end)
+        void buildNode(uint32_t node, uint32_t begin, uint32_t end, int depth, std::vector<Point3D>& centroids);
+
+    public:
+        /**
+         * @brief Constructeur d'une hiérarchie vide.
+         * @param rebuildThreshold Le rapport de coût SAH au-delà duquel refit reconstruit la hiérarchie.
+         * @throw std::invalid_argument Si le rapport est inférieur à 1.
+         */
+        explicit Bvh3D(float rebuildThreshold = DEFAULT_BVH_REBUILD_THRESHOLD);
+
+        /**
+         * @brief Construit la hiérarchie sur un ensemble d'objets.
+         * @param bounds La boîte englobante de chaque objet ; l'objet i est désigné par l'indice i.
+         */
+        void build(const std::vector<BoundingBox3D>& bounds);
+
+        /**
+         * @brief Met à jour les boîtes après le déplacement des objets, sans changer la topologie.
+         *
+         * La hiérarchie est reconstruite si son coût SAH dépasse rebuildThreshold fois celui de
+         * la dernière construction.
+         *
+         * @param bounds La nouvelle boîte de chaque objet (mêmes objets, même ordre que pour build).
+         * @return true si la hiérarchie a été reconstruite, false si elle a seulement été ajustée.
+         * @throw std::invalid_argument Si le nombre de boîtes diffère du nombre d'objets.
+         */
+        bool refit(const std::vector<BoundingBox3D>& bounds);
+
+        /**
+         * @brief Calcule le coût SAH de la hiérarchie : coût moyen d'une requête traversant la racine.
+         *
+         * Somme, sur les nœuds, de la probabilité d'atteindre le nœud (rapport de sa surface à celle
+         * de la racine) multipliée par son coût : 1 par nœud interne, 1 par objet pour une feuille.
+         *
+         * @return Le coût, 0 pour une hiérarchie vide.
+         */
+        float sahCost() const;
+
+        /**
+         * @brief Ajoute à out l'indice de chaque objet dont la boîte touche le volume de vision.
+         *
+         * Les sous-arbres entièrement visibles sont ajoutés sans autre test.
+         *
+         * @param frustum Le volume de vision.
+         * @param out La liste à compléter (non vidée).
+         */
+        void queryFrustum(const Frustum3D& frustum, std::vector<uint32_t>& out) const;
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte touche le volume de vision, sans allocation.
+         * @param frustum Le volume de vision.
+         * @param visit Le visiteur, appelé avec l'indice de chaque objet (uint32_t).
+         */
+        template <typename Visitor>
+        void forEachInFrustum(const Frustum3D& frustum, Visitor&& visit) const {
+            if (nodes.empty()) {
+                return;
+            }
+            std::array<uint32_t, MAX_DEPTH + 1> stack;
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const BvhNode& node = nodes[stack[--top]];
+                FrustumTest test = frustum.classify(node.box);
+                if (test == FrustumTest::Outside) {
+                    continue;
+                }
+                if (node.isLeaf() || test == FrustumTest::Inside) {
+                    for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; ++i) {
+                        if (test == FrustumTest::Inside || frustum.intersects(itemBounds[items[i]])) {
+                            visit(items[i]);
+                        }
+                    }
+                    continue;
+                }
+                stack[top++] = node.leftChild + 1;
+                stack[top++] = node.leftChild;
+            }
+        }
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte est à moins d'une distance d'un point.
+         * @param point Le point.
+         * @param radius La distance maximale entre le point et la boîte.
+         * @param visit Le visiteur, appelé avec l'indice de chaque objet (uint32_t).
+         */
+        template <typename Visitor>
+        void forEachWithin(const Point3D& point, float radius, Visitor&& visit) const {
+            if (nodes.empty()) {
+                return;
+            }
+            auto within = [&](const BoundingBox3D& box) {
+                Point3D d = point - Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+                return d.dotProduct(d) <= radius * radius;
+            };
+            std::array<uint32_t, MAX_DEPTH + 1> stack;
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const BvhNode& node = nodes[stack[--top]];
+                if (!within(node.box)) {
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    for (uint32_t i = node.firstItem; i < node.firstItem + node.itemCount; ++i) {
+                        if (within(itemBounds[items[i]])) {
+                            visit(items[i]);
+                        }
+                    }
+                    continue;
+                }
+                stack[top++] = node.leftChild + 1;
+                stack[top++] = node.leftChild;
+            }
+        }
+
+        /**
+         * @brief Cherche l'objet dont la boîte est touchée en premier par un rayon.
+         * @param ray Le rayon.
+         * @param hit L'objet touché et la distance d'entrée dans sa boîte.
+         * @param maxDistance La distance au-delà de laquelle les objets sont ignorés.
+         * @return true si un objet est touché, false sinon.
+         */
+        bool raycast(const Ray3D& ray, BvhRayHit& hit, float maxDistance = std::numeric_limits<float>::max()) const;
+
+        /**
+         * @brief Cherche l'objet dont la boîte est la plus proche d'un point.
+         * @param point Le point.
+         * @param item L'indice de l'objet le plus proche.
+         * @param distance La distance du point à la boîte de cet objet (0 si le point est dedans).
+         * @return true si la hiérarchie contient au moins un objet, false sinon.
+         */
+        bool nearest(const Point3D& point, uint32_t& item, float& distance) const;
+
+        const std::vector<BvhNode>& getNodes() const { return nodes; }
+        size_t getItemCount() const { return itemBounds.size(); }
+        size_t getRebuildCount() const { return rebuildCount; }
+        float getRebuildThreshold() const { return rebuildThreshold; }
+
+        /**
+         * @brief Calcule la profondeur de la hiérarchie (1 pour une racine seule, 0 si vide).
+         */
+        int depth() const;
+};
+
+#endif // BVH3D_H
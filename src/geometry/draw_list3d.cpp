@@ -0,0 +1,44 @@
+#include "draw_list3d.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr int DEPTH_SHIFT = DrawList3D::MATERIAL_BITS + DrawList3D::OBJECT_BITS;
+
+// Bits d'un flottant remis dans l'ordre des entiers non signés : négatifs inversés, positifs avec le bit de signe levé
+uint32_t orderedBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+float fromOrderedBits(uint32_t ordered) {
+    const uint32_t bits = (ordered & 0x80000000u) ? (ordered & 0x7fffffffu) : ~ordered;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// La profondeur est inversée : la clé la plus petite est celle du triangle le plus lointain
+uint64_t DrawList3D::makeKey(float depth, uint16_t material, uint16_t object) {
+    // -0 et +0 partagent la même clé
+    if (depth == 0.0f) {
+        depth = 0.0f;
+    }
+    const uint32_t depthBits = ~orderedBits(depth);
+    return (static_cast<uint64_t>(depthBits) << DEPTH_SHIFT) | (static_cast<uint64_t>(material) << OBJECT_BITS) | object;
+}
+
+float DrawList3D::keyDepth(uint64_t key) {
+    return fromOrderedBits(~static_cast<uint32_t>(key >> DEPTH_SHIFT));
+}
+
+// Les indices départagent les clés égales : ils suivent l'ordre d'ajout dans la boucle de soumission
+void DrawList3D::sort() {
+    std::sort(items.begin(), items.end(), [](const DrawItem& a, const DrawItem& b) {
+        return a.key != b.key ? a.key < b.key : a.index < b.index;
+    });
+}
@@ -0,0 +1,110 @@
+/**
+ * @file draw_list3d.h
+ * @brief Déclaration de la classe DrawList3D : liste de dessin unique d'une image, triée une seule fois.
+ *
+ * Chaque objet soumet ses triangles sous forme d'éléments compacts : une clé de tri de 64 bits
+ * (profondeur, matériau, objet) et l'indice du triangle dans les tableaux de l'appelant. La liste
+ * est triée une seule fois par image, puis parcourue par le rastériseur en une seule boucle : les
+ * triangles de tous les objets sont ainsi dessinés du plus lointain au plus proche. La profondeur
+ * étant exacte, l'ordre de la liste ne regroupe pas les triangles par matériau.
+ */
+#ifndef DRAW_LIST3D_H
+#define DRAW_LIST3D_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct DrawItem
+ * @brief Élément de la liste de dessin : une clé de tri et l'indice d'un triangle.
+ */
+struct DrawItem {
+    uint64_t key;   ///< Clé de tri (voir DrawList3D::makeKey).
+    uint32_t index; ///< Indice du triangle, choisi par l'appelant.
+};
+
+/**
+ * @class DrawList3D
+ * @brief Éléments de dessin de toute une image, triés du plus lointain au plus proche.
+ *
+ * Disposition de la clé, du bit de poids fort au bit de poids faible :
+ * - 32 bits de profondeur, inversés pour que l'ordre croissant des clés aille du plus lointain au plus proche ;
+ * - 16 bits de matériau : ne départage que des éléments de profondeur exactement égale ;
+ * - 16 bits d'objet : à profondeur et matériau égaux, les triangles d'un même objet se suivent. Ce champ
+ *   ne sert qu'à départager : un numéro d'objet réutilisé (après 65 536 objets) ne change pas l'ordre
+ *   de dessin tant que les indices suivent l'ordre de soumission.
+ *
+ * La profondeur est gardée exacte (bits du flottant remis dans l'ordre des entiers non signés), si
+ * bien que trier les clés entières revient à trier les profondeurs. Les éléments de même clé sont
+ * rangés par indice croissant. La mémoire est conservée par clear : une image en régime établi n'alloue rien.
+ */
+class DrawList3D {
+    private:
+        std::vector<DrawItem> items; // Éléments de l'image courante.
+
+    public:
+        static constexpr int MATERIAL_BITS = 16; ///< Bits de matériau dans la clé.
+        static constexpr int OBJECT_BITS = 16;   ///< Bits d'objet dans la clé.
+
+        /**
+         * @brief Compose une clé de tri.
+         * @param depth La profondeur du triangle (les plus grandes sont dessinées en premier).
+         * @param material Le matériau, c'est-à-dire l'état de dessin du triangle.
+         * @param object L'objet auquel appartient le triangle.
+         * @return La clé de 64 bits.
+         */
+        static uint64_t makeKey(float depth, uint16_t material, uint16_t object);
+
+        /**
+         * @brief Retrouve la profondeur exacte codée dans une clé.
+         */
+        static float keyDepth(uint64_t key);
+
+        /**
+         * @brief Retrouve le matériau codé dans une clé.
+         */
+        static uint16_t keyMaterial(uint64_t key) { return static_cast<uint16_t>(key >> OBJECT_BITS); }
+
+        /**
+         * @brief Retrouve l'objet codé dans une clé.
+         */
+        static uint16_t keyObject(uint64_t key) { return static_cast<uint16_t>(key); }
+
+        /**
+         * @brief Vide la liste en conservant sa mémoire.
+         */
+        void clear() { items.clear(); }
+
+        /**
+         * @brief Réserve la place pour un nombre d'éléments.
+         */
+        void reserve(size_t count) { items.reserve(count); }
+
+        /**
+         * @brief Ajoute un élément.
+         * @param depth La profondeur du triangle.
+         * @param material Le matériau du triangle.
+         * @param object L'objet auquel appartient le triangle.
+         * @param index L'indice du triangle dans les tableaux de l'appelant.
+         */
+        void add(float depth, uint16_t material, uint16_t object, uint32_t index) {
+            items.push_back(DrawItem{makeKey(depth, material, object), index});
+        }
+
+        /**
+         * @brief Trie les éléments par clé croissante : du plus lointain au plus proche, puis par matériau et par objet.
+         *
+         * Les éléments de même clé sont rangés par indice croissant : l'ordre reste déterministe.
+         */
+        void sort();
+
+        size_t size() const { return items.size(); }
+        bool empty() const { return items.empty(); }
+        size_t capacity() const { return items.capacity(); }
+        const DrawItem& operator[](size_t i) const { return items[i]; }
+        std::vector<DrawItem>::const_iterator begin() const { return items.begin(); }
+        std::vector<DrawItem>::const_iterator end() const { return items.end(); }
+};
+
+#endif // DRAW_LIST3D_H
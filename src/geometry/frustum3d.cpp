@@ -0,0 +1,61 @@
+#include "frustum3d.h"
+#include "geometry_utils.h"
+#include <cmath>
+#include <stdexcept>
+
+Frustum3D::Frustum3D(const std::array<Point3D, PLANE_COUNT>& normals, const std::array<float, PLANE_COUNT>& offsets) {
+    for (int i = 0; i < PLANE_COUNT; ++i) {
+        float length = normals[i].norm();
+        if (length < TOLERANCE) {
+            throw std::invalid_argument("La normale d'un plan du volume de vision ne peut pas être nulle.");
+        }
+        // L'équation entière est divisée par la norme : les distances aux plans restent métriques
+        this->normals[i] = normals[i] * (1.0f / length);
+        this->offsets[i] = offsets[i] / length;
+    }
+}
+
+// Bord droit : dx <= k (d + dz) avec k = largeur / (2d), soit -x + k z + (ex + k (d - ez)) >= 0
+Frustum3D Frustum3D::fromProjection(const Point3D& eye, float projectionPlaneDistance, float width, float height, float farDistance) {
+    if (projectionPlaneDistance <= 0 || width <= 0 || height <= 0 || farDistance <= 0) {
+        throw std::invalid_argument("Les paramètres du volume de vision doivent être strictement positifs.");
+    }
+    const float kx = width / (2.0f * projectionPlaneDistance);
+    const float ky = height / (2.0f * projectionPlaneDistance);
+    const float apexZ = projectionPlaneDistance - eye.getZ();
+    return Frustum3D(
+        {Point3D(1, 0, kx), Point3D(-1, 0, kx), Point3D(0, 1, ky), Point3D(0, -1, ky), Point3D(0, 0, 1), Point3D(0, 0, -1)},
+        {-eye.getX() + kx * apexZ, eye.getX() + kx * apexZ, -eye.getY() + ky * apexZ, eye.getY() + ky * apexZ,
+         -eye.getZ(), eye.getZ() + farDistance});
+}
+
+bool Frustum3D::contains(const Point3D& point) const {
+    for (int i = 0; i < PLANE_COUNT; ++i) {
+        if (normals[i].dotProduct(point) + offsets[i] < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Méthode centre-demi-dimensions : la boîte s'étend de |n| . e de part et d'autre de son centre le long de n
+FrustumTest Frustum3D::classify(const BoundingBox3D& box) const {
+    if (box.isEmpty()) {
+        return FrustumTest::Outside;
+    }
+    const Point3D center = box.center();
+    const Point3D extent = box.halfExtent();
+    FrustumTest result = FrustumTest::Inside;
+    for (int i = 0; i < PLANE_COUNT; ++i) {
+        const Point3D& n = normals[i];
+        float distance = n.dotProduct(center) + offsets[i];
+        float radius = std::abs(n.getX()) * extent.getX() + std::abs(n.getY()) * extent.getY() + std::abs(n.getZ()) * extent.getZ();
+        if (distance + radius < 0) {
+            return FrustumTest::Outside;
+        }
+        if (distance - radius < 0) {
+            result = FrustumTest::Intersecting;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file frustum3d.h
+ * @brief Déclaration de la classe Frustum3D : volume de vision délimité par six plans.
+ */
+#ifndef FRUSTUM3D_H
+#define FRUSTUM3D_H
+
+#include "point3d.h"
+#include "bounding_volume3d.h"
+#include <array>
+
+/**
+ * @brief Position d'un volume englobant par rapport au volume de vision.
+ */
+enum class FrustumTest {
+    Outside,      ///< Entièrement hors du volume de vision.
+    Intersecting, ///< Coupé par au moins un plan.
+    Inside        ///< Entièrement dans le volume de vision.
+};
+
+/**
+ * @class Frustum3D
+ * @brief Volume de vision : intersection de six demi-espaces n . p + d >= 0.
+ *
+ * Les normales sont unitaires et orientées vers l'intérieur du volume.
+ */
+class Frustum3D {
+    public:
+        static constexpr int PLANE_COUNT = 6;
+
+    private:
+        std::array<Point3D, PLANE_COUNT> normals; // Normales unitaires, vers l'intérieur.
+        std::array<float, PLANE_COUNT> offsets;   // Distances signées des plans à l'origine.
+
+    public:
+        /**
+         * @brief Constructeur à partir de six plans.
+         * @param normals Les normales des plans, orientées vers l'intérieur (normalisées par le constructeur).
+         * @param offsets Les termes constants d des équations n . p + d = 0.
+         * @throw std::invalid_argument Si une normale est nulle.
+         */
+        Frustum3D(const std::array<Point3D, PLANE_COUNT>& normals, const std::array<float, PLANE_COUNT>& offsets);
+
+        /**
+         * @brief Construit le volume de vision de la projection utilisée par le rendu.
+         *
+         * Le rendu projette un point à l'écran en (dx, dy) * d / (d + dz) + centre de l'écran, où
+         * (dx, dy, dz) est sa position relative à l'œil et d la distance du plan de projection :
+         * les bords de l'écran sont des plans passant par eye - (0, 0, d).
+         *
+         * @param eye La position de l'œil.
+         * @param projectionPlaneDistance La distance du plan de projection.
+         * @param width La largeur de l'écran, en pixels.
+         * @param height La hauteur de l'écran, en pixels.
+         * @param farDistance La profondeur maximale visible devant l'œil.
+         * @return Le volume de vision.
+         * @throw std::invalid_argument Si un paramètre n'est pas strictement positif.
+         */
+        static Frustum3D fromProjection(const Point3D& eye, float projectionPlaneDistance, float width, float height, float farDistance);
+
+        const Point3D& getNormal(int plane) const { return normals.at(plane); }
+        float getOffset(int plane) const { return offsets.at(plane); }
+
+        /**
+         * @brief Vérifie si un point est dans le volume de vision (bords compris).
+         * @param point Le point à tester.
+         * @return true si le point est dans le volume, false sinon.
+         */
+        bool contains(const Point3D& point) const;
+
+        /**
+         * @brief Situe une boîte englobante par rapport au volume de vision.
+         *
+         * Test conservateur : une boîte proche d'un coin du volume peut être déclarée coupée
+         * alors qu'elle est dehors, jamais l'inverse.
+         *
+         * @param box La boîte.
+         * @return La position de la boîte (Outside pour une boîte vide).
+         */
+        FrustumTest classify(const BoundingBox3D& box) const;
+
+        /**
+         * @brief Vérifie si une boîte englobante touche le volume de vision.
+         * @param box La boîte.
+         * @return true si la boîte n'est pas entièrement dehors.
+         */
+        bool intersects(const BoundingBox3D& box) const { return classify(box) != FrustumTest::Outside; }
+};
+
+#endif // FRUSTUM3D_H
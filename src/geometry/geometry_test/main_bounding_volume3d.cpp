@@ -0,0 +1,74 @@
+#include <cassert>
+#include <iostream>
+#include "../bounding_volume3d.h"
+#include "../transform3d.h"
+
+void testBoundingVolume3D() {
+    // Boîte vide, puis étendue
+    BoundingBox3D box;
+    assert(box.isEmpty());
+    assert(box.surfaceArea() == 0.0f);
+    box.expand(Point3D(1, 2, 3));
+    assert(!box.isEmpty());
+    assert(box.getMin() == Point3D(1, 2, 3) && box.getMax() == Point3D(1, 2, 3));
+    box.expand(Point3D(-1, 4, 0));
+    assert(box.getMin() == Point3D(-1, 2, 0) && box.getMax() == Point3D(1, 4, 3));
+    std::cout << "check1 (expand)" << std::endl;
+
+    // Centre, demi-dimensions et surface
+    assert(box.center() == Point3D(0, 3, 1.5f));
+    assert(box.halfExtent() == Point3D(1, 1, 1.5f));
+    assert(box.surfaceArea() == 2.0f * (2 * 2 + 2 * 3 + 3 * 2));
+    std::cout << "check2 (center/extent/area)" << std::endl;
+
+    // Inclusion et chevauchement
+    assert(box.contains(Point3D(0, 3, 1)));
+    assert(!box.contains(Point3D(0, 5, 1)));
+    assert(box.intersects(BoundingBox3D(Point3D(1, 4, 3), Point3D(2, 5, 4))));
+    assert(!box.intersects(BoundingBox3D(Point3D(1.5f, 0, 0), Point3D(2, 5, 4))));
+    BoundingBox3D merged = box;
+    merged.expand(BoundingBox3D(Point3D(5, 5, 5), Point3D(6, 6, 6)));
+    assert(merged.getMax() == Point3D(6, 6, 6) && merged.getMin() == box.getMin());
+    std::cout << "check3 (contains/intersects)" << std::endl;
+
+    // Boîte transformée : englobe les coins transformés
+    BoundingBox3D unit(Point3D(0, 0, 0), Point3D(1, 1, 1));
+    Transform3D rotation = Transform3D::rotation(0.5f, 'y').then(Transform3D::translation(Point3D(3, 0, 0)));
+    BoundingBox3D rotated = unit.transformed(rotation);
+    for (int i = 0; i < 8; ++i) {
+        Point3D corner(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+        Point3D moved = rotation.apply(corner);
+        BoundingBox3D tolerant(rotated.getMin() - Point3D(1e-5f, 1e-5f, 1e-5f), rotated.getMax() + Point3D(1e-5f, 1e-5f, 1e-5f));
+        assert(tolerant.contains(moved));
+    }
+    std::cout << "check4 (transformed)" << std::endl;
+
+    // Sphère englobante
+    BoundingSphere3D sphere(Point3D(0, 0, 0), 2.0f);
+    assert(sphere.contains(Point3D(1, 1, 1)));
+    assert(!sphere.contains(Point3D(2, 2, 0)));
+    assert(sphere.intersects(BoundingSphere3D(Point3D(3, 0, 0), 1.0f)));
+    assert(!sphere.intersects(BoundingSphere3D(Point3D(4, 0, 0), 1.0f)));
+    BoundingBox3D sphereBox = BoundingSphere3D(Point3D(1, 2, 3), 2.0f).boundingBox();
+    assert(sphereBox.getMin() == Point3D(-1, 0, 1) && sphereBox.getMax() == Point3D(3, 4, 5));
+    std::cout << "check5 (bounding sphere)" << std::endl;
+
+    // Paramètres invalides
+    try {
+        BoundingBox3D invalid(Point3D(1, 0, 0), Point3D(0, 1, 1));
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        BoundingSphere3D invalid(Point3D(), -1.0f);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "check6 (invalid parameters)" << std::endl;
+    }
+
+    std::cout << "All BoundingVolume3D tests passed!" << std::endl;
+}
+
+int main() {
+    testBoundingVolume3D();
+    return 0;
+}
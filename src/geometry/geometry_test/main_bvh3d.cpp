@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "../bvh3d.h"
+#include "../sphere3d.h"
+
+// Sphères réparties au hasard dans un cube de côté 1000 (graine fixe)
+std::vector<Sphere3D> randomSpheres(size_t count, unsigned seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> radius(0.5f, 5.0f);
+    std::vector<Sphere3D> spheres;
+    for (size_t i = 0; i < count; ++i) {
+        spheres.emplace_back(Point3D(position(random), position(random), position(random)), radius(random), 4);
+    }
+    return spheres;
+}
+
+std::vector<BoundingBox3D> boundsOf(const std::vector<Sphere3D>& spheres) {
+    std::vector<BoundingBox3D> bounds;
+    for (const Sphere3D& sphere : spheres) {
+        bounds.push_back(sphere.boundingBox());
+    }
+    return bounds;
+}
+
+// Réponses de référence, par parcours de tous les objets
+std::vector<uint32_t> bruteFrustum(const std::vector<BoundingBox3D>& bounds, const Frustum3D& frustum) {
+    std::vector<uint32_t> result;
+    for (uint32_t i = 0; i < bounds.size(); ++i) {
+        if (frustum.intersects(bounds[i])) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+float bruteRay(const std::vector<BoundingBox3D>& bounds, const Ray3D& ray) {
+    float best = std::numeric_limits<float>::max();
+    for (const BoundingBox3D& box : bounds) {
+        float t;
+        if (ray.intersects(box, t)) {
+            best = std::min(best, t);
+        }
+    }
+    return best;
+}
+
+float bruteNearest(const std::vector<BoundingBox3D>& bounds, const Point3D& point) {
+    float best = std::numeric_limits<float>::max();
+    for (const BoundingBox3D& box : bounds) {
+        Point3D d = point - Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+        best = std::min(best, d.norm());
+    }
+    return best;
+}
+
+// Compare les trois requêtes de la hiérarchie aux réponses de référence
+void checkQueries(const Bvh3D& bvh, const std::vector<BoundingBox3D>& bounds, unsigned seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> coordinate(-600.0f, 600.0f);
+    for (int q = 0; q < 50; ++q) {
+        Point3D eye(coordinate(random), coordinate(random), coordinate(random));
+        Frustum3D frustum = Frustum3D::fromProjection(eye, 100.0f, 400.0f, 300.0f, 400.0f);
+        std::vector<uint32_t> found;
+        bvh.queryFrustum(frustum, found);
+        std::sort(found.begin(), found.end());
+        assert(found == bruteFrustum(bounds, frustum));
+
+        Ray3D ray(eye, Point3D(coordinate(random), coordinate(random), coordinate(random)) - eye);
+        BvhRayHit hit;
+        float expected = bruteRay(bounds, ray);
+        bool touched = bvh.raycast(ray, hit);
+        assert(touched == (expected < std::numeric_limits<float>::max()));
+        if (touched) {
+            float t;
+            assert(hit.distance == expected && ray.intersects(bounds[hit.item], t) && t == expected);
+        }
+
+        uint32_t item;
+        float distance;
+        assert(bvh.nearest(eye, item, distance));
+        assert(std::abs(distance - bruteNearest(bounds, eye)) < 1e-3f);
+    }
+}
+
+void testBvh3D() {
+    // Rayons et volume de vision
+    Ray3D ray(Point3D(0, 0, -10), Point3D(0, 0, 2));
+    BoundingBox3D unit(Point3D(-1, -1, -1), Point3D(1, 1, 1));
+    float t;
+    assert(ray.intersects(unit, t) && std::abs(t - 9.0f) < 1e-5f);
+    assert(!ray.intersects(unit, t, 5.0f));
+    assert(!Ray3D(Point3D(0, 2, -10), Point3D(0, 0, 1)).intersects(unit, t));
+    assert(Ray3D(Point3D(0, 1, -10), Point3D(0, 0, 1)).intersects(unit, t)); // Rayon parallèle sur un bord
+    assert(Ray3D(Point3D(0, 0, 0), Point3D(1, 1, 0)).intersects(unit, t) && t == 0.0f);
+    Frustum3D frustum = Frustum3D::fromProjection(Point3D(0, 0, -100), 50.0f, 200.0f, 100.0f, 1000.0f);
+    assert(frustum.contains(Point3D(0, 0, 0)) && !frustum.contains(Point3D(0, 0, -150)) && !frustum.contains(Point3D(0, 0, 901)));
+    // Bord droit de l'écran : à dz = 50, d / (d + dz) = 1/2 et dx = 200 est projeté à 100 pixels du centre
+    assert(frustum.contains(Point3D(199.9f, 0, -50)) && !frustum.contains(Point3D(200.1f, 0, -50)));
+    assert(frustum.classify(unit) == FrustumTest::Inside);
+    assert(frustum.classify(BoundingBox3D(Point3D(-1, -1, -101), Point3D(1, 1, -99))) == FrustumTest::Intersecting);
+    assert(frustum.classify(BoundingBox3D(Point3D(500, 0, 0), Point3D(501, 1, 1))) == FrustumTest::Outside);
+    try {
+        Ray3D invalid{Point3D(), Point3D()};
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check1 (ray and frustum tests)" << std::endl;
+
+    // Construction : chaque objet dans une seule feuille, boîtes emboîtées, profondeur logarithmique
+    std::vector<Sphere3D> spheres = randomSpheres(2000, 7);
+    std::vector<BoundingBox3D> bounds = boundsOf(spheres);
+    Bvh3D bvh;
+    bvh.build(bounds);
+    assert(bvh.getItemCount() == bounds.size());
+    size_t leafItems = 0;
+    for (const BvhNode& node : bvh.getNodes()) {
+        if (!node.isLeaf()) {
+            const BvhNode& left = bvh.getNodes()[node.leftChild];
+            const BvhNode& right = bvh.getNodes()[node.leftChild + 1];
+            assert(left.firstItem == node.firstItem && left.itemCount + right.itemCount == node.itemCount);
+            assert(node.box.contains(left.box.getMin()) && node.box.contains(right.box.getMax()));
+        } else {
+            assert(node.itemCount <= BVH_BIN_COUNT);
+            leafItems += node.itemCount;
+        }
+    }
+    assert(leafItems == bounds.size() && bvh.getNodes()[0].itemCount == bounds.size());
+    assert(bvh.depth() <= 24 && bvh.sahCost() < bounds.size() / 20.0f);
+    std::cout << "check2 (" << bvh.getNodes().size() << " nodes, depth " << bvh.depth() << ", SAH cost " << bvh.sahCost() << ")" << std::endl;
+
+    // Requêtes identiques au parcours exhaustif
+    checkQueries(bvh, bounds, 11);
+    std::cout << "check3 (frustum, ray and nearest queries)" << std::endl;
+
+    // Objets animés : petits déplacements, boîtes ajustées sur place sans reconstruction
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+    for (int frame = 0; frame < 10; ++frame) {
+        for (Sphere3D& sphere : spheres) {
+            sphere.setCenter(sphere.getCenter() + Point3D(jitter(random), jitter(random), jitter(random)));
+        }
+        bounds = boundsOf(spheres);
+        assert(!bvh.refit(bounds));
+    }
+    assert(bvh.getRebuildCount() == 0);
+    checkQueries(bvh, bounds, 12);
+    std::cout << "check4 (refit in place, SAH cost " << bvh.sahCost() << ")" << std::endl;
+
+    // Objets mélangés : la qualité se dégrade, la hiérarchie est reconstruite
+    std::vector<Sphere3D> shuffled = randomSpheres(2000, 99);
+    bounds = boundsOf(shuffled);
+    assert(bvh.refit(bounds));
+    assert(bvh.getRebuildCount() == 1 && bvh.sahCost() < bounds.size() / 20.0f);
+    checkQueries(bvh, bounds, 13);
+    try {
+        bounds.pop_back();
+        bvh.refit(bounds);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check5 (rebuild when quality degrades)" << std::endl;
+
+    // Cas limites : hiérarchie vide, objets confondus, seuil invalide
+    Bvh3D empty;
+    empty.build({});
+    BvhRayHit hit;
+    uint32_t item;
+    float distance;
+    assert(!empty.raycast(ray, hit) && !empty.nearest(Point3D(), item, distance) && empty.depth() == 0);
+    Bvh3D stacked;
+    stacked.build(std::vector<BoundingBox3D>(100, unit));
+    std::vector<uint32_t> all;
+    stacked.queryFrustum(frustum, all);
+    assert(all.size() == 100 && stacked.depth() <= Bvh3D::MAX_DEPTH);
+    try {
+        Bvh3D invalid(0.5f);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check6 (edge cases)" << std::endl;
+}
+
+int main() {
+    testBvh3D();
+    std::cout << "All Bvh3D tests passed!" << std::endl;
+    return 0;
+}
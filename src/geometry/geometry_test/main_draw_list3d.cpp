@@ -0,0 +1,88 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include "../draw_list3d.h"
+
+namespace {
+
+uint32_t nextRandom(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+float randomFloat(uint32_t& state, float low, float high) {
+    return low + (high - low) * (nextRandom(state) % 100000) / 100000.0f;
+}
+
+} // namespace
+
+void testKeys() {
+    const float depths[] = {0.0f, -0.0f, 1.0f, -1.0f, 123.456f, -98765.4f, 1e-30f, 3e38f};
+    for (float depth : depths) {
+        const uint64_t key = DrawList3D::makeKey(depth, 0xBEEF, 0x1234);
+        assert(DrawList3D::keyDepth(key) == depth && DrawList3D::keyMaterial(key) == 0xBEEF && DrawList3D::keyObject(key) == 0x1234);
+    }
+    assert(DrawList3D::makeKey(0.0f, 1, 2) == DrawList3D::makeKey(-0.0f, 1, 2));
+    std::cout << "check1 (depth, material and object round trip through the key)" << std::endl;
+
+    // La profondeur domine : plus lointain d'abord, quels que soient le matériau et l'objet
+    assert(DrawList3D::makeKey(50.0f, 0xFFFF, 0xFFFF) < DrawList3D::makeKey(49.9f, 0, 0));
+    assert(DrawList3D::makeKey(1.0f, 0, 0) < DrawList3D::makeKey(-1.0f, 0, 0));
+    assert(DrawList3D::makeKey(-1.0f, 0, 0) < DrawList3D::makeKey(-2.0f, 0, 0));
+    // Puis le matériau, puis l'objet
+    assert(DrawList3D::makeKey(5.0f, 1, 9) < DrawList3D::makeKey(5.0f, 2, 0));
+    assert(DrawList3D::makeKey(5.0f, 1, 3) < DrawList3D::makeKey(5.0f, 1, 4));
+    std::cout << "check2 (keys order by depth, then material, then object)" << std::endl;
+}
+
+// Deux objets imbriqués en profondeur : leurs triangles doivent s'entrelacer
+void testCrossObjectOrder() {
+    DrawList3D list;
+    list.add(10.0f, 0, 0, 0); // Objet 0
+    list.add(30.0f, 0, 0, 1);
+    list.add(20.0f, 1, 1, 2); // Objet 1
+    list.add(40.0f, 1, 1, 3);
+    list.add(30.0f, 1, 1, 4);
+    list.sort();
+    const uint32_t expected[] = {3, 1, 4, 2, 0};
+    assert(list.size() == 5);
+    for (size_t i = 0; i < list.size(); ++i) {
+        assert(list[i].index == expected[i]);
+    }
+    std::cout << "check3 (triangles of both objects interleave by depth)" << std::endl;
+}
+
+void testSortAndReuse() {
+    DrawList3D list;
+    uint32_t state = 50;
+    const size_t count = 20000;
+    for (int frame = 0; frame < 3; ++frame) {
+        list.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            // Profondeurs grossières pour créer des égalités, départagées par le matériau puis l'indice
+            const float depth = static_cast<float>(static_cast<int>(randomFloat(state, -50, 500)));
+            list.add(depth, static_cast<uint16_t>(nextRandom(state) % 4), static_cast<uint16_t>(i % 7), i);
+        }
+        list.sort();
+        for (size_t i = 1; i < list.size(); ++i) {
+            const uint64_t a = list[i - 1].key, b = list[i].key;
+            assert(DrawList3D::keyDepth(a) >= DrawList3D::keyDepth(b));
+            if (DrawList3D::keyDepth(a) == DrawList3D::keyDepth(b)) {
+                assert(DrawList3D::keyMaterial(a) <= DrawList3D::keyMaterial(b));
+            }
+            assert(a < b || (a == b && list[i - 1].index < list[i].index));
+        }
+    }
+    const size_t capacity = list.capacity();
+    list.clear();
+    assert(list.empty() && list.capacity() == capacity);
+    std::cout << "check4 (" << count << " items sorted back to front, memory kept by clear)" << std::endl;
+}
+
+int main() {
+    testKeys();
+    testCrossObjectOrder();
+    testSortAndReuse();
+    std::cout << "All draw list tests passed!" << std::endl;
+    return 0;
+}
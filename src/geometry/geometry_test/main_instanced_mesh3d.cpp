@@ -0,0 +1,90 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../instanced_mesh3d.h"
+#include "../sphere3d.h"
+#include "../pave3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+void testInstancedMesh3D() {
+    // Le maillage est partagé : ajouter des instances ne le recopie pas
+    Sphere3D sphere(Point3D(), 1.0f, 8);
+    InstancedMesh3D spheres = InstancedMesh3D::fromSphere(sphere);
+    long sharedCount = spheres.getSharedMesh().use_count();
+    spheres.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        spheres.addInstance(ModelTransform(Point3D(i * 3.0f, 0, 50), Quaternion(), 1.0f + i % 3), Couleur(i % 256, 0, 0));
+    }
+    assert(spheres.getInstanceCount() == 1000);
+    assert(spheres.getSharedMesh().use_count() == sharedCount);
+    assert(spheres.getSharedMesh() == sphere.getMesh());
+    std::cout << "check1 (mesh shared by 1000 instances)" << std::endl;
+
+    // Les triangles placés à la volée coïncident avec ceux d'une sphère de même transformation
+    Sphere3D placed(Point3D(12, -3, 40), 2.5f, 8);
+    placed.rotate(0.7f, 'y', Point3D(12, -3, 40));
+    InstancedMesh3D single = InstancedMesh3D::fromSphere(placed);
+    single.addInstance(placed.getModelTransform(), Couleur(0, 255, 0));
+    std::vector<Triangle3D> expected;
+    for (const Quad3D& quad : placed.getQuads()) {
+        expected.push_back(quad.getFirstTriangle());
+        expected.push_back(quad.getSecondTriangle());
+    }
+    size_t k = 0;
+    single.forEachWorldTriangle(0, [&](const Triangle3D& t, const Couleur& color) {
+        assert(approxEqual(t.getP1(), expected[k].getP1()));
+        assert(approxEqual(t.getP2(), expected[k].getP2()));
+        assert(approxEqual(t.getP3(), expected[k].getP3()));
+        assert(color.getVert() == 255);
+        ++k;
+    });
+    assert(k == expected.size());
+    std::cout << "check2 (world triangles match the equivalent sphere)" << std::endl;
+
+    // Suppression : la dernière instance prend la place de l'instance supprimée
+    spheres.removeInstance(10);
+    assert(spheres.getInstanceCount() == 999);
+    assert(approxEqual(spheres.getTransform(10).getPosition(), Point3D(999 * 3.0f, 0, 50)));
+    assert(spheres.getColor(10).getRouge() == 999 % 256);
+    spheres.setColor(10, Couleur(1, 2, 3));
+    assert(spheres.getColor(10).getBleu() == 3);
+    std::cout << "check3 (swap-and-pop removal and per-instance color)" << std::endl;
+
+    // Sphère englobante d'une instance : rayon du maillage multiplié par l'échelle
+    BoundingSphere3D bounds = spheres.getInstanceBounds(2);
+    assert(approxEqual(bounds.getCenter(), Point3D(6, 0, 50)));
+    assert(std::fabs(bounds.getRadius() - 3.0f) < 1e-4f);
+    std::cout << "check4 (instance bounds)" << std::endl;
+
+    // Pavé : les six faces sont partagées par toutes les instances
+    Pave3D pave(Point3D(0, 0, 0), 2, 2, 2, Couleur(255, 0, 0));
+    InstancedMesh3D boxes = InstancedMesh3D::fromPave(pave);
+    assert(boxes.getMesh().size() == 6);
+    boxes.addInstance(ModelTransform(Point3D(5, 5, 5)), Couleur(0, 0, 255));
+    size_t triangles = 0;
+    boxes.forEachWorldTriangle(0, [&](const Triangle3D&, const Couleur&) { ++triangles; });
+    assert(triangles == 12);
+    std::cout << "check5 (box instances)" << std::endl;
+
+    // Indices invalides et maillage nul
+    bool thrown = false;
+    try { boxes.getTransform(1); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { InstancedMesh3D invalid(nullptr); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    std::cout << "check6 (invalid arguments)" << std::endl;
+}
+
+int main() {
+    testInstancedMesh3D();
+    std::cout << "All InstancedMesh3D tests passed!" << std::endl;
+    return 0;
+}
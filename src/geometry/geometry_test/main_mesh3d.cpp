@@ -0,0 +1,107 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include "../mesh3d.h"
+#include "../pave3d.h"
+#include "../sphere3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+// Toutes les normales pointent vers l'extérieur d'un solide convexe centré à l'origine
+bool outwardNormals(const Mesh3D& mesh) {
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        if (mesh.getFaceNormal(t).dotProduct(mesh.getTriangle(t).getCentroid()) <= 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testMesh3D() {
+    // Construction indexée : les sommets sont partagés entre les triangles
+    Mesh3D mesh;
+    uint32_t a = mesh.addVertex(Point3D(0, 0, 0));
+    uint32_t b = mesh.addVertex(Point3D(1, 0, 0));
+    uint32_t c = mesh.addVertex(Point3D(1, 1, 0));
+    uint32_t d = mesh.addVertex(Point3D(0, 1, 0));
+    mesh.addQuad(a, b, c, d, Couleur(10, 20, 30));
+    assert(mesh.getVertexCount() == 4);
+    assert(mesh.getTriangleCount() == 2);
+    Triangle3D second = mesh.getTriangle(1);
+    assert(approxEqual(second.getP2(), Point3D(1, 1, 0)) && approxEqual(second.getP3(), Point3D(0, 1, 0)));
+    assert(mesh.getFaceColor(1).getBleu() == 30);
+    assert(approxEqual(mesh.getFaceNormal(0), Point3D(0, 0, 1)));
+    bool thrown = false;
+    try { mesh.addTriangle(a, b, 7, Couleur()); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown && mesh.getTriangleCount() == 2);
+    std::cout << "check1 (indexed construction)" << std::endl;
+
+    // Export d'un pavé : mêmes triangles et couleurs que ses faces en espace objet
+    Pave3D pave(Point3D(0, 0, 0), 2, 3, 4, Couleur(255, 0, 0));
+    pave.setFaceColor(2, Couleur(0, 255, 0));
+    Mesh3D paveMesh = pave.toMesh();
+    assert(paveMesh.getVertexCount() == 24 && paveMesh.getTriangleCount() == 12);
+    for (size_t i = 0; i < 6; ++i) {
+        const Quad3D& face = pave.getLocalFace(i);
+        assert(approxEqual(paveMesh.getTriangle(2 * i).getCentroid(), face.getFirstTriangle().getCentroid()));
+        assert(approxEqual(paveMesh.getTriangle(2 * i + 1).getCentroid(), face.getSecondTriangle().getCentroid()));
+    }
+    assert(paveMesh.getFaceColor(4).getVert() == 255);
+    std::cout << "check2 (box export)" << std::endl;
+
+    // Export d'une sphère : un niveau de détail, en réutilisant le même maillage
+    Sphere3D sphere(Point3D(5, 0, 0), 2.0f, 16);
+    Mesh3D sphereMesh;
+    sphere.exportMesh(sphereMesh);
+    assert(sphereMesh.getTriangleCount() == 2 * sphere.getLocalQuads().size());
+    int coarsest = sphere.getLodCount() - 1;
+    sphere.exportMesh(sphereMesh, coarsest);
+    assert(sphereMesh.getTriangleCount() == 2 * sphere.getLodQuads(coarsest).size());
+    std::cout << "check3 (sphere export)" << std::endl;
+
+    // Générateurs : nombres de sommets et de faces, normales sortantes
+    Mesh3D cylinder = Mesh3D::cylinder(1.0f, 2.0f, 12, Couleur());
+    assert(cylinder.getVertexCount() == 26 && cylinder.getTriangleCount() == 48);
+    assert(outwardNormals(cylinder));
+    Mesh3D cone = Mesh3D::cone(1.0f, 2.0f, 12, Couleur());
+    assert(cone.getVertexCount() == 14 && cone.getTriangleCount() == 24);
+    assert(outwardNormals(cone));
+    Mesh3D grid = Mesh3D::planeGrid(4.0f, 2.0f, 4, 2, Couleur());
+    assert(grid.getVertexCount() == 15 && grid.getTriangleCount() == 16);
+    for (size_t t = 0; t < grid.getTriangleCount(); ++t) {
+        assert(approxEqual(grid.getFaceNormal(t), Point3D(0, 1, 0)));
+    }
+    std::cout << "check4 (cylinder, cone and grid)" << std::endl;
+
+    // Tore : les normales s'éloignent du cercle central du tube
+    Mesh3D torus = Mesh3D::torus(3.0f, 1.0f, 24, 12, Couleur());
+    assert(torus.getVertexCount() == 288 && torus.getTriangleCount() == 576);
+    for (size_t t = 0; t < torus.getTriangleCount(); ++t) {
+        Point3D centroid = torus.getTriangle(t).getCentroid();
+        Point3D axis = Point3D(centroid.getX(), 0, centroid.getZ()).normalized() * 3.0f;
+        assert(torus.getFaceNormal(t).dotProduct(centroid - axis) > 0.0f);
+    }
+    std::cout << "check5 (torus)" << std::endl;
+
+    // Paramètres invalides, transformation
+    thrown = false;
+    try { Mesh3D::torus(1.0f, 2.0f, 8, 8, Couleur()); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { Mesh3D::cylinder(1.0f, 1.0f, 2, Couleur()); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    grid.transform(Transform3D::translation(Point3D(0, 5, 0)));
+    assert(approxEqual(grid.getPositions().front(), Point3D(-2, 5, -1)));
+    std::cout << "check6 (invalid parameters and transform)" << std::endl;
+}
+
+int main() {
+    testMesh3D();
+    std::cout << "All Mesh3D tests passed!" << std::endl;
+    return 0;
+}
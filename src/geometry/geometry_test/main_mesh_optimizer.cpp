@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../mesh_optimizer.h"
+#include "../sphere3d.h"
+#include "../vertex_welder.h"
+
+// Triangles décrits par leurs positions, chacun ramené à la rotation commençant par son plus petit sommet
+std::vector<std::array<float, 10>> canonicalTriangles(const Mesh3D& mesh) {
+    std::vector<std::array<float, 10>> result;
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        const uint32_t* face = &mesh.getIndices()[3 * t];
+        std::array<std::array<float, 3>, 3> corners;
+        for (int k = 0; k < 3; ++k) {
+            const Point3D& p = mesh.getPositions()[face[k]];
+            corners[k] = {p.getX(), p.getY(), p.getZ()};
+        }
+        std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+        result.push_back({corners[0][0], corners[0][1], corners[0][2], corners[1][0], corners[1][1], corners[1][2],
+                          corners[2][0], corners[2][1], corners[2][2], float(mesh.getFaceColor(t).getVert())});
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void testMeshOptimizer() {
+    // Valeurs de référence : un triangle isolé coûte trois sommets, une soupe sans partage aussi
+    Mesh3D single;
+    single.addVertex(Point3D(0, 0, 0));
+    single.addVertex(Point3D(1, 0, 0));
+    single.addVertex(Point3D(0, 1, 0));
+    single.addTriangle(0, 1, 2, Couleur());
+    assert(MeshOptimizer::computeAcmr(single) == 3.0);
+    assert(MeshOptimizer::computeAcmr(Mesh3D()) == 0.0);
+    Sphere3D sphere(Point3D(), 1.0f, 64);
+    assert(MeshOptimizer::computeAcmr(Mesh3D::fromQuads(sphere.getLocalQuads())) == 2.0);
+    std::cout << "check1 (ACMR reference values)" << std::endl;
+
+    // Sphère : l'ordre des boucles de génération relit chaque anneau trop tard pour le cache
+    WeldReport weldReport;
+    Mesh3D welded = VertexWelder::weld(sphere.getLocalQuads(), weldReport);
+    VertexCacheReport report;
+    Mesh3D optimized = MeshOptimizer::optimize(welded, report);
+    assert(report.cacheSize == DEFAULT_VERTEX_CACHE_SIZE);
+    assert(report.acmrBefore == MeshOptimizer::computeAcmr(welded));
+    assert(report.acmrAfter == MeshOptimizer::computeAcmr(optimized));
+    assert(report.acmrBefore > 0.95 && report.acmrAfter < 0.8 && report.gain() > 0.2);
+    std::cout << "check2 (sphere ACMR " << report.acmrBefore << " -> " << report.acmrAfter << ")" << std::endl;
+
+    // Mêmes triangles, même orientation, mêmes couleurs
+    assert(optimized.getVertexCount() == welded.getVertexCount());
+    assert(canonicalTriangles(optimized) == canonicalTriangles(welded));
+    Mesh3D reordered = MeshOptimizer::optimizeVertexCache(welded);
+    assert(reordered.getPositions().size() == welded.getPositions().size());
+    assert(canonicalTriangles(reordered) == canonicalTriangles(welded));
+    std::cout << "check3 (triangles preserved)" << std::endl;
+
+    // Sommets numérotés dans l'ordre de première utilisation, sommets inutilisés supprimés
+    uint32_t next = 0;
+    for (uint32_t v : optimized.getIndices()) {
+        assert(v <= next);
+        if (v == next) {
+            ++next;
+        }
+    }
+    assert(next == optimized.getVertexCount());
+    Mesh3D withUnused = single;
+    withUnused.addVertex(Point3D(5, 5, 5));
+    assert(MeshOptimizer::optimizeVertexFetch(withUnused).getVertexCount() == 3);
+    std::cout << "check4 (vertices renumbered in first-use order)" << std::endl;
+
+    // Maillages générés : grille et tore
+    for (const Mesh3D& mesh : {Mesh3D::planeGrid(4.0f, 4.0f, 64, 64, Couleur()), Mesh3D::torus(2.0f, 0.5f, 48, 24, Couleur())}) {
+        Mesh3D result = MeshOptimizer::optimize(mesh, report, 32);
+        assert(report.cacheSize == 32 && report.acmrAfter < report.acmrBefore);
+        assert(canonicalTriangles(result) == canonicalTriangles(mesh));
+    }
+    std::cout << "check5 (grid and torus improved)" << std::endl;
+
+    // Cache de taille nulle refusé
+    try {
+        MeshOptimizer::computeAcmr(welded, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        MeshOptimizer::optimize(welded, report, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check6 (invalid cache size)" << std::endl;
+}
+
+int main() {
+    testMeshOptimizer();
+    std::cout << "All MeshOptimizer tests passed!" << std::endl;
+    return 0;
+}
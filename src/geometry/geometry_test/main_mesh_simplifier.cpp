@@ -0,0 +1,103 @@
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../mesh_simplifier.h"
+#include "../sphere3d.h"
+
+// Chaque arête est partagée par exactement deux faces : la surface reste fermée
+bool isClosed(const Mesh3D& mesh) {
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        for (int k = 0; k < 3; ++k) {
+            uint32_t a = indices[3 * t + k], b = indices[3 * t + (k + 1) % 3];
+            ++edges[{std::min(a, b), std::max(a, b)}];
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        if (count != 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testMeshSimplifier() {
+    // Sphère convertie depuis des Quad3D : fusion des sommets puis simplification
+    Sphere3D sphere(Point3D(), 1.0f, 32);
+    Mesh3D full = Mesh3D::fromQuads(sphere.getLocalQuads());
+    Mesh3D simplified = MeshSimplifier::simplify(full, 300);
+    assert(simplified.getTriangleCount() <= 300);
+    assert(simplified.getTriangleCount() > 250);
+    assert(simplified.getVertexCount() < full.getVertexCount() / 4);
+    assert(isClosed(simplified));
+    std::cout << "check1 (sphere simplified to target, still closed)" << std::endl;
+
+    // La forme est conservée : sommets proches de la sphère, faces orientées comme le maillage d'origine
+    for (const Point3D& p : simplified.getPositions()) {
+        assert(std::fabs(p.norm() - 1.0f) < 0.1f);
+    }
+    const bool outward = full.getFaceNormal(0).dotProduct(full.getTriangle(0).getCentroid()) > 0.0f;
+    for (size_t t = 0; t < simplified.getTriangleCount(); ++t) {
+        assert((simplified.getFaceNormal(t).dotProduct(simplified.getTriangle(t).getCentroid()) > 0.0f) == outward);
+    }
+    std::cout << "check2 (shape and orientation preserved)" << std::endl;
+
+    // Grille plane : les bords ouverts sont retenus, la grille reste plane
+    Mesh3D grid = Mesh3D::planeGrid(4.0f, 4.0f, 8, 8, Couleur(0, 0, 255));
+    Mesh3D flat = MeshSimplifier::simplify(grid, 8);
+    assert(flat.getTriangleCount() <= 8);
+    float minX = 0, maxX = 0, minZ = 0, maxZ = 0;
+    for (const Point3D& p : flat.getPositions()) {
+        assert(std::fabs(p.getY()) < 1e-4f);
+        minX = std::min(minX, p.getX()); maxX = std::max(maxX, p.getX());
+        minZ = std::min(minZ, p.getZ()); maxZ = std::max(maxZ, p.getZ());
+    }
+    assert(std::fabs(minX + 2) < 1e-3f && std::fabs(maxX - 2) < 1e-3f);
+    assert(std::fabs(minZ + 2) < 1e-3f && std::fabs(maxZ - 2) < 1e-3f);
+    assert(flat.getFaceColor(0).getBleu() == 255);
+    std::cout << "check3 (open boundaries kept, face colors carried)" << std::endl;
+
+    // Chaîne de niveaux de détail
+    std::vector<size_t> targets = {1000, 400, 100};
+    std::vector<Mesh3D> chain = MeshSimplifier::buildLodChain(full, targets);
+    assert(chain.size() == 3);
+    for (size_t i = 0; i < chain.size(); ++i) {
+        assert(chain[i].getTriangleCount() <= targets[i]);
+        assert(isClosed(chain[i]));
+        if (i > 0) {
+            assert(chain[i].getTriangleCount() < chain[i - 1].getTriangleCount());
+        }
+    }
+    bool thrown = false;
+    try { MeshSimplifier::buildLodChain(full, {100, 400}); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    std::cout << "check4 (LOD chain)" << std::endl;
+
+    // Maillages indépendants en parallèle : même résultat qu'en séquentiel
+    std::vector<Mesh3D> meshes = {full, Mesh3D::torus(3.0f, 1.0f, 48, 24, Couleur()), grid, Mesh3D::cylinder(1.0f, 3.0f, 64, Couleur())};
+    std::vector<std::vector<Mesh3D>> chains = MeshSimplifier::buildLodChains(meshes, {500, 120});
+    assert(chains.size() == meshes.size());
+    for (size_t m = 0; m < meshes.size(); ++m) {
+        std::vector<Mesh3D> expected = MeshSimplifier::buildLodChain(meshes[m], {500, 120});
+        for (size_t level = 0; level < expected.size(); ++level) {
+            assert(chains[m][level].getTriangleCount() == expected[level].getTriangleCount());
+            assert(chains[m][level].getIndices() == expected[level].getIndices());
+            for (size_t i = 0; i < expected[level].getVertexCount(); ++i) {
+                assert(chains[m][level].getPositions()[i] == expected[level].getPositions()[i]);
+            }
+        }
+    }
+    std::cout << "check5 (parallel chains match sequential)" << std::endl;
+}
+
+int main() {
+    testMeshSimplifier();
+    std::cout << "All MeshSimplifier tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <cassert>
+#include <iostream>
+#include "../model_transform.h"
+#include "../sphere3d.h"
+#include "../pave3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+void testModelTransform() {
+    Point3D p(1, -2, 0.5f);
+    Point3D center(3, 1, -1);
+
+    // Identité par défaut
+    ModelTransform identity;
+    assert(identity.apply(p) == p);
+    std::cout << "check1 (identity)" << std::endl;
+
+    // Aller-retour objet -> monde -> objet
+    ModelTransform model(Point3D(4, 5, 6), Quaternion::fromAxisAngle(Point3D(1, 2, 3), 0.9f), 2.5f);
+    assert(approxEqual(model.applyInverse(model.apply(p)), p));
+    std::cout << "check2 (apply/applyInverse)" << std::endl;
+
+    // Rotation autour d'un centre : même résultat que Point3D::rotate
+    ModelTransform rotated;
+    rotated.rotate(0.6f, 'z', center);
+    Point3D expected = p;
+    expected.rotate(0.6f, 'z', center);
+    assert(approxEqual(rotated.apply(p), expected));
+    std::cout << "check3 (rotate around center)" << std::endl;
+
+    // Conversion en matrice et inverse
+    assert(approxEqual(model.toTransform3D().apply(p), model.apply(p)));
+    assert(approxEqual(model.toInverseTransform3D().apply(model.apply(p)), p));
+    std::cout << "check4 (toTransform3D)" << std::endl;
+
+    // Composition parent * enfant
+    ModelTransform child(Point3D(1, 0, 0), Quaternion::fromAxisAngle('y', 0.3f), 0.5f);
+    assert(approxEqual((model * child).apply(p), model.apply(child.apply(p))));
+    assert(approxEqual(model.inverse().apply(model.apply(p)), p));
+    assert(approxEqual((model.inverse() * (model * child)).apply(p), child.apply(p)));
+    std::cout << "check5 (composition)" << std::endl;
+
+    // Sphère : tourner ne modifie que la transformation de modèle, le maillage reste partagé
+    Sphere3D sphere(Point3D(1, 2, 3), 2.0f, 8);
+    Sphere3D copy = sphere;
+    assert(copy.getMesh() == sphere.getMesh());
+    copy.rotate(0.5f, 'x', Point3D(0, 0, 0));
+    copy.translate(Point3D(1, 1, 1));
+    assert(copy.getMesh() == sphere.getMesh());
+    Point3D movedCenter = Point3D(1, 2, 3);
+    movedCenter.rotate(0.5f, 'x', Point3D(0, 0, 0));
+    assert(approxEqual(copy.getCenter(), movedCenter + Point3D(1, 1, 1)));
+    std::cout << "check6 (sphere shares mesh)" << std::endl;
+
+    // Copie sur écriture : modifier une couleur détache le maillage
+    copy.setQuadColor(0, Couleur(0, 255, 0));
+    assert(copy.getMesh() != sphere.getMesh());
+    assert(sphere.getQuads()[0].getColor() != Couleur(0, 255, 0));
+    std::cout << "check7 (copy on write)" << std::endl;
+
+    // Pavé : les faces dans le monde suivent la transformation de modèle
+    Pave3D pave(Point3D(0, 0, 0), 2, 3, 4, Couleur(255, 0, 0));
+    Pave3D other = pave;
+    other.rotate(0.7f, 'y', Point3D(1, 1, 1));
+    assert(other.getMesh() == pave.getMesh());
+    Quad3D face = pave.getFaces()[2];
+    face.rotate(0.7f, 'y', Point3D(1, 1, 1));
+    assert(approxEqual(other.getFaces()[2].getFirstTriangle().getP3(), face.getFirstTriangle().getP3()));
+    std::cout << "check8 (pave model transform)" << std::endl;
+
+    // Échelle invalide
+    try {
+        ModelTransform invalid(Point3D(), Quaternion(), 0.0f);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "check9 (invalid scale)" << std::endl;
+    }
+
+    std::cout << "All ModelTransform tests passed!" << std::endl;
+}
+
+int main() {
+    testModelTransform();
+    return 0;
+}
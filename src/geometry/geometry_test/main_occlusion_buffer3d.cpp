@@ -0,0 +1,125 @@
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include "../occlusion_buffer3d.h"
+
+namespace {
+
+const Point3D EYE(0, 0, -100);
+const float DISTANCE = 50.0f;
+const float SCREEN_WIDTH = 800.0f;
+const float SCREEN_HEIGHT = 600.0f;
+
+uint32_t nextRandom(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+float randomFloat(uint32_t& state, float low, float high) {
+    return low + (high - low) * (nextRandom(state) % 100000) / 100000.0f;
+}
+
+BoundingBox3D boxAround(const Point3D& center, float half) {
+    return BoundingBox3D(center - Point3D(half, half, half), center + Point3D(half, half, half));
+}
+
+} // namespace
+
+void testValidation() {
+    try {
+        OcclusionBuffer3D invalid(0, 10);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    OcclusionBuffer3D buffer;
+    try {
+        buffer.begin(EYE, 0.0f, SCREEN_WIDTH, SCREEN_HEIGHT);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    buffer.begin(EYE, DISTANCE, SCREEN_WIDTH, SCREEN_HEIGHT);
+    assert(buffer.getWidth() == DEFAULT_OCCLUSION_BUFFER_WIDTH && std::isinf(buffer.depthAt(0, 0)));
+    assert(!buffer.isOccluded(boxAround(Point3D(0, 0, 100), 5)));
+    std::cout << "check1 (empty buffer occludes nothing)" << std::endl;
+}
+
+void testWall() {
+    OcclusionBuffer3D buffer(64, 48);
+    buffer.begin(EYE, DISTANCE, SCREEN_WIDTH, SCREEN_HEIGHT);
+    // Mur de 400 x 400, d'épaisseur 10, à z = 0
+    Pave3D wall(Point3D(-200, -200, 0), 400, 400, 10, Couleur(255, 0, 0));
+    buffer.addOccluder(wall);
+    const OcclusionStats& stats = buffer.getStats();
+    assert(stats.occluders == 1 && stats.occluderTriangles > 0);
+
+    assert(buffer.isOccluded(boxAround(Point3D(0, 0, 200), 20)));        // Derrière le mur
+    assert(buffer.isOccluded(boxAround(Point3D(30, -40, 50), 5)));       // Juste derrière
+    assert(!buffer.isOccluded(boxAround(Point3D(0, 0, -20), 5)));        // Devant le mur
+    assert(!buffer.isOccluded(boxAround(Point3D(0, 0, 5), 20)));         // Traverse le mur
+    assert(!buffer.isOccluded(boxAround(Point3D(450, 0, 200), 40)));     // Dépasse le bord du mur
+    assert(!buffer.isOccluded(boxAround(Point3D(0, 0, -100), 5)));       // Autour de l'œil
+    assert(!buffer.isOccluded(wall.boundingBox()));                      // Un occulteur ne se masque pas
+    assert(stats.tested == 7 && stats.occluded == 2 && std::fabs(stats.occludedRatio() - 2.0 / 7.0) < 1e-9);
+    std::cout << "check2 (wall occludes boxes behind it only)" << std::endl;
+
+    buffer.begin(EYE, DISTANCE, SCREEN_WIDTH, SCREEN_HEIGHT);
+    assert(buffer.getStats().tested == 0 && !buffer.isOccluded(boxAround(Point3D(0, 0, 200), 20)));
+    std::cout << "check3 (begin resets the frame)" << std::endl;
+}
+
+// Chaque pixel écrit doit être entièrement couvert par le triangle, avec une profondeur au moins aussi lointaine
+void testConservative() {
+    OcclusionBuffer3D buffer(40, 30);
+    uint32_t state = 2024;
+    const float kx = 40 / SCREEN_WIDTH, ky = 30 / SCREEN_HEIGHT;
+    size_t written = 0;
+    for (int trial = 0; trial < 50; ++trial) {
+        buffer.begin(EYE, DISTANCE, SCREEN_WIDTH, SCREEN_HEIGHT);
+        Point3D p[3];
+        for (Point3D& vertex : p) {
+            vertex = Point3D(randomFloat(state, -2000, 2000), randomFloat(state, -1500, 1500), randomFloat(state, 10, 400));
+        }
+        Triangle3D triangle(p[0], p[1], p[2], Couleur(0, 0, 0));
+        buffer.addOccluder(triangle);
+        const Point3D normal = (p[1] - p[0]).crossProduct(p[2] - p[0]);
+        for (int y = 0; y < buffer.getHeight(); ++y) {
+            for (int x = 0; x < buffer.getWidth(); ++x) {
+                const float depth = buffer.depthAt(x, y);
+                if (std::isinf(depth)) {
+                    continue;
+                }
+                ++written;
+                for (int sy = 0; sy <= 4; ++sy) {
+                    for (int sx = 0; sx <= 4; ++sx) {
+                        // Rayon de projection du point du pixel : (dx, dy) = (u, v) * w, dz = w - d
+                        const float u = (x + sx / 4.0f - 20.0f) / (kx * DISTANCE);
+                        const float v = (y + sy / 4.0f - 15.0f) / (ky * DISTANCE);
+                        const Point3D origin = EYE - Point3D(0, 0, DISTANCE);
+                        const float w = normal.dotProduct(p[0] - origin) / normal.dotProduct(Point3D(u, v, 1));
+                        const Point3D hit = origin + Point3D(u, v, 1) * w;
+                        // Le point du plan est dans le triangle (coordonnées barycentriques positives)
+                        const Point3D c0 = (p[1] - p[0]).crossProduct(hit - p[0]);
+                        const Point3D c1 = (p[2] - p[1]).crossProduct(hit - p[1]);
+                        const Point3D c2 = (p[0] - p[2]).crossProduct(hit - p[2]);
+                        const float tolerance = 1e-3f * normal.dotProduct(normal);
+                        assert(c0.dotProduct(normal) >= -tolerance && c1.dotProduct(normal) >= -tolerance &&
+                               c2.dotProduct(normal) >= -tolerance);
+                        assert(w <= depth * (1.0f + 1e-4f));
+                    }
+                }
+            }
+        }
+    }
+    assert(written > 100);
+    std::cout << "check4 (" << written << " written pixels are covered and conservative)" << std::endl;
+}
+
+int main() {
+    testValidation();
+    testWall();
+    testConservative();
+    std::cout << "All occlusion buffer tests passed!" << std::endl;
+    return 0;
+}
@@ -85,6 +85,34 @@ void testPave3D() {
     assert(pave3.equals(pave2) == true);
     std::cout << "check8" << std::endl;
 
+    // Test des grandeurs mises en cache : propres à chaque pavé
+    Pave3D small(Point3D(0, 0, 0), 1, 1, 1, Couleur(255, 0, 0));
+    Pave3D large(Point3D(0, 0, 0), 2, 3, 4, Couleur(255, 0, 0));
+    assert(std::abs(small.surfaceArea() - 6.0f) < 1e-4f);
+    assert(std::abs(large.surfaceArea() - 52.0f) < 1e-4f);
+    assert(std::abs(large.volume() - 24.0f) < 1e-4f);
+    std::cout << "check9 (per-instance area)" << std::endl;
+
+    // Centre, boîte et sphère englobantes suivent la rotation et la translation
+    assert(large.center() == Point3D(1, 1.5f, 2));
+    large.rotate(static_cast<float>(M_PI) / 2, 'z', Point3D(0, 0, 0));
+    large.translate(Point3D(10, 0, 0));
+    Point3D center = large.center();
+    assert(std::abs(center.getX() - 8.5f) < 1e-4f && std::abs(center.getY() - 1.0f) < 1e-4f);
+    BoundingBox3D box = large.boundingBox();
+    assert(std::abs(box.getMin().getX() - 7.0f) < 1e-4f && std::abs(box.getMax().getY() - 2.0f) < 1e-4f);
+    BoundingSphere3D sphere = large.boundingSphere();
+    for (const auto& face : large.getFaces()) {
+        assert(sphere.getCenter().distance(face.getFirstTriangle().getP2()) <= sphere.getRadius() + 1e-4f);
+    }
+    assert(std::abs(large.surfaceArea() - 52.0f) < 1e-4f);
+    std::cout << "check10 (bounds after rotation)" << std::endl;
+
+    // Modifier une face invalide le cache
+    large.getFace(0).translate(Point3D(0, 0, -1));
+    assert(large.boundingBox().getMin().getZ() < -0.5f);
+    std::cout << "check11 (cache invalidation)" << std::endl;
+
     std::cout << pave1 << std::endl;
     std::cout << "All Pave3D tests passed!" << std::endl;
 }
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <iostream>
+#include <string>
 #include "../quad3d.h"
 
 void testQuad3D() {
@@ -101,6 +102,30 @@ void testQuad3D() {
 
     std::cout << "check12 (orient test passed)" << std::endl;
 
+    // Fabrique validante sans exception
+    Quad3D created;
+    GeometryError error = Quad3D::tryCreate(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0),
+                                            Couleur(0, 0, 255), created);
+    assert(error == GeometryError::None);
+    assert(created == Quad3D(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), Couleur(0, 0, 255)));
+    Quad3D untouched = created;
+    error = Quad3D::tryCreate(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(2, 0, 0), Point3D(0, 1, 0), Couleur(0, 0, 255), created);
+    assert(error == GeometryError::CollinearPoints);
+    assert(created == untouched);
+    assert(std::string(errorMessage(error)) == "Les trois sommets ne doivent pas être alignés.");
+    error = Quad3D::tryCreate(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), -1, 0, 0, created);
+    assert(error == GeometryError::InvalidColor && created == untouched);
+    assert(std::string(errorMessage(error)) == "La valeur de la composante RVB doit être entre 0 et 255.");
+    error = Quad3D::tryCreate(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), 10, 20, 30, created);
+    assert(error == GeometryError::None && created.getFirstTriangle().getColor() == Couleur(10, 20, 30));
+    std::cout << "check13 (tryCreate)" << std::endl;
+
+    // Chemin non vérifié : même résultat que le constructeur validant, couleur comprise
+    Quad3D trusted(UNCHECKED, Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), Couleur(UNCHECKED, 0, 0, 255));
+    assert(trusted == untouched && trusted.getColor() == Couleur(0, 0, 255));
+    assert(Couleur::isValid(0, 128, 255) && !Couleur::isValid(0, 256, 0));
+    std::cout << "check14 (unchecked construction)" << std::endl;
+
     std::cout << quad1 << std::endl;
     std::cout << "All Quad3D tests passed!" << std::endl;
 }
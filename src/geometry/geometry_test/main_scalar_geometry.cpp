@@ -0,0 +1,82 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include "../point3d.h"
+#include "../quad3d.h"
+#include "../transform3d.h"
+#include "../triangle3d.h"
+
+void testScalarGeometry() {
+    // Tolérances au-dessus de l'epsilon de chaque type : les triangles presque plats sont détectés
+    static_assert(ScalarTraits<float>::tolerance > 1.2e-7f, "tolérance float sous l'epsilon");
+    static_assert(ScalarTraits<double>::tolerance > 2.3e-16, "tolérance double sous l'epsilon");
+    Point3D a(0, 0, 0), b(1, 0, 0), sliver(0.5f, 1e-7f, 0);
+    assert(Point3D::areCollinear(a, b, sliver));
+    assert(Triangle3D::validate(a, b, sliver) == GeometryError::CollinearPoints);
+    assert(Triangle3D(UNCHECKED, a, b, sliver, Couleur()).isDegenerate());
+    assert(Point3D(1, 2, 3) == Point3D(1, 2, 3 + 1e-7f));
+    assert(!Point3Dd::areCollinear(Point3Dd(0, 0, 0), Point3Dd(1, 0, 0), Point3Dd(0.5, 1e-7, 0)));
+    std::cout << "check1 (per-type tolerances)" << std::endl;
+
+    // Test relatif : un petit triangle valide est accepté, un grand triangle presque plat est refusé
+    Triangle3D tiny(Point3D(0, 0, 0), Point3D(5e-4f, 0, 0), Point3D(0, 5e-4f, 0), Couleur(255, 0, 0));
+    assert(!tiny.isDegenerate() && std::abs(tiny.area() - 1.25e-7f) < 1e-10f);
+    assert(Triangle3Dd::validate(Point3Dd(0, 0, 0), Point3Dd(1e-6, 0, 0), Point3Dd(0, 1e-6, 0)) == GeometryError::None);
+    const Point3D wide1(0, 0, 0), wide2(1000, 0, 0), wide3(2000, 1e-4f, 0);
+    assert(Point3D::areCollinear(wide1, wide2, wide3));
+    assert(Triangle3D::validate(wide1, wide2, wide3) == GeometryError::CollinearPoints);
+    assert(Triangle3D(UNCHECKED, wide1, wide2, wide3, Couleur()).isDegenerate());
+    assert(Point3Dd::areCollinear(Point3Dd(0, 0, 0), Point3Dd(1000, 0, 0), Point3Dd(2000, 1e-13, 0)));
+    assert(!Point3D::areCollinear(wide1, wide2, Point3D(2000, 10, 0)));
+    std::cout << "check2 (scale-independent collinearity)" << std::endl;
+
+    // Grand monde : à 1e8 unités de l'origine, float ne distingue plus des sommets distants de 0,1
+    const double far = 1e8;
+    Point3Dd p1(far, far, 0), p2(far + 0.1, far, 0), p3(far, far + 0.1, 0);
+    assert(pointCast<float>(p1) == pointCast<float>(p2));
+    Triangle3Dd world(p1, p2, p3, Couleur(0, 200, 0));
+    assert(std::abs(world.area() - 0.005) < 1e-8);
+    assert(!world.isDegenerate());
+    std::cout << "check3 (double keeps large-world precision)" << std::endl;
+
+    // Rendu : sommets relatifs à la caméra, en float, sans perte
+    Point3Dd eye(far, far, -10);
+    Triangle3D relative = world.cameraRelative(eye);
+    assert(!relative.isDegenerate());
+    assert(std::abs(relative.getP2().getX() - 0.1f) < 1e-6f && std::abs(relative.getP1().getZ() - 10.0f) < 1e-6f);
+    assert(std::abs(relative.area() - 0.005f) < 1e-6f);
+    assert(relative.getColor().getVert() == 200);
+    assert(relative.getUnitNormal() == pointCast<float>(world.getUnitNormal()));
+    std::cout << "check4 (camera-relative triangle)" << std::endl;
+
+    // Quadrilatères et transformations en double
+    Quad3Dd quad(p1, p2, Point3Dd(far + 0.1, far + 0.1, 0), p3, Couleur(0, 0, 255));
+    assert(std::abs(quad.surface() - 0.01) < 1e-8);
+    Quad3D relativeQuad = quad.cameraRelative(eye);
+    assert(std::abs(relativeQuad.surface() - 0.01f) < 1e-6f && relativeQuad.getColor().getBleu() == 255);
+    assert(relativeQuad.center() == Point3D(0.05f, 0.05f, 10.0f));
+
+    Transform3Dd model = Transform3Dd::rotation(static_cast<float>(M_PI / 2), 'z').then(Transform3Dd::translation(p1));
+    Point3Dd local(0.25, 0, 0);
+    Point3Dd placed = model.apply(local);
+    assert(std::abs(placed.getX() - far) < 1e-6 && std::abs(placed.getY() - (far + 0.25)) < 1e-6);
+    Transform3D relativeModel = model.cameraRelative(eye);
+    Point3D rendered = relativeModel.apply(pointCast<float>(local));
+    assert(rendered == cameraRelative(placed, eye));
+    std::cout << "check5 (double quads and camera-relative transforms)" << std::endl;
+
+    // Les types float et double se convertissent dans les deux sens
+    Point3D small(1.5f, -2.25f, 3.0f);
+    assert(pointCast<float>(pointCast<double>(small)) == small);
+    Quad3Dd rotated = quad;
+    rotated.rotate(static_cast<float>(M_PI), 'z', quad.center());
+    assert(rotated.center().distance(quad.center()) < 1e-6);
+    std::cout << "check6 (conversions and double rotations)" << std::endl;
+}
+
+int main() {
+    testScalarGeometry();
+    std::cout << "All scalar geometry tests passed!" << std::endl;
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <cassert>
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
 #include "../sphere3d.h"
 #include "../geometry_utils.h"
 
@@ -72,6 +74,112 @@ void testSphere3D() {
         std::cout << "check9 (out-of-range access)" << std::endl;
     }
 
+    // Test de la tessellation : calottes polaires en éventails, quadrilatères ailleurs
+    Sphere3D tessellated(Point3D(0, 0, 0), 1.0f, 8);
+    const auto& localQuads = tessellated.getLocalQuads();
+    assert(localQuads.size() == (8 - 2) * 8 + 2 * 4);
+    for (const auto& quad : localQuads) {
+        for (const Triangle3D* t : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+            for (const Point3D& p : {t->getP1(), t->getP2(), t->getP3()}) {
+                assert(std::abs(p.distance(Point3D(0, 0, 0)) - 1.0f) < 1e-5f);
+            }
+        }
+    }
+    assert(localQuads.front().getFirstTriangle().getP1() == Point3D(0, 1, 0));
+    assert(localQuads.back().getFirstTriangle().getP1() == Point3D(0, -1, 0));
+    std::cout << "check10 (tessellation)" << std::endl;
+
+    // setCenter et setRadius ne régénèrent pas le maillage
+    auto meshBefore = tessellated.getMesh();
+    tessellated.setCenter(Point3D(2, 0, 0));
+    tessellated.setRadius(3.0f);
+    assert(tessellated.getMesh() == meshBefore);
+    const Point3D& north = tessellated.getQuads().front().getFirstTriangle().getP1();
+    assert(std::abs(north.getX() - 2.0f) < 1e-5f && std::abs(north.getY() - 3.0f) < 1e-5f);
+    std::cout << "check11 (setCenter/setRadius without regeneration)" << std::endl;
+
+    // Test du mode icosphère : 10 * 4^n quadrilatères, triangles de tailles presque uniformes
+    Sphere3D icosphere(Point3D(0, 0, 0), 1.0f, 3, SphereTessellation::Icosphere);
+    assert(icosphere.getTessellation() == SphereTessellation::Icosphere);
+    assert(icosphere.getLocalQuads().size() == 10 * 64);
+    float minArea = 1e9f, maxArea = 0.0f;
+    for (const auto& quad : icosphere.getLocalQuads()) {
+        assert(quad.getFirstTriangle().hasCommonSide(quad.getSecondTriangle()));
+        for (const Triangle3D* t : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+            for (const Point3D& p : {t->getP1(), t->getP2(), t->getP3()}) {
+                assert(std::abs(p.norm() - 1.0f) < 1e-5f);
+            }
+            // Triangles orientés vers l'extérieur
+            assert(t->getNormale().dotProduct(t->getCentroid()) > 0);
+            minArea = std::min(minArea, t->area());
+            maxArea = std::max(maxArea, t->area());
+        }
+    }
+    assert(maxArea / minArea < 1.5f);
+    Sphere3D icosphereCopy = icosphere;
+    assert(icosphereCopy.getTessellation() == SphereTessellation::Icosphere);
+    // Un nombre de subdivisions de sphère UV est refusé pour une icosphère
+    try {
+        Sphere3D tooFine(Point3D(0, 0, 0), 1.0f, 40, SphereTessellation::Icosphere);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        Sphere3D tooFine(Point3D(0, 0, 0), 1.0f, MAX_ICOSPHERE_LEVEL + 1, SphereTessellation::Icosphere);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check12 (icosphere)" << std::endl;
+
+    // Test des niveaux de détail : subdivisions 40, 20, 10 et 5, erreurs croissantes
+    Sphere3D lodSphere(Point3D(0, 0, 0), 100.0f, 40);
+    assert(lodSphere.getLodCount() == 4);
+    assert(lodSphere.getLodQuads(0).size() == lodSphere.getLocalQuads().size());
+    for (int level = 1; level < lodSphere.getLodCount(); ++level) {
+        assert(lodSphere.getLodQuads(level).size() < lodSphere.getLodQuads(level - 1).size());
+        assert(lodSphere.getLodError(level) > lodSphere.getLodError(level - 1));
+    }
+    std::cout << "check13 (levels of detail)" << std::endl;
+
+    // Sélection : l'œil en z = 0, distance du plan de projection 100, erreur maximale 1 pixel.
+    // Distance du point le plus proche pour laquelle l'erreur projetée d'un niveau vaut `pixels`.
+    const float projectionDistance = 100.0f;
+    auto nearestFor = [&](int level, float pixels) {
+        return lodSphere.getLodError(level) * 100.0f * projectionDistance / pixels - projectionDistance;
+    };
+    auto placeAt = [&](float nearest) { lodSphere.setCenter(Point3D(0, 0, nearest + 100.0f)); };
+    const Point3D eye(0, 0, 0);
+
+    placeAt(1.0f);
+    assert(lodSphere.selectLod(eye, projectionDistance) == 0);
+    placeAt(nearestFor(3, 0.5f));
+    assert(lodSphere.selectLod(eye, projectionDistance) == 3);
+    // Plus fin dès que l'erreur dépasse le seuil
+    placeAt(nearestFor(3, 1.1f));
+    assert(lodSphere.selectLod(eye, projectionDistance) == 2);
+    // Hystérésis : le niveau 3 repasse sous le seuil mais pas sous 0.75 pixel, on reste au niveau 2
+    placeAt(nearestFor(3, 0.9f));
+    assert(lodSphere.selectLod(eye, projectionDistance) == 2);
+    placeAt(nearestFor(3, 0.7f));
+    assert(lodSphere.selectLod(eye, projectionDistance) == 3);
+    assert(lodSphere.getCurrentLod() == 3);
+    std::cout << "check14 (level of detail selection)" << std::endl;
+
+    // Orienter vers l'œil ne fait que retourner des triangles : les bandes restent, et un maillage
+    // déjà orienté reste partagé avec les copies
+    Sphere3D oriented(Point3D(0, 0, 200), 50.0f, 16);
+    const StripMesh3D* strips = &oriented.getLodStrips(0);
+    const size_t stripTriangles = strips->getTriangleCount();
+    oriented.orient(Point3D(0, 0, 0));
+    assert(&oriented.getLodStrips(0) == strips);
+    Sphere3D orientedCopy(oriented);
+    orientedCopy.orient(Point3D(0, 0, 0));
+    assert(orientedCopy.getMesh() == oriented.getMesh() && &orientedCopy.getLodStrips(0) == strips);
+    orientedCopy.orient(Point3D(0, 300, 100));
+    assert(orientedCopy.getMesh() != oriented.getMesh() && &orientedCopy.getLodStrips(0) == strips);
+    assert(orientedCopy.getLodStrips(0).getTriangleCount() == stripTriangles);
+    std::cout << "check15 (orient keeps the strips and the shared mesh)" << std::endl;
+
     std::cout << "All Sphere3D tests passed!" << std::endl;
 }
 
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../strip_mesh3d.h"
+#include "../sphere3d.h"
+#include "../vertex_welder.h"
+
+// Triangles d'un maillage, chacun ramené à la rotation commençant par son plus petit indice (l'orientation est conservée)
+std::vector<std::array<int, 4>> canonicalTriangles(const Mesh3D& mesh) {
+    std::vector<std::array<int, 4>> result;
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        std::array<int, 3> f = {int(indices[3 * t]), int(indices[3 * t + 1]), int(indices[3 * t + 2])};
+        std::rotate(f.begin(), std::min_element(f.begin(), f.end()), f.end());
+        result.push_back({f[0], f[1], f[2], mesh.getFaceColor(t).getVert()});
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+size_t countPrimitives(const StripMesh3D& strips, PrimitiveType type) {
+    const auto& primitives = strips.getPrimitives();
+    return std::count_if(primitives.begin(), primitives.end(), [type](const TrianglePrimitive& p) { return p.type == type; });
+}
+
+void testStripMesh3D() {
+    // Sphère UV : chaque triangle apparaît une seule fois, même orientation, même couleur
+    Sphere3D sphere(Point3D(), 1.0f, 24);
+    WeldReport report;
+    Mesh3D welded = VertexWelder::weld(sphere.getLocalQuads(), report);
+    StripMesh3D strips = StripMesh3D::build(welded);
+    assert(strips.getTriangleCount() == welded.getTriangleCount());
+    assert(canonicalTriangles(strips.toMesh()) == canonicalTriangles(welded));
+    std::cout << "check1 (sphere strips cover every triangle once, " << strips.getPrimitives().size() << " primitives)" << std::endl;
+
+    // Un indice par triangle plus deux par primitive, au lieu de trois par triangle
+    size_t primitiveCount = strips.getPrimitives().size();
+    assert(strips.getIndices().size() == strips.getTriangleCount() + 2 * primitiveCount);
+    assert(strips.getIndices().size() < welded.getIndices().size() / 2);
+    assert(countPrimitives(strips, PrimitiveType::Fan) >= 2);
+    std::cout << "check2 (" << strips.getIndices().size() << " indices instead of " << welded.getIndices().size()
+              << ", fans at the poles)" << std::endl;
+
+    // Longueur maximale respectée
+    StripMesh3D shortStrips = StripMesh3D::build(welded, 4);
+    for (const TrianglePrimitive& primitive : shortStrips.getPrimitives()) {
+        assert(primitive.count >= 3 && primitive.count - 2 <= 4);
+    }
+    assert(canonicalTriangles(shortStrips.toMesh()) == canonicalTriangles(welded));
+    std::cout << "check3 (maximum length respected)" << std::endl;
+
+    // Listes de triangles quelconques : tore et grille, couleurs par face conservées
+    Mesh3D torus = Mesh3D::torus(2.0f, 0.5f, 16, 8, Couleur(0, 200, 0));
+    for (size_t t = 0; t < torus.getTriangleCount(); t += 3) {
+        torus.setFaceColor(t, Couleur(0, 50, 0));
+    }
+    Mesh3D grid = Mesh3D::planeGrid(4.0f, 4.0f, 8, 8, Couleur(0, 100, 0));
+    for (const Mesh3D* mesh : {&torus, &grid}) {
+        StripMesh3D meshStrips = StripMesh3D::build(*mesh);
+        assert(canonicalTriangles(meshStrips.toMesh()) == canonicalTriangles(*mesh));
+        assert(meshStrips.getPrimitives().size() * 4 < mesh->getTriangleCount());
+    }
+    std::cout << "check4 (torus and grid stripified)" << std::endl;
+
+    // Sommets partagés seulement à l'intérieur de chaque quadrilatère : une bande par quadrilatère ; longueur nulle refusée
+    Mesh3D soup = Mesh3D::fromQuads(sphere.getLocalQuads());
+    StripMesh3D isolated = StripMesh3D::build(soup);
+    assert(isolated.getPrimitives().size() == sphere.getLocalQuads().size());
+    try {
+        StripMesh3D::build(welded, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    assert(StripMesh3D::build(Mesh3D()).getTriangleCount() == 0);
+    std::cout << "check5 (unwelded quads and invalid length)" << std::endl;
+
+    // Bandes des niveaux de détail de Sphere3D : construites une fois, reconstruites après modification
+    const StripMesh3D* cached = &sphere.getLodStrips(0);
+    assert(&sphere.getLodStrips(0) == cached);
+    assert(sphere.getLodStrips(0).getTriangleCount() == welded.getTriangleCount());
+    for (int level = 1; level < sphere.getLodCount(); ++level) {
+        assert(sphere.getLodStrips(level).getTriangleCount() < sphere.getLodStrips(level - 1).getTriangleCount());
+    }
+    try {
+        sphere.getLodStrips(sphere.getLodCount());
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    Sphere3D copy(sphere);
+    assert(&copy.getLodStrips(0) == cached);
+    sphere.setQuadColor(0, Couleur(0, 7, 0));
+    assert(&sphere.getLodStrips(0) != cached && &copy.getLodStrips(0) == cached);
+    const std::vector<Couleur>& colors = sphere.getLodStrips(0).getFaceColors();
+    assert(std::count_if(colors.begin(), colors.end(), [](const Couleur& c) { return c.getVert() == 7; }) == 2);
+    std::cout << "check6 (Sphere3D level-of-detail strips cached)" << std::endl;
+}
+
+int main() {
+    testStripMesh3D();
+    std::cout << "All StripMesh3D tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../thread_pool.h"
+#include "../vertex_buffer3d.h"
+#include "../transform3d.h"
+#include "../sphere3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+void testThreadPool() {
+    // Chaque indice est traité exactement une fois, quel que soit le nombre de threads
+    for (std::size_t threads : {1u, 2u, 4u, 7u}) {
+        ThreadPool pool(threads);
+        assert(pool.getThreadCount() == threads);
+        std::vector<std::atomic<int>> visits(100003);
+        for (int round = 0; round < 3; ++round) {
+            pool.parallelFor(visits.size(), 1000, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    ++visits[i];
+                }
+            });
+        }
+        for (const auto& v : visits) {
+            assert(v == 3);
+        }
+    }
+    std::cout << "check1 (every index visited once per loop)" << std::endl;
+
+    // Boucle imbriquée : exécutée séquentiellement dans le bloc, sans blocage
+    ThreadPool pool(4);
+    std::atomic<int> total{0};
+    pool.parallelFor(64, 8, [&](std::size_t begin, std::size_t end) {
+        pool.parallelFor(end - begin, 2, [&](std::size_t b, std::size_t e) { total += static_cast<int>(e - b); });
+    });
+    assert(total == 64);
+    std::cout << "check2 (nested loop)" << std::endl;
+
+    // Taille de bloc nulle
+    try {
+        pool.parallelFor(10, 0, [](std::size_t, std::size_t) {});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "check3 (invalid chunk size)" << std::endl;
+    }
+
+    // Exception levée par un bloc, sur un thread de la réserve ou sur l'appelant : toujours relancée
+    // une fois tous les blocs terminés, et la réserve reste parallèle ensuite
+    for (std::size_t failing : {0u, 37u, 99u}) {
+        std::atomic<int> running{0};
+        try {
+            pool.parallelFor(100, 1, [&](std::size_t begin, std::size_t) {
+                ++running;
+                if (begin == failing) {
+                    --running;
+                    throw std::runtime_error("bloc " + std::to_string(begin));
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                --running;
+            });
+            assert(false);
+        } catch (const std::runtime_error& e) {
+            assert(std::string(e.what()) == "bloc " + std::to_string(failing));
+        }
+        assert(running == 0);
+    }
+    std::atomic<int> otherThreads{0};
+    const std::thread::id caller = std::this_thread::get_id();
+    pool.parallelFor(64, 1, [&](std::size_t, std::size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        if (std::this_thread::get_id() != caller) {
+            ++otherThreads;
+        }
+    });
+    assert(otherThreads > 0);
+    std::cout << "check4 (exceptions are rethrown after every chunk finished)" << std::endl;
+
+    // Transformation d'un million de sommets : identique au bit près au calcul séquentiel par morceaux
+    const std::size_t count = 1 << 20;
+    const std::size_t piece = 50000; // Sous le seuil parallèle, multiple de 8
+    VertexBuffer3D buffer(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        buffer.set(i, Point3D(std::sin(i * 0.001f) * 50, std::cos(i * 0.003f) * 20, i * 0.0001f));
+    }
+    std::vector<VertexBuffer3D> pieces;
+    for (std::size_t first = 0; first < count; first += piece) {
+        VertexBuffer3D part;
+        for (std::size_t i = first; i < std::min(first + piece, count); ++i) {
+            part.push_back(buffer.get(i));
+        }
+        pieces.push_back(part);
+    }
+
+    Transform3D rotation = Transform3D::rotation(0.7f, 'y', Point3D(1, 2, 3));
+    auto start = std::chrono::steady_clock::now();
+    rotation.apply(buffer);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    for (std::size_t p = 0; p < pieces.size(); ++p) {
+        rotation.apply(pieces[p]);
+        const std::size_t first = p * piece;
+        assert(std::memcmp(pieces[p].x(), buffer.x() + first, pieces[p].size() * sizeof(float)) == 0);
+        assert(std::memcmp(pieces[p].y(), buffer.y() + first, pieces[p].size() * sizeof(float)) == 0);
+        assert(std::memcmp(pieces[p].z(), buffer.z() + first, pieces[p].size() * sizeof(float)) == 0);
+    }
+    std::cout << "check5 (deterministic parallel transform, 1M vertices in " << ms << " ms on "
+              << ThreadPool::shared().getThreadCount() << " threads)" << std::endl;
+
+    // Sphère au-delà du seuil : même résultat que la transformation quadrilatère par quadrilatère
+    Sphere3D sphere(Point3D(0, 0, 0), 1.0f, 300);
+    std::vector<Quad3D> expected = sphere.getLocalQuads();
+    Transform3D scaling = Transform3D::scaling(1.5f, Point3D(0.5f, 0, 0));
+    sphere.transform(scaling);
+    for (auto& quad : expected) {
+        quad.transform(scaling);
+    }
+    for (std::size_t i = 0; i < expected.size(); i += 97) {
+        const Triangle3D& a = sphere.getLocalQuads()[i].getFirstTriangle();
+        const Triangle3D& b = expected[i].getFirstTriangle();
+        assert(approxEqual(a.getP2(), b.getP2()) && approxEqual(a.getUnitNormal(), b.getUnitNormal()));
+    }
+    std::cout << "check6 (parallel Sphere3D::transform)" << std::endl;
+
+    std::cout << "All ThreadPool tests passed!" << std::endl;
+}
+
+int main() {
+    testThreadPool();
+    return 0;
+}
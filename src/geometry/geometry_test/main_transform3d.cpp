@@ -0,0 +1,106 @@
+#include <cassert>
+#include <iostream>
+#include "../transform3d.h"
+#include "../quaternion.h"
+#include "../vertex_buffer3d.h"
+#include "../sphere3d.h"
+#include "../triangle3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+void testTransform3D() {
+    Point3D p(1, 2, 3);
+    Point3D center(-1, 0.5f, 2);
+
+    // Identité
+    Transform3D identity;
+    assert(identity.apply(p) == p);
+    std::cout << "check1 (identity)" << std::endl;
+
+    // Translation et mise à l'échelle
+    assert(approxEqual(Transform3D::translation(Point3D(1, 1, 1)).apply(p), Point3D(2, 3, 4)));
+    assert(approxEqual(Transform3D::scaling(2.0f, center).apply(p), center + (p - center) * 2.0f));
+    std::cout << "check2 (translation/scaling)" << std::endl;
+
+    // Rotation autour d'un axe principal : même résultat que Point3D::rotate
+    const char axes[] = {'x', 'y', 'z'};
+    for (char axis : axes) {
+        Point3D expected = p;
+        expected.rotate(0.8f, axis, center);
+        assert(approxEqual(Transform3D::rotation(0.8f, axis, center).apply(p), expected));
+    }
+    std::cout << "check3 (axis rotation)" << std::endl;
+
+    // Rotation autour d'un axe quelconque : un axe principal donne le même résultat
+    for (char axis : axes) {
+        Point3D direction(axis == 'x', axis == 'y', axis == 'z');
+        assert(approxEqual(Transform3D::rotation(0.8f, direction * 5.0f, center).apply(p),
+                           Transform3D::rotation(0.8f, axis, center).apply(p)));
+    }
+    // Un tiers de tour autour de la diagonale permute les axes
+    Transform3D diagonal = Transform3D::rotation(2.0f * static_cast<float>(M_PI) / 3.0f, Point3D(1, 1, 1));
+    assert(approxEqual(diagonal.apply(Point3D(1, 0, 0)), Point3D(0, 1, 0)));
+    std::cout << "check4 (arbitrary axis rotation)" << std::endl;
+
+    // Quaternions : composition et rotation d'un vecteur
+    Quaternion qx = Quaternion::fromAxisAngle('x', 0.4f);
+    Quaternion qy = Quaternion::fromAxisAngle('y', -1.1f);
+    Quaternion q = qy * qx;
+    assert(std::fabs(q.norm() - 1.0f) < 1e-5f);
+    assert(approxEqual(q.rotate(p), qy.rotate(qx.rotate(p))));
+    assert(approxEqual(q.conjugate().rotate(q.rotate(p)), p));
+    assert(approxEqual(Transform3D::rotation(q).apply(p), q.rotate(p)));
+    std::cout << "check5 (quaternion)" << std::endl;
+
+    // Composition : plusieurs opérations en une seule matrice
+    Transform3D composed = Transform3D::rotation(0.3f, 'x', center)
+                               .then(Transform3D::scaling(1.5f))
+                               .then(Transform3D::translation(Point3D(4, 5, 6)));
+    Point3D stepByStep = Transform3D::translation(Point3D(4, 5, 6)).apply(
+        Transform3D::scaling(1.5f).apply(Transform3D::rotation(0.3f, 'x', center).apply(p)));
+    assert(approxEqual(composed.apply(p), stepByStep));
+    std::cout << "check6 (composition)" << std::endl;
+
+    // Application à un conteneur SoA
+    VertexBuffer3D buffer;
+    for (int i = 0; i < 13; ++i) {
+        buffer.push_back(Point3D(i, -i, i * 0.5f));
+    }
+    composed.apply(buffer);
+    for (int i = 0; i < 13; ++i) {
+        assert(approxEqual(buffer.get(i), composed.apply(Point3D(i, -i, i * 0.5f))));
+    }
+    std::cout << "check7 (vertex buffer)" << std::endl;
+
+    // Application à un maillage entier
+    Sphere3D sphere(Point3D(0, 0, 0), 2.0f, 8);
+    Sphere3D expected = sphere;
+    sphere.transform(composed);
+    const Triangle3D& a = sphere.getQuads()[5].getFirstTriangle();
+    const Triangle3D& b = expected.getQuads()[5].getFirstTriangle();
+    assert(approxEqual(a.getP2(), composed.apply(b.getP2())));
+    std::cout << "check8 (mesh transform)" << std::endl;
+
+    // Axe invalide ou nul
+    try {
+        Transform3D::rotation(0.1f, 'w');
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    try {
+        Transform3D::rotation(0.1f, Point3D(0, 0, 0));
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "check9 (invalid axis)" << std::endl;
+    }
+
+    std::cout << "All Transform3D tests passed!" << std::endl;
+}
+
+int main() {
+    testTransform3D();
+    return 0;
+}
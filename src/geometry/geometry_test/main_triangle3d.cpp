@@ -136,6 +136,40 @@ void testTriangle3D() {
 
     std::cout << "check14 testSwapVertices passed!" << std::endl;
 
+    // Normale unitaire et centroïde stockés, tenus à jour par les modifications
+    Triangle3D stored(p1, p2, p3, Couleur(255, 0, 0));
+    assert(stored.getUnitNormal() == Point3D(0, 0, 1));
+    assert(stored.getCentroid() == Point3D(1, 4.0f / 3.0f, 0));
+    stored.translate(Point3D(1, 2, 3));
+    assert(stored.getCentroid() == Point3D(2, 4.0f / 3.0f + 2, 3));
+    stored.swapVertices(2, 3);
+    assert(stored.getUnitNormal() == Point3D(0, 0, -1));
+    stored.orient(Point3D(0, 0, 10));
+    assert(stored.getUnitNormal() == Point3D(0, 0, 1));
+    stored.setP3(Point3D(1, 2, 7));
+    assert(stored.getUnitNormal() == Point3D(0, -1, 0));
+    assert(stored.getCentroid() == Point3D(2, 2, 13.0f / 3.0f));
+    std::cout << "check15 (stored normal and centroid)" << std::endl;
+
+    // Triangle dégénéré (construction non vérifiée) : normale unitaire nulle, sans affichage
+    Triangle3D flat(UNCHECKED, p1, p2, Point3D(6, 0, 0), Couleur(255, 0, 0));
+    assert(flat.getUnitNormal() == Point3D(0, 0, 0));
+    std::cout << "check16 (degenerate normal)" << std::endl;
+
+    // Fabrique validante sans exception
+    Triangle3D created;
+    assert(Triangle3D::tryCreate(p1, p2, p3, Couleur(255, 0, 0), created) == GeometryError::None);
+    assert(created.equals(Triangle3D(p1, p2, p3, Couleur(255, 0, 0))));
+    assert(created.getUnitNormal() == Point3D(0, 0, 1));
+    assert(Triangle3D::tryCreate(p1, p2, Point3D(6, 0, 0), Couleur(255, 0, 0), created) == GeometryError::CollinearPoints);
+    assert(created.equals(Triangle3D(p1, p2, p3, Couleur(255, 0, 0))));
+    // Composantes brutes : une couleur invalide est signalée sans exception
+    assert(Triangle3D::tryCreate(p1, p2, p3, 0, 300, 0, created) == GeometryError::InvalidColor);
+    assert(created.getColor() == Couleur(255, 0, 0));
+    assert(Triangle3D::tryCreate(p1, p2, p3, 0, 128, 0, created) == GeometryError::None);
+    assert(created.getColor() == Couleur(0, 128, 0));
+    std::cout << "check17 (tryCreate)" << std::endl;
+
     // Test de l'opérateur de flux
     std::cout << triangle1 << std::endl;
 
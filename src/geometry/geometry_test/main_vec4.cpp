@@ -0,0 +1,67 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include "../vec4.h"
+#include "../point3d.h"
+
+bool approxEqual(float a, float b, float eps = 1e-5f) {
+    return std::fabs(a - b) < eps;
+}
+
+void testVec4() {
+    Vec4 a(1, 2, 3);
+    Vec4 b(-4, 5, 0.5f);
+
+    // Alignement sur 16 octets, y compris dans Point3D
+    Point3D points[3];
+    assert(alignof(Vec4) == 16 && alignof(Point3D) == 16);
+    assert(reinterpret_cast<std::uintptr_t>(&points[1]) % 16 == 0);
+    std::cout << "check1 (alignment)" << std::endl;
+
+    // Opérations de base, w reste nul
+    Vec4 sum = a + b * 2.0f - Vec4(1, 1, 1);
+    assert(sum.x() == -8 && sum.y() == 11 && sum.z() == 3 && sum.w() == 0);
+    std::cout << "check2 (add, sub, scale)" << std::endl;
+
+    // Produits scalaire, vectoriel et mixte
+    assert(approxEqual(Vec4::dot(a, b), -4 + 10 + 1.5f));
+    Vec4 c = Vec4::cross(a, b);
+    assert(approxEqual(c.x(), 2 * 0.5f - 3 * 5) && approxEqual(c.y(), 3 * -4 - 1 * 0.5f) &&
+           approxEqual(c.z(), 1 * 5 - 2 * -4) && c.w() == 0);
+    Vec4 d(0.3f, -1, 2);
+    assert(approxEqual(Vec4::crossDot(a, b, d), Vec4::dot(c, d), 1e-4f));
+    std::cout << "check3 (dot, cross, crossDot)" << std::endl;
+
+    // Normalisation, vecteur nul conservé
+    Vec4 unit = Vec4(3, 0, 4).normalized();
+    assert(approxEqual(unit.x(), 0.6f) && approxEqual(unit.z(), 0.8f) && approxEqual(unit.length(), 1.0f));
+    Vec4 zero = Vec4().normalized();
+    assert(zero.x() == 0 && zero.y() == 0 && zero.z() == 0);
+    std::cout << "check4 (normalized)" << std::endl;
+
+    // Min/max composante par composante, et par lots sur des Point3D
+    Vec4 low = Vec4::min(a, b);
+    Vec4 high = Vec4::max(a, b);
+    assert(low.x() == -4 && low.y() == 2 && low.z() == 0.5f);
+    assert(high.x() == 1 && high.y() == 5 && high.z() == 3);
+    points[0] = Point3D(1, -2, 3);
+    points[1] = Point3D(-5, 4, 0);
+    points[2] = Point3D(2, 1, -7);
+    Point3D lower = points[0];
+    Point3D upper = points[0];
+    Point3D::minMax(points, 3, lower, upper);
+    assert(lower == Point3D(-5, -2, -7) && upper == Point3D(2, 4, 3));
+    std::cout << "check5 (min, max, minMax)" << std::endl;
+
+    // Comparaison à tolérance près
+    assert(Vec4::nearlyEqual(a, Vec4(1, 2, 3.0001f), 1e-3f));
+    assert(!Vec4::nearlyEqual(a, Vec4(1, 2, 3.01f), 1e-3f));
+    std::cout << "check6 (nearlyEqual)" << std::endl;
+
+    std::cout << "All Vec4 tests passed!" << std::endl;
+}
+
+int main() {
+    testVec4();
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include "../vertex_buffer3d.h"
+#include "../sphere3d.h"
+#include "../pave3d.h"
+
+bool approxEqual(const Point3D& a, const Point3D& b, float eps = 1e-4f) {
+    return std::fabs(a.getX() - b.getX()) < eps &&
+           std::fabs(a.getY() - b.getY()) < eps &&
+           std::fabs(a.getZ() - b.getZ()) < eps;
+}
+
+void testVertexBuffer3D() {
+    // Un nombre de sommets non multiple de 8 pour tester la boucle de fin
+    const size_t count = 21;
+    VertexBuffer3D buffer;
+    std::vector<Point3D> reference;
+    for (size_t i = 0; i < count; ++i) {
+        Point3D p(i * 1.5f, -static_cast<float>(i), 2.0f + i * 0.25f);
+        buffer.push_back(p);
+        reference.push_back(p);
+    }
+    assert(buffer.size() == count);
+    assert(buffer.get(3) == reference[3]);
+    std::cout << "check1 (push_back/get)" << std::endl;
+
+    // Alignement des tableaux
+    assert(reinterpret_cast<std::uintptr_t>(buffer.x()) % VertexBuffer3D::ALIGNMENT == 0);
+    assert(reinterpret_cast<std::uintptr_t>(buffer.y()) % VertexBuffer3D::ALIGNMENT == 0);
+    assert(reinterpret_cast<std::uintptr_t>(buffer.z()) % VertexBuffer3D::ALIGNMENT == 0);
+    std::cout << "check2 (alignment)" << std::endl;
+
+    // Translation
+    Point3D offset(1, 2, 3);
+    buffer.translate(offset);
+    for (size_t i = 0; i < count; ++i) {
+        reference[i] = reference[i] + offset;
+        assert(approxEqual(buffer.get(i), reference[i]));
+    }
+    std::cout << "check3 (translate)" << std::endl;
+
+    // Rotation : même résultat que Point3D::rotate
+    Point3D center(0.5f, -1, 2);
+    const char axes[] = {'x', 'y', 'z'};
+    for (char axis : axes) {
+        buffer.rotate(0.3f, axis, center);
+        for (size_t i = 0; i < count; ++i) {
+            reference[i].rotate(0.3f, axis, center);
+            assert(approxEqual(buffer.get(i), reference[i]));
+        }
+    }
+    std::cout << "check4 (rotate)" << std::endl;
+
+    // Mise à l'échelle
+    buffer.scale(2.0f, center);
+    for (size_t i = 0; i < count; ++i) {
+        reference[i] = center + (reference[i] - center) * 2.0f;
+        assert(approxEqual(buffer.get(i), reference[i]));
+    }
+    std::cout << "check5 (scale)" << std::endl;
+
+    // Matrice 3x4 : permutation des axes plus translation
+    const float matrix[12] = {0, 1, 0, 10,
+                              0, 0, 1, 20,
+                              1, 0, 0, 30};
+    buffer.transform(matrix);
+    for (size_t i = 0; i < count; ++i) {
+        const Point3D& p = reference[i];
+        assert(approxEqual(buffer.get(i), Point3D(p.getY() + 10, p.getZ() + 20, p.getX() + 30)));
+    }
+    std::cout << "check6 (matrix transform)" << std::endl;
+
+    // Axe invalide
+    try {
+        buffer.rotate(0.1f, 'w', center);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "check7 (invalid axis)" << std::endl;
+    }
+
+    // Sphere3D::rotate : même résultat que la rotation de chaque quadrilatère
+    Sphere3D sphere(Point3D(0, 0, 0), 1.0f, 6);
+    std::vector<Quad3D> expected = sphere.getQuads();
+    sphere.rotate(0.4f, 'y', Point3D(0, 0, 0));
+    for (auto& quad : expected) {
+        quad.rotate(0.4f, 'y', Point3D(0, 0, 0));
+    }
+    for (size_t i = 0; i < sphere.getQuads().size(); ++i) {
+        const Triangle3D& a = sphere.getQuads()[i].getSecondTriangle();
+        const Triangle3D& b = expected[i].getSecondTriangle();
+        assert(approxEqual(a.getP1(), b.getP1()) && approxEqual(a.getP2(), b.getP2()) && approxEqual(a.getP3(), b.getP3()));
+    }
+    std::cout << "check8 (Sphere3D::rotate)" << std::endl;
+
+    // Pave3D::rotate : même résultat que la rotation de la face
+    Pave3D pave(Point3D(0, 0, 0), 2, 3, 4, Couleur(255, 0, 0));
+    pave.rotate(0.7f, 'z', Point3D(1, 1, 1));
+    Quad3D face = Pave3D(Point3D(0, 0, 0), 2, 3, 4, Couleur(255, 0, 0)).getFace(3);
+    face.rotate(0.7f, 'z', Point3D(1, 1, 1));
+    assert(approxEqual(pave.getFace(3).getFirstTriangle().getP2(), face.getFirstTriangle().getP2()));
+    std::cout << "check9 (Pave3D::rotate)" << std::endl;
+
+    // Normales et centroïdes par lots : identiques au calcul triangle par triangle
+    VertexBuffer3D sphereVertices;
+    for (const auto& quad : sphere.getQuads()) {
+        quad.appendVertices(sphereVertices);
+    }
+    VertexBuffer3D normals, centroids;
+    sphereVertices.computeTriangleData(normals, centroids);
+    assert(normals.size() == sphere.getQuads().size() * 2);
+    for (size_t i = 0; i < sphere.getQuads().size(); ++i) {
+        const Triangle3D& first = sphere.getQuads()[i].getFirstTriangle();
+        const Triangle3D& second = sphere.getQuads()[i].getSecondTriangle();
+        assert(approxEqual(normals.get(2 * i), first.getUnitNormal()));
+        assert(approxEqual(centroids.get(2 * i), first.getCentroid()));
+        assert(approxEqual(normals.get(2 * i + 1), second.getUnitNormal()));
+        assert(approxEqual(centroids.get(2 * i + 1), second.getCentroid()));
+    }
+    std::cout << "check10 (computeTriangleData)" << std::endl;
+
+    std::cout << "All VertexBuffer3D tests passed!" << std::endl;
+}
+
+int main() {
+    testVertexBuffer3D();
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../vertex_welder.h"
+#include "../pave3d.h"
+#include "../sphere3d.h"
+
+// Nombre de positions distinctes par comparaison deux à deux (référence en O(n^2))
+size_t bruteForceDistinct(const std::vector<Point3D>& points, float tolerance) {
+    std::vector<Point3D> distinct;
+    for (const Point3D& p : points) {
+        bool found = false;
+        for (const Point3D& q : distinct) {
+            if (p.distance(q) <= tolerance) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            distinct.push_back(p);
+        }
+    }
+    return distinct.size();
+}
+
+void testVertexWelder() {
+    // Quadrilatères d'une sphère : même nombre de sommets que la comparaison deux à deux
+    Sphere3D sphere(Point3D(), 1.0f, 12);
+    const std::vector<Quad3D>& quads = sphere.getLocalQuads();
+    std::vector<Point3D> soup;
+    for (const Quad3D& quad : quads) {
+        for (const Triangle3D* t : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+            soup.insert(soup.end(), {t->getP1(), t->getP2(), t->getP3()});
+        }
+    }
+    WeldReport report;
+    Mesh3D mesh = VertexWelder::weld(quads, report);
+    assert(report.inputVertices == soup.size());
+    assert(report.outputVertices == bruteForceDistinct(soup, DEFAULT_WELD_TOLERANCE));
+    assert(mesh.getVertexCount() == report.outputVertices);
+    assert(mesh.getTriangleCount() + report.degenerateTriangles == 2 * quads.size());
+    std::cout << "check1 (sphere quads welded, " << report.verticesSaved() << " vertices saved)" << std::endl;
+
+    // Bilan mémoire : positions et indices avant et après
+    assert(report.bytesBefore == soup.size() * sizeof(Point3D));
+    assert(report.bytesAfter == mesh.getVertexCount() * sizeof(Point3D) + 3 * mesh.getTriangleCount() * sizeof(uint32_t));
+    assert(report.bytesSaved() > report.bytesBefore / 2);
+    std::cout << "check2 (memory report, " << report.bytesSaved() << " bytes saved)" << std::endl;
+
+    // Pavé : 8 sommets partagés par 12 triangles, couleurs conservées
+    Pave3D pave(Point3D(0, 0, 0), 1, 2, 3, Couleur(0, 128, 0));
+    std::vector<Quad3D> faces(pave.getMesh()->begin(), pave.getMesh()->end());
+    Mesh3D box = VertexWelder::weld(faces, report);
+    assert(box.getVertexCount() == 8 && box.getTriangleCount() == 12);
+    assert(report.verticesSaved() == 36 - 8 && report.degenerateTriangles == 0);
+    assert(box.getFaceColor(11).getVert() == 128);
+    Mesh3D rewelded = VertexWelder::weld(pave.toMesh(), report);
+    assert(rewelded.getVertexCount() == 8 && report.inputVertices == 24);
+    std::cout << "check3 (box welded to 8 vertices)" << std::endl;
+
+    // Tolérance : écarts minuscules fusionnés, y compris de part et d'autre d'une limite de cellule
+    VertexWelder welder(1e-3f);
+    uint32_t a = welder.insert(Point3D(0.0999999f, 0, 0));
+    assert(welder.insert(Point3D(0.1000001f, 0, 0)) == a);
+    assert(welder.insert(Point3D(0.1f, 0.0005f, -0.0005f)) == a);
+    uint32_t b = welder.insert(Point3D(0.1f, 0.01f, 0));
+    assert(b != a);
+    assert(welder.insert(Point3D(-0.0000001f, 0, 0)) != a);
+    assert(welder.getPositions().size() == 3);
+    std::cout << "check4 (tolerance and cell boundaries)" << std::endl;
+
+    // Soupe de triangles : la fusion fait apparaître les triangles dégénérés
+    std::vector<Triangle3D> triangles = {
+        Triangle3D(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(0, 1, 0), Couleur(1, 2, 3)),
+        Triangle3D(Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), Couleur(4, 5, 6)),
+        Triangle3D(Point3D(0, 0, 0), Point3D(0.5f, 0, 0), Point3D(0, 0.5f, 0), Couleur())
+    };
+    Mesh3D square = VertexWelder::weld(triangles, report, 0.6f);
+    assert(square.getTriangleCount() == 2 && report.degenerateTriangles == 1);
+    assert(square.getVertexCount() == 4);
+    assert(square.getFaceColor(1).getRouge() == 4);
+    bool thrown = false;
+    try { VertexWelder invalid(0.0f); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    std::cout << "check5 (triangle soup and invalid tolerance)" << std::endl;
+}
+
+int main() {
+    testVertexWelder();
+    std::cout << "All VertexWelder tests passed!" << std::endl;
+    return 0;
+}
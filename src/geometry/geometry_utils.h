@@ -1,6 +1,61 @@
 #ifndef GEOMETRY_UTILS_H
 #define GEOMETRY_UTILS_H
 
-constexpr float TOLERANCE = 1e-16;
+/**
+ * @brief Tolérances propres à chaque type de coordonnées.
+ *
+ * La tolérance doit rester au-dessus de l'epsilon machine du type, sinon les tests
+ * d'alignement et de dégénérescence ne détectent jamais rien. Ces tests sont relatifs
+ * (sinus de l'angle entre deux arêtes) : ils ne dépendent pas de l'échelle de la géométrie.
+ */
+template <typename Scalar>
+struct ScalarTraits;
+
+template <>
+struct ScalarTraits<float> {
+    static constexpr float tolerance = 1e-6f; ///< Environ huit fois l'epsilon de float.
+};
+
+template <>
+struct ScalarTraits<double> {
+    static constexpr double tolerance = 1e-12; ///< Environ quatre mille fois l'epsilon de double.
+};
+
+/**
+ * @brief Tolérance du chemin de rendu (coordonnées float).
+ */
+constexpr float TOLERANCE = ScalarTraits<float>::tolerance;
+
+/**
+ * @brief Marqueur des constructeurs sans validation.
+ *
+ * Réservé à la géométrie produite par un générateur (sphère, pavé...), dont la validité
+ * est garantie par construction : les tests d'alignement et de côté commun sont alors omis.
+ */
+struct Unchecked {};
+constexpr Unchecked UNCHECKED{};
+
+/**
+ * @brief Codes d'erreur des fabriques validantes sans exception (tryCreate).
+ */
+enum class GeometryError {
+    None,            ///< Géométrie valide.
+    InvalidColor,    ///< Composante RVB hors de l'intervalle [0, 255].
+    CollinearPoints  ///< Trois sommets alignés.
+};
+
+/**
+ * @brief Message lisible associé à un code d'erreur.
+ * @param error Le code d'erreur.
+ * @return Le message (chaîne statique).
+ */
+inline const char* errorMessage(GeometryError error) noexcept {
+    switch (error) {
+        case GeometryError::None: return "Aucune erreur.";
+        case GeometryError::InvalidColor: return "La valeur de la composante RVB doit être entre 0 et 255.";
+        case GeometryError::CollinearPoints: return "Les trois sommets ne doivent pas être alignés.";
+    }
+    return "Erreur inconnue.";
+}
 
 #endif // GEOMETRY_UTILS_H
\ No newline at end of file
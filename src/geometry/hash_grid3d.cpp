@@ -0,0 +1,165 @@
+#include "hash_grid3d.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+HashGrid3D::HashGrid3D(float cellSize) : cellSize(cellSize), inverseCellSize(0.0f) {
+    if (cellSize <= 0) {
+        throw std::invalid_argument("Le côté des cellules de la grille doit être strictement positif.");
+    }
+    inverseCellSize = 1.0f / cellSize;
+}
+
+// Coordonnée entière bornée : les coordonnées démesurées restent dans les cellules extrêmes
+int32_t HashGrid3D::cellCoordinate(float value) const {
+    constexpr float LIMIT = 1 << 30;
+    return static_cast<int32_t>(std::clamp(std::floor(value * inverseCellSize), -LIMIT, LIMIT));
+}
+
+HashGrid3D::CellKey HashGrid3D::cellOf(const Point3D& point) const {
+    return CellKey{cellCoordinate(point.getX()), cellCoordinate(point.getY()), cellCoordinate(point.getZ())};
+}
+
+void HashGrid3D::attach(uint32_t id, const CellKey& cell) {
+    std::vector<uint32_t>& items = cells[cell];
+    entries[id].cell = cell;
+    entries[id].position = static_cast<uint32_t>(items.size());
+    items.push_back(id);
+}
+
+// Retrait par échange avec le dernier objet de la cellule ; une cellule vidée est supprimée
+void HashGrid3D::detach(uint32_t id) {
+    auto found = cells.find(entries[id].cell);
+    std::vector<uint32_t>& items = found->second;
+    const uint32_t position = entries[id].position;
+    items[position] = items.back();
+    entries[items[position]].position = position;
+    items.pop_back();
+    if (items.empty()) {
+        cells.erase(found);
+    }
+}
+
+// Un objet plus large que deux cellules sur un axe est rangé à part : la marge reste bornée par le côté des cellules
+void HashGrid3D::place(uint32_t id) {
+    Entry& entry = entries[id];
+    const Point3D half = entry.box.halfExtent();
+    entry.oversized = half.getX() > cellSize || half.getY() > cellSize || half.getZ() > cellSize;
+    if (entry.oversized) {
+        entry.position = static_cast<uint32_t>(oversized.size());
+        oversized.push_back(id);
+        return;
+    }
+    growMargin(half);
+    attach(id, cellOf(entry.box.center()));
+}
+
+void HashGrid3D::unplace(uint32_t id) {
+    Entry& entry = entries[id];
+    if (entry.oversized) {
+        // Retrait par échange avec le dernier grand objet
+        const uint32_t position = entry.position;
+        oversized[position] = oversized.back();
+        entries[oversized[position]].position = position;
+        oversized.pop_back();
+        return;
+    }
+    detach(id);
+    shrinkMargin(entry.box.halfExtent());
+}
+
+void HashGrid3D::growMargin(const Point3D& half) {
+    const float extent[3] = {half.getX(), half.getY(), half.getZ()};
+    float current[3] = {margin.getX(), margin.getY(), margin.getZ()};
+    for (int axis = 0; axis < 3; ++axis) {
+        if (extent[axis] > current[axis]) {
+            current[axis] = extent[axis];
+            marginHolders[axis] = 1;
+        } else if (extent[axis] == current[axis]) {
+            ++marginHolders[axis];
+        }
+    }
+    margin = Point3D(current[0], current[1], current[2]);
+}
+
+void HashGrid3D::shrinkMargin(const Point3D& half) {
+    const float extent[3] = {half.getX(), half.getY(), half.getZ()};
+    const float current[3] = {margin.getX(), margin.getY(), margin.getZ()};
+    bool stale = false;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (extent[axis] == current[axis] && --marginHolders[axis] == 0) {
+            stale = true;
+        }
+    }
+    if (stale) {
+        recomputeMargin();
+    }
+}
+
+void HashGrid3D::recomputeMargin() {
+    margin = Point3D();
+    marginHolders[0] = marginHolders[1] = marginHolders[2] = 0;
+    for (const auto& [cell, items] : cells) {
+        for (uint32_t id : items) {
+            growMargin(entries[id].box.halfExtent());
+        }
+    }
+}
+
+void HashGrid3D::insert(uint32_t id, const BoundingBox3D& box) {
+    if (contains(id)) {
+        throw std::invalid_argument("Cet objet est déjà dans la grille.");
+    }
+    if (box.isEmpty()) {
+        throw std::invalid_argument("La boîte d'un objet de la grille ne peut pas être vide.");
+    }
+    if (id >= entries.size()) {
+        entries.resize(static_cast<size_t>(id) + 1);
+    }
+    entries[id].box = box;
+    entries[id].present = true;
+    place(id);
+    ++count;
+}
+
+void HashGrid3D::update(uint32_t id, const BoundingBox3D& box) {
+    if (!contains(id)) {
+        throw std::out_of_range("Cet objet n'est pas dans la grille.");
+    }
+    if (box.isEmpty()) {
+        throw std::invalid_argument("La boîte d'un objet de la grille ne peut pas être vide.");
+    }
+    Entry& entry = entries[id];
+    // Cas courant : un objet des cellules qui garde sa taille et sa cellule ne touche ni aux cellules ni à la marge
+    const Point3D half = box.halfExtent(), previous = entry.box.halfExtent();
+    const bool sameSize = half.getX() == previous.getX() && half.getY() == previous.getY() && half.getZ() == previous.getZ();
+    if (!entry.oversized && sameSize && cellOf(box.center()) == entry.cell) {
+        entry.box = box;
+        return;
+    }
+    unplace(id);
+    entry.box = box;
+    place(id);
+}
+
+void HashGrid3D::remove(uint32_t id) {
+    if (!contains(id)) {
+        throw std::out_of_range("Cet objet n'est pas dans la grille.");
+    }
+    unplace(id);
+    entries[id].present = false;
+    --count;
+}
+
+void HashGrid3D::clear() {
+    cells.clear();
+    entries.clear();
+    oversized.clear();
+    count = 0;
+    margin = Point3D();
+    marginHolders[0] = marginHolders[1] = marginHolders[2] = 0;
+}
+
+void HashGrid3D::queryBox(const BoundingBox3D& region, std::vector<uint32_t>& out) const {
+    forEachInBox(region, [&out](uint32_t id) { out.push_back(id); });
+}
@@ -0,0 +1,253 @@
+/**
+ * @file hash_grid3d.h
+ * @brief Déclaration de la classe HashGrid3D : grille uniforme hachée pour les objets très mobiles.
+ *
+ * Une hiérarchie doit être ajustée ou reconstruite lorsque les objets bougent. Dans une grille
+ * uniforme, un objet appartient à la cellule de son centre : l'ajouter, le déplacer ou le retirer
+ * ne touche que cette cellule, en O(1). Seules les cellules occupées sont stockées, dans une
+ * table de hachage indexée par leurs coordonnées entières.
+ */
+#ifndef HASH_GRID3D_H
+#define HASH_GRID3D_H
+
+#include "bounding_volume3d.h"
+#include "frustum3d.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Côté par défaut des cellules de la grille.
+ */
+constexpr float DEFAULT_HASH_GRID_CELL_SIZE = 10.0f;
+
+/**
+ * @class HashGrid3D
+ * @brief Grille uniforme lâche : chaque objet est rangé dans la cellule de son centre.
+ *
+ * Un objet peut déborder de sa cellule : les requêtes élargissent leur région de la plus grande
+ * demi-dimension des objets présents (la marge), suivie au fil des ajouts, déplacements et retraits.
+ * Un objet dont une demi-dimension dépasse le côté des cellules est rangé à part, dans une liste
+ * testée objet par objet par chaque requête : la marge reste bornée par le côté des cellules, et un
+ * seul grand objet n'élargit pas toutes les requêtes. Les cellules devraient être de l'ordre de la
+ * taille des objets. Les objets sont désignés par un indice choisi par l'appelant (par exemple une
+ * case de SlotMap).
+ */
+class HashGrid3D {
+    private:
+        struct CellKey {
+            int32_t x, y, z;
+            bool operator==(const CellKey& other) const { return x == other.x && y == other.y && z == other.z; }
+        };
+
+        struct CellKeyHash {
+            size_t operator()(const CellKey& key) const {
+                // Trois grands nombres premiers (Teschner et al.)
+                return (static_cast<uint32_t>(key.x) * 73856093u) ^ (static_cast<uint32_t>(key.y) * 19349663u) ^
+                       (static_cast<uint32_t>(key.z) * 83492791u);
+            }
+        };
+
+        struct Entry {
+            BoundingBox3D box;      // Boîte de l'objet.
+            CellKey cell{0, 0, 0};  // Cellule du centre de la boîte.
+            uint32_t position = 0;  // Position de l'objet dans sa cellule, ou dans la liste des grands objets.
+            bool present = false;   // L'indice désigne-t-il un objet de la grille ?
+            bool oversized = false; // Objet rangé dans la liste des grands objets plutôt que dans une cellule.
+        };
+
+        float cellSize;
+        float inverseCellSize;
+        std::unordered_map<CellKey, std::vector<uint32_t>, CellKeyHash> cells; // Cellules occupées.
+        std::vector<Entry> entries;                                           // Objets, par indice.
+        std::vector<uint32_t> oversized;                                      // Objets trop grands pour les cellules.
+        size_t count = 0;
+        Point3D margin;                   // Plus grande demi-dimension des objets rangés dans les cellules.
+        uint32_t marginHolders[3] = {};   // Nombre de ces objets qui atteignent la marge, par axe.
+
+        CellKey cellOf(const Point3D& point) const;
+        int32_t cellCoordinate(float value) const;
+        void attach(uint32_t id, const CellKey& cell);
+        void detach(uint32_t id);
+
+        // Range un objet (dont la boîte est à jour) dans sa cellule ou dans la liste des grands objets
+        void place(uint32_t id);
+        // Retire un objet de sa cellule ou de la liste des grands objets
+        void unplace(uint32_t id);
+
+        // Tient la marge à jour lorsqu'un objet entre dans les cellules ou en sort ; la marge n'est
+        // recalculée (O(n)) que lorsque le dernier objet qui l'atteint sur un axe s'en va
+        void growMargin(const Point3D& half);
+        void shrinkMargin(const Point3D& half);
+        void recomputeMargin();
+
+        // Boîte d'une cellule élargie de la marge : contient tous les objets de la cellule
+        BoundingBox3D looseCellBox(const CellKey& cell) const {
+            Point3D low(cell.x * cellSize, cell.y * cellSize, cell.z * cellSize);
+            return BoundingBox3D(low - margin, low + Point3D(cellSize, cellSize, cellSize) + margin);
+        }
+
+    public:
+        /**
+         * @brief Constructeur d'une grille vide.
+         * @param cellSize Le côté des cellules.
+         * @throw std::invalid_argument Si le côté n'est pas strictement positif.
+         */
+        explicit HashGrid3D(float cellSize = DEFAULT_HASH_GRID_CELL_SIZE);
+
+        /**
+         * @brief Ajoute un objet (O(1)).
+         * @param id L'indice de l'objet.
+         * @param box La boîte englobante de l'objet.
+         * @throw std::invalid_argument Si l'indice est déjà utilisé ou si la boîte est vide.
+         */
+        void insert(uint32_t id, const BoundingBox3D& box);
+
+        /**
+         * @brief Déplace un objet (O(1) ; rien à faire s'il reste dans la même cellule).
+         * @param id L'indice de l'objet.
+         * @param box La nouvelle boîte englobante de l'objet.
+         * @throw std::out_of_range Si l'objet n'est pas dans la grille.
+         * @throw std::invalid_argument Si la boîte est vide.
+         */
+        void update(uint32_t id, const BoundingBox3D& box);
+
+        /**
+         * @brief Retire un objet (O(1)).
+         * @param id L'indice de l'objet.
+         * @throw std::out_of_range Si l'objet n'est pas dans la grille.
+         */
+        void remove(uint32_t id);
+
+        /**
+         * @brief Vérifie si un indice désigne un objet de la grille.
+         */
+        bool contains(uint32_t id) const { return id < entries.size() && entries[id].present; }
+
+        /**
+         * @brief Retire tous les objets et remet la marge à zéro.
+         */
+        void clear();
+
+        size_t size() const { return count; }
+        size_t getCellCount() const { return cells.size(); }
+        size_t getOversizedCount() const { return oversized.size(); }
+
+        /**
+         * @brief Retourne la marge des requêtes : la plus grande demi-dimension des objets rangés dans les cellules.
+         */
+        const Point3D& getMargin() const { return margin; }
+        float getCellSize() const { return cellSize; }
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte touche une région.
+         *
+         * Les cellules de la région sont parcourues une à une lorsqu'elles sont moins nombreuses
+         * que les cellules occupées, sinon ce sont les cellules occupées qui sont parcourues.
+         * Les grands objets sont testés un par un.
+         *
+         * @param region La région.
+         * @param visit Le visiteur, appelé avec l'indice de chaque objet (uint32_t).
+         */
+        template <typename Visitor>
+        void forEachInBox(const BoundingBox3D& region, Visitor&& visit) const {
+            if (region.isEmpty() || count == 0) {
+                return;
+            }
+            for (uint32_t id : oversized) {
+                if (entries[id].box.intersects(region)) {
+                    visit(id);
+                }
+            }
+            if (cells.empty()) {
+                return;
+            }
+            const CellKey low = cellOf(region.getMin() - margin);
+            const CellKey high = cellOf(region.getMax() + margin);
+            auto visitCell = [&](const std::vector<uint32_t>& items) {
+                for (uint32_t id : items) {
+                    if (entries[id].box.intersects(region)) {
+                        visit(id);
+                    }
+                }
+            };
+            const double regionCells = (static_cast<double>(high.x) - low.x + 1) * (static_cast<double>(high.y) - low.y + 1) *
+                                       (static_cast<double>(high.z) - low.z + 1);
+            if (regionCells <= static_cast<double>(cells.size())) {
+                for (int32_t x = low.x; x <= high.x; ++x) {
+                    for (int32_t y = low.y; y <= high.y; ++y) {
+                        for (int32_t z = low.z; z <= high.z; ++z) {
+                            auto found = cells.find(CellKey{x, y, z});
+                            if (found != cells.end()) {
+                                visitCell(found->second);
+                            }
+                        }
+                    }
+                }
+                return;
+            }
+            for (const auto& [cell, items] : cells) {
+                if (cell.x >= low.x && cell.x <= high.x && cell.y >= low.y && cell.y <= high.y && cell.z >= low.z && cell.z <= high.z) {
+                    visitCell(items);
+                }
+            }
+        }
+
+        /**
+         * @brief Ajoute à out l'indice de chaque objet dont la boîte touche une région.
+         * @param region La région.
+         * @param out La liste à compléter (non vidée).
+         */
+        void queryBox(const BoundingBox3D& region, std::vector<uint32_t>& out) const;
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte touche le volume de vision.
+         *
+         * Les cellules occupées sont testées contre le volume ; les objets des cellules entièrement
+         * visibles sont acceptés sans autre test. Les grands objets sont testés un par un.
+         *
+         * @param frustum Le volume de vision.
+         * @param visit Le visiteur, appelé avec l'indice de chaque objet (uint32_t).
+         */
+        template <typename Visitor>
+        void forEachInFrustum(const Frustum3D& frustum, Visitor&& visit) const {
+            for (uint32_t id : oversized) {
+                if (frustum.intersects(entries[id].box)) {
+                    visit(id);
+                }
+            }
+            for (const auto& [cell, items] : cells) {
+                FrustumTest test = frustum.classify(looseCellBox(cell));
+                if (test == FrustumTest::Outside) {
+                    continue;
+                }
+                for (uint32_t id : items) {
+                    if (test == FrustumTest::Inside || frustum.intersects(entries[id].box)) {
+                        visit(id);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte est à moins d'une distance d'un point.
+         * @param point Le point.
+         * @param radius La distance maximale entre le point et la boîte.
+         * @param visit Le visiteur, appelé avec l'indice de chaque objet (uint32_t).
+         */
+        template <typename Visitor>
+        void forEachWithin(const Point3D& point, float radius, Visitor&& visit) const {
+            const Point3D reach(radius, radius, radius);
+            forEachInBox(BoundingBox3D(point - reach, point + reach), [&](uint32_t id) {
+                const BoundingBox3D& box = entries[id].box;
+                Point3D d = point - Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+                if (d.dotProduct(d) <= radius * radius) {
+                    visit(id);
+                }
+            });
+        }
+};
+
+#endif // HASH_GRID3D_H
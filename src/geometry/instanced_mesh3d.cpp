@@ -0,0 +1,78 @@
+#include "instanced_mesh3d.h"
+#include "sphere3d.h"
+#include "pave3d.h"
+#include <algorithm>
+#include <stdexcept>
+
+InstancedMesh3D::InstancedMesh3D(std::shared_ptr<const std::vector<Quad3D>> mesh)
+    : mesh(std::move(mesh)), localRadius(0.0f) {
+    if (!this->mesh) {
+        throw std::invalid_argument("Le maillage d'un ensemble d'instances ne peut pas être nul.");
+    }
+    // Rayon englobant calculé une fois pour toutes les instances
+    for (const Quad3D& quad : *this->mesh) {
+        for (const Triangle3D* t : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+            localRadius = std::max({localRadius, t->getP1().norm(), t->getP2().norm(), t->getP3().norm()});
+        }
+    }
+}
+
+InstancedMesh3D InstancedMesh3D::fromSphere(const Sphere3D& sphere) {
+    return InstancedMesh3D(sphere.getMesh());
+}
+
+InstancedMesh3D InstancedMesh3D::fromPave(const Pave3D& pave) {
+    const std::array<Quad3D, 6>& faces = *pave.getMesh();
+    return InstancedMesh3D(std::make_shared<const std::vector<Quad3D>>(faces.begin(), faces.end()));
+}
+
+void InstancedMesh3D::checkIndex(size_t index) const {
+    if (index >= transforms.size()) {
+        throw std::out_of_range("Indice d'instance invalide.");
+    }
+}
+
+size_t InstancedMesh3D::addInstance(const ModelTransform& model, const Couleur& color) {
+    transforms.push_back(model);
+    colors.push_back(color);
+    return transforms.size() - 1;
+}
+
+void InstancedMesh3D::removeInstance(size_t index) {
+    checkIndex(index);
+    transforms[index] = transforms.back();
+    colors[index] = colors.back();
+    transforms.pop_back();
+    colors.pop_back();
+}
+
+void InstancedMesh3D::reserve(size_t count) {
+    transforms.reserve(count);
+    colors.reserve(count);
+}
+
+const ModelTransform& InstancedMesh3D::getTransform(size_t index) const {
+    checkIndex(index);
+    return transforms[index];
+}
+
+void InstancedMesh3D::setTransform(size_t index, const ModelTransform& model) {
+    checkIndex(index);
+    transforms[index] = model;
+}
+
+const Couleur& InstancedMesh3D::getColor(size_t index) const {
+    checkIndex(index);
+    return colors[index];
+}
+
+void InstancedMesh3D::setColor(size_t index, const Couleur& color) {
+    checkIndex(index);
+    colors[index] = color;
+}
+
+BoundingSphere3D InstancedMesh3D::getInstanceBounds(size_t index) const {
+    checkIndex(index);
+    const ModelTransform& model = transforms[index];
+    return BoundingSphere3D(model.getPosition(), localRadius * model.getScale());
+}
@@ -0,0 +1,143 @@
+/**
+ * @file instanced_mesh3d.h
+ * @brief Déclaration de la classe InstancedMesh3D : un maillage partagé placé de nombreuses fois.
+ *
+ * Pour les scènes composées de milliers d'objets identiques (molécules, particules), le maillage
+ * est stocké une seule fois en espace objet ; chaque instance ne stocke que sa transformation
+ * de modèle et sa couleur. La mémoire est en O(maillage + instances).
+ */
+#ifndef INSTANCED_MESH3D_H
+#define INSTANCED_MESH3D_H
+
+#include "quad3d.h"
+#include "model_transform.h"
+#include "transform3d.h"
+#include "bounding_volume3d.h"
+#include "../couleur.h"
+#include <memory>
+#include <vector>
+
+class Sphere3D;
+class Pave3D;
+
+/**
+ * @class InstancedMesh3D
+ * @brief Maillage en espace objet partagé par un ensemble d'instances (transformation et couleur).
+ *
+ * Les sommets ne sont jamais recopiés par instance : le rendu place le maillage dans le monde
+ * à la volée, instance par instance. Les instances sont rangées en tableaux contigus ;
+ * la suppression déplace la dernière instance à la place de l'instance supprimée.
+ */
+class InstancedMesh3D {
+    private:
+        std::shared_ptr<const std::vector<Quad3D>> mesh; // Maillage en espace objet, partagé.
+        float localRadius;                               // Rayon de la sphère englobante du maillage, centrée à l'origine.
+        std::vector<ModelTransform> transforms;          // Transformation de modèle de chaque instance.
+        std::vector<Couleur> colors;                     // Couleur de chaque instance.
+
+        /**
+         * @brief Vérifie qu'un indice d'instance est valide.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        void checkIndex(size_t index) const;
+
+    public:
+        /**
+         * @brief Constructeur à partir d'un maillage en espace objet.
+         * @param mesh Le maillage partagé.
+         * @throw std::invalid_argument Si le maillage est nul.
+         */
+        explicit InstancedMesh3D(std::shared_ptr<const std::vector<Quad3D>> mesh);
+
+        /**
+         * @brief Crée un ensemble d'instances partageant le maillage (niveau le plus fin) d'une sphère.
+         * @param sphere La sphère modèle ; seul son maillage unité est utilisé.
+         * @return L'ensemble d'instances, vide.
+         */
+        static InstancedMesh3D fromSphere(const Sphere3D& sphere);
+
+        /**
+         * @brief Crée un ensemble d'instances partageant les faces d'un pavé.
+         * @param pave Le pavé modèle ; ses faces en espace objet sont copiées une seule fois.
+         * @return L'ensemble d'instances, vide.
+         */
+        static InstancedMesh3D fromPave(const Pave3D& pave);
+
+        /**
+         * @brief Ajoute une instance.
+         * @param model La transformation de modèle de l'instance.
+         * @param color La couleur de l'instance.
+         * @return L'indice de l'instance.
+         */
+        size_t addInstance(const ModelTransform& model, const Couleur& color);
+
+        /**
+         * @brief Supprime une instance ; la dernière instance prend son indice.
+         * @param index L'indice de l'instance.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        void removeInstance(size_t index);
+
+        /**
+         * @brief Réserve la place pour un nombre d'instances.
+         * @param count Le nombre d'instances prévu.
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Retourne le nombre d'instances.
+         */
+        size_t getInstanceCount() const { return transforms.size(); }
+
+        /**
+         * @brief Retourne le maillage partagé en espace objet.
+         */
+        const std::vector<Quad3D>& getMesh() const { return *mesh; }
+
+        /**
+         * @brief Retourne le pointeur partagé vers le maillage (pour vérifier le partage).
+         */
+        std::shared_ptr<const std::vector<Quad3D>> getSharedMesh() const { return mesh; }
+
+        /**
+         * @brief Accesseurs de la transformation et de la couleur d'une instance.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        const ModelTransform& getTransform(size_t index) const;
+        void setTransform(size_t index, const ModelTransform& model);
+        const Couleur& getColor(size_t index) const;
+        void setColor(size_t index, const Couleur& color);
+
+        /**
+         * @brief Calcule la sphère englobante d'une instance dans le monde (O(1)).
+         * @param index L'indice de l'instance.
+         * @return La sphère englobante.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        BoundingSphere3D getInstanceBounds(size_t index) const;
+
+        /**
+         * @brief Appelle un visiteur pour chaque triangle d'une instance placé dans le monde.
+         *
+         * Les triangles sont transformés à la volée dans une variable locale : rien n'est stocké.
+         *
+         * @param index L'indice de l'instance.
+         * @param visit Le visiteur, appelé avec (const Triangle3D& triangle, const Couleur& color).
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        template <typename Visitor>
+        void forEachWorldTriangle(size_t index, Visitor&& visit) const {
+            checkIndex(index);
+            const Transform3D toWorld = transforms[index].toTransform3D();
+            const Couleur& color = colors[index];
+            for (const Quad3D& quad : *mesh) {
+                for (const Triangle3D* local : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+                    Triangle3D triangle = *local;
+                    triangle.transform(toWorld);
+                    visit(static_cast<const Triangle3D&>(triangle), color);
+                }
+            }
+        }
+};
+
+#endif // INSTANCED_MESH3D_H
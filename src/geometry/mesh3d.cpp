@@ -0,0 +1,224 @@
+#include "mesh3d.h"
+#include <cmath>
+#include <stdexcept>
+
+uint32_t Mesh3D::addVertex(const Point3D& position) {
+    positions.push_back(position);
+    return static_cast<uint32_t>(positions.size() - 1);
+}
+
+void Mesh3D::addTriangle(uint32_t a, uint32_t b, uint32_t c, const Couleur& color) {
+    const size_t count = positions.size();
+    if (a >= count || b >= count || c >= count) {
+        throw std::out_of_range("Indice de sommet invalide.");
+    }
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+    faceColors.push_back(color);
+}
+
+void Mesh3D::addQuad(uint32_t a, uint32_t b, uint32_t c, uint32_t d, const Couleur& color) {
+    addTriangle(a, b, c, color);
+    addTriangle(a, c, d, color);
+}
+
+void Mesh3D::appendQuads(const std::vector<Quad3D>& quads) {
+    appendQuads(quads.data(), quads.size());
+}
+
+void Mesh3D::appendQuads(const Quad3D* quads, size_t count) {
+    reserve(positions.size() + 4 * count, faceColors.size() + 2 * count);
+    for (size_t q = 0; q < count; ++q) {
+        const Quad3D& quad = quads[q];
+        // Les sommets sont lus dans les triangles eux-mêmes : Quad3D::orient a pu échanger deux sommets
+        // de chaque triangle, et getCorners ne décrit alors plus le contour du quadrilatère
+        const Triangle3D& t1 = quad.getFirstTriangle();
+        const Triangle3D& t2 = quad.getSecondTriangle();
+        const uint32_t first = static_cast<uint32_t>(positions.size());
+        positions.insert(positions.end(), {t1.getP1(), t1.getP2(), t1.getP3()});
+        const Point3D second[3] = {t2.getP1(), t2.getP2(), t2.getP3()};
+        uint32_t secondIndices[3];
+        for (int k = 0; k < 3; ++k) {
+            secondIndices[k] = first + 3;
+            for (uint32_t i = 0; i < 3; ++i) {
+                if (second[k] == positions[first + i]) {
+                    secondIndices[k] = first + i;
+                }
+            }
+            // Le sommet du second triangle absent du premier est le quatrième coin
+            if (secondIndices[k] == first + 3 && positions.size() == first + 3) {
+                positions.push_back(second[k]);
+            }
+        }
+        // Les indices viennent d'être créés : pas besoin de les vérifier
+        indices.insert(indices.end(), {first, first + 1, first + 2, secondIndices[0], secondIndices[1], secondIndices[2]});
+        faceColors.push_back(quad.getFirstTriangle().getColor());
+        faceColors.push_back(quad.getSecondTriangle().getColor());
+    }
+}
+
+void Mesh3D::reserve(size_t vertexCount, size_t triangleCount) {
+    positions.reserve(vertexCount);
+    indices.reserve(3 * triangleCount);
+    faceColors.reserve(triangleCount);
+}
+
+void Mesh3D::clear() {
+    positions.clear();
+    indices.clear();
+    faceColors.clear();
+}
+
+void Mesh3D::checkTriangle(size_t triangle) const {
+    if (triangle >= faceColors.size()) {
+        throw std::out_of_range("Indice de triangle invalide.");
+    }
+}
+
+const Couleur& Mesh3D::getFaceColor(size_t triangle) const {
+    checkTriangle(triangle);
+    return faceColors[triangle];
+}
+
+void Mesh3D::setFaceColor(size_t triangle, const Couleur& color) {
+    checkTriangle(triangle);
+    faceColors[triangle] = color;
+}
+
+Triangle3D Mesh3D::getTriangle(size_t triangle) const {
+    checkTriangle(triangle);
+    const uint32_t* face = &indices[3 * triangle];
+    return Triangle3D(UNCHECKED, positions[face[0]], positions[face[1]], positions[face[2]], faceColors[triangle]);
+}
+
+Point3D Mesh3D::getFaceNormal(size_t triangle) const {
+    checkTriangle(triangle);
+    const uint32_t* face = &indices[3 * triangle];
+    const Point3D& a = positions[face[0]];
+    return (positions[face[1]] - a).crossProduct(positions[face[2]] - a).normalized();
+}
+
+void Mesh3D::transform(const Transform3D& transform) {
+    for (Point3D& position : positions) {
+        position = transform.apply(position);
+    }
+}
+
+Mesh3D Mesh3D::fromQuads(const std::vector<Quad3D>& quads) {
+    Mesh3D mesh;
+    mesh.appendQuads(quads);
+    return mesh;
+}
+
+// Cylindre : anneau bas (indices 0..n-1), anneau haut (n..2n-1), puis les deux centres
+Mesh3D Mesh3D::cylinder(float radius, float height, int segments, const Couleur& color) {
+    if (radius <= 0 || height <= 0) {
+        throw std::invalid_argument("Le rayon et la hauteur du cylindre doivent être strictement positifs.");
+    }
+    if (segments < 3) {
+        throw std::invalid_argument("Un cylindre doit avoir au moins 3 secteurs.");
+    }
+    const uint32_t n = static_cast<uint32_t>(segments);
+    const float half = height / 2.0f;
+    Mesh3D mesh;
+    mesh.reserve(2 * n + 2, 4 * n);
+    for (float y : {-half, half}) {
+        for (uint32_t i = 0; i < n; ++i) {
+            float angle = 2.0f * static_cast<float>(M_PI) * i / n;
+            mesh.addVertex(Point3D(radius * std::cos(angle), y, radius * std::sin(angle)));
+        }
+    }
+    const uint32_t bottomCenter = mesh.addVertex(Point3D(0, -half, 0));
+    const uint32_t topCenter = mesh.addVertex(Point3D(0, half, 0));
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t next = (i + 1) % n;
+        mesh.addQuad(i, n + i, n + next, next, color);
+        mesh.addTriangle(bottomCenter, i, next, color);
+        mesh.addTriangle(topCenter, n + next, n + i, color);
+    }
+    return mesh;
+}
+
+// Cône : anneau de base (indices 0..n-1), pointe, centre de la base
+Mesh3D Mesh3D::cone(float radius, float height, int segments, const Couleur& color) {
+    if (radius <= 0 || height <= 0) {
+        throw std::invalid_argument("Le rayon et la hauteur du cône doivent être strictement positifs.");
+    }
+    if (segments < 3) {
+        throw std::invalid_argument("Un cône doit avoir au moins 3 secteurs.");
+    }
+    const uint32_t n = static_cast<uint32_t>(segments);
+    const float half = height / 2.0f;
+    Mesh3D mesh;
+    mesh.reserve(n + 2, 2 * n);
+    for (uint32_t i = 0; i < n; ++i) {
+        float angle = 2.0f * static_cast<float>(M_PI) * i / n;
+        mesh.addVertex(Point3D(radius * std::cos(angle), -half, radius * std::sin(angle)));
+    }
+    const uint32_t apex = mesh.addVertex(Point3D(0, half, 0));
+    const uint32_t baseCenter = mesh.addVertex(Point3D(0, -half, 0));
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t next = (i + 1) % n;
+        mesh.addTriangle(i, apex, next, color);
+        mesh.addTriangle(baseCenter, i, next, color);
+    }
+    return mesh;
+}
+
+// Tore : le sommet (i, j) est à l'angle i autour de l'axe et j autour du tube
+Mesh3D Mesh3D::torus(float majorRadius, float minorRadius, int majorSegments, int minorSegments, const Couleur& color) {
+    if (minorRadius <= 0 || majorRadius <= minorRadius) {
+        throw std::invalid_argument("Le tore doit vérifier 0 < rayon du tube < rayon principal.");
+    }
+    if (majorSegments < 3 || minorSegments < 3) {
+        throw std::invalid_argument("Un tore doit avoir au moins 3 secteurs dans chaque direction.");
+    }
+    const uint32_t n = static_cast<uint32_t>(majorSegments);
+    const uint32_t m = static_cast<uint32_t>(minorSegments);
+    Mesh3D mesh;
+    mesh.reserve(n * m, 2 * n * m);
+    for (uint32_t i = 0; i < n; ++i) {
+        float u = 2.0f * static_cast<float>(M_PI) * i / n;
+        for (uint32_t j = 0; j < m; ++j) {
+            float v = 2.0f * static_cast<float>(M_PI) * j / m;
+            float ring = majorRadius + minorRadius * std::cos(v);
+            mesh.addVertex(Point3D(ring * std::cos(u), minorRadius * std::sin(v), ring * std::sin(u)));
+        }
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t nextI = (i + 1) % n;
+        for (uint32_t j = 0; j < m; ++j) {
+            uint32_t nextJ = (j + 1) % m;
+            mesh.addQuad(i * m + j, i * m + nextJ, nextI * m + nextJ, nextI * m + j, color);
+        }
+    }
+    return mesh;
+}
+
+// Grille : (columns + 1) x (rows + 1) sommets, ligne par ligne selon Z
+Mesh3D Mesh3D::planeGrid(float width, float depth, int columns, int rows, const Couleur& color) {
+    if (width <= 0 || depth <= 0) {
+        throw std::invalid_argument("Les dimensions de la grille doivent être strictement positives.");
+    }
+    if (columns < 1 || rows < 1) {
+        throw std::invalid_argument("Une grille doit avoir au moins une cellule dans chaque direction.");
+    }
+    const uint32_t cols = static_cast<uint32_t>(columns);
+    const uint32_t rowCount = static_cast<uint32_t>(rows);
+    Mesh3D mesh;
+    mesh.reserve((cols + 1) * (rowCount + 1), 2 * cols * rowCount);
+    for (uint32_t r = 0; r <= rowCount; ++r) {
+        float z = -depth / 2.0f + depth * r / rowCount;
+        for (uint32_t c = 0; c <= cols; ++c) {
+            mesh.addVertex(Point3D(-width / 2.0f + width * c / cols, 0, z));
+        }
+    }
+    for (uint32_t r = 0; r < rowCount; ++r) {
+        for (uint32_t c = 0; c < cols; ++c) {
+            uint32_t corner = r * (cols + 1) + c;
+            mesh.addQuad(corner, corner + cols + 1, corner + cols + 2, corner + 1, color);
+        }
+    }
+    return mesh;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file mesh3d.h
+ * @brief Déclaration de la classe Mesh3D, maillage indexé générique.
+ *
+ * Un Mesh3D stocke une liste de positions, trois indices par triangle et une couleur par
+ * triangle. Pave3D et Sphere3D savent s'y exporter et des générateurs produisent cylindres,
+ * cônes, tores et grilles planes : le rendu n'a plus qu'un seul chemin pour tous les objets.
+ */
+#ifndef MESH3D_H
+#define MESH3D_H
+
+#include "point3d.h"
+#include "quad3d.h"
+#include "triangle3d.h"
+#include "transform3d.h"
+#include "../couleur.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class Mesh3D
+ * @brief Maillage indexé : positions partagées, triangles (a, b, c) et attributs par face.
+ *
+ * Les triangles sont orientés comme ceux de Quad3D : un quadrilatère (a, b, c, d) donne les
+ * triangles (a, b, c) et (a, c, d). Les générateurs produisent des normales sortantes.
+ * clear() conserve la capacité des tableaux : un maillage réutilisé d'une image à l'autre
+ * n'alloue plus une fois dimensionné.
+ */
+class Mesh3D {
+    private:
+        std::vector<Point3D> positions;  // Positions des sommets.
+        std::vector<uint32_t> indices;   // Trois indices de sommets par triangle.
+        std::vector<Couleur> faceColors; // Couleur de chaque triangle.
+
+        /**
+         * @brief Vérifie qu'un indice de triangle est valide.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        void checkTriangle(size_t triangle) const;
+
+    public:
+        /**
+         * @brief Constructeur par défaut : maillage vide.
+         */
+        Mesh3D() = default;
+
+        /**
+         * @brief Ajoute un sommet.
+         * @param position La position du sommet.
+         * @return L'indice du sommet.
+         */
+        uint32_t addVertex(const Point3D& position);
+
+        /**
+         * @brief Ajoute un triangle.
+         * @param a L'indice du premier sommet.
+         * @param b L'indice du deuxième sommet.
+         * @param c L'indice du troisième sommet.
+         * @param color La couleur de la face.
+         * @throw std::out_of_range Si un indice ne désigne aucun sommet.
+         */
+        void addTriangle(uint32_t a, uint32_t b, uint32_t c, const Couleur& color);
+
+        /**
+         * @brief Ajoute un quadrilatère sous forme des triangles (a, b, c) et (a, c, d).
+         * @param color La couleur des deux faces.
+         * @throw std::out_of_range Si un indice ne désigne aucun sommet.
+         */
+        void addQuad(uint32_t a, uint32_t b, uint32_t c, uint32_t d, const Couleur& color);
+
+        /**
+         * @brief Ajoute des quadrilatères (quatre sommets et deux triangles chacun).
+         *
+         * Les triangles 2q et 2q + 1 sont ceux du quadrilatère q, sommets et sens compris : un
+         * quadrilatère orienté vers l'œil (Quad3D::orient) garde ses triangles tels quels.
+         *
+         * @param quads Les quadrilatères ; chaque triangle garde sa couleur.
+         */
+        void appendQuads(const std::vector<Quad3D>& quads);
+
+        /**
+         * @brief Ajoute des quadrilatères (quatre sommets et deux triangles chacun).
+         * @param quads Les quadrilatères.
+         * @param count Le nombre de quadrilatères.
+         */
+        void appendQuads(const Quad3D* quads, size_t count);
+
+        /**
+         * @brief Réserve la place pour des sommets et des triangles.
+         * @param vertexCount Le nombre de sommets prévu.
+         * @param triangleCount Le nombre de triangles prévu.
+         */
+        void reserve(size_t vertexCount, size_t triangleCount);
+
+        /**
+         * @brief Vide le maillage en conservant la capacité des tableaux.
+         */
+        void clear();
+
+        /**
+         * @brief Retourne le nombre de sommets.
+         */
+        size_t getVertexCount() const { return positions.size(); }
+
+        /**
+         * @brief Retourne le nombre de triangles.
+         */
+        size_t getTriangleCount() const { return faceColors.size(); }
+
+        /**
+         * @brief Retourne les positions des sommets.
+         */
+        const std::vector<Point3D>& getPositions() const { return positions; }
+
+        /**
+         * @brief Retourne les indices (trois par triangle).
+         */
+        const std::vector<uint32_t>& getIndices() const { return indices; }
+
+        /**
+         * @brief Accesseurs de la couleur d'une face.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        const Couleur& getFaceColor(size_t triangle) const;
+        void setFaceColor(size_t triangle, const Couleur& color);
+
+        /**
+         * @brief Construit le triangle d'indice donné (sans validation de la géométrie).
+         * @param triangle L'indice du triangle.
+         * @return Le triangle, avec sa couleur.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        Triangle3D getTriangle(size_t triangle) const;
+
+        /**
+         * @brief Calcule la normale unitaire d'une face.
+         * @param triangle L'indice du triangle.
+         * @return La normale, ou le vecteur nul pour une face dégénérée.
+         * @throw std::out_of_range Si l'indice est hors des limites.
+         */
+        Point3D getFaceNormal(size_t triangle) const;
+
+        /**
+         * @brief Applique une transformation affine à toutes les positions.
+         * @param transform La transformation.
+         */
+        void transform(const Transform3D& transform);
+
+        /**
+         * @brief Construit un maillage à partir de quadrilatères.
+         * @param quads Les quadrilatères.
+         * @return Le maillage.
+         */
+        static Mesh3D fromQuads(const std::vector<Quad3D>& quads);
+
+        /**
+         * @brief Génère un cylindre d'axe Y centré à l'origine, fermé par deux disques.
+         * @param radius Le rayon.
+         * @param height La hauteur.
+         * @param segments Le nombre de secteurs autour de l'axe (au moins 3).
+         * @param color La couleur des faces.
+         * @return Le maillage.
+         * @throw std::invalid_argument Si un paramètre est invalide.
+         */
+        static Mesh3D cylinder(float radius, float height, int segments, const Couleur& color);
+
+        /**
+         * @brief Génère un cône d'axe Y centré à l'origine, pointe vers +Y, fermé par un disque.
+         * @param radius Le rayon de la base.
+         * @param height La hauteur.
+         * @param segments Le nombre de secteurs autour de l'axe (au moins 3).
+         * @param color La couleur des faces.
+         * @return Le maillage.
+         * @throw std::invalid_argument Si un paramètre est invalide.
+         */
+        static Mesh3D cone(float radius, float height, int segments, const Couleur& color);
+
+        /**
+         * @brief Génère un tore d'axe Y centré à l'origine.
+         * @param majorRadius La distance du centre au cercle central du tube.
+         * @param minorRadius Le rayon du tube (strictement inférieur à majorRadius).
+         * @param majorSegments Le nombre de secteurs autour de l'axe (au moins 3).
+         * @param minorSegments Le nombre de secteurs autour du tube (au moins 3).
+         * @param color La couleur des faces.
+         * @return Le maillage.
+         * @throw std::invalid_argument Si un paramètre est invalide.
+         */
+        static Mesh3D torus(float majorRadius, float minorRadius, int majorSegments, int minorSegments, const Couleur& color);
+
+        /**
+         * @brief Génère une grille plane dans le plan XZ, centrée à l'origine, de normale +Y.
+         * @param width La largeur (selon X).
+         * @param depth La profondeur (selon Z).
+         * @param columns Le nombre de cellules selon X (au moins 1).
+         * @param rows Le nombre de cellules selon Z (au moins 1).
+         * @param color La couleur des faces.
+         * @return Le maillage.
+         * @throw std::invalid_argument Si un paramètre est invalide.
+         */
+        static Mesh3D planeGrid(float width, float depth, int columns, int rows, const Couleur& color);
+};
+
+#endif // MESH3D_H
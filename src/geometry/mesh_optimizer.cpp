@@ -0,0 +1,198 @@
+#include "mesh_optimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    // Paramètres de Forsyth : cache LRU simulé et forme des scores
+    constexpr size_t FORSYTH_CACHE_SIZE = 32;
+    constexpr float CACHE_DECAY_POWER = 1.5f;
+    constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+    constexpr float VALENCE_BOOST_SCALE = 2.0f;
+    constexpr float VALENCE_BOOST_POWER = 0.5f;
+    constexpr uint32_t NO_TRIANGLE = UINT32_MAX;
+
+    // Score d'un sommet : récemment utilisé, et encore utilisé par peu de triangles
+    float vertexScore(int cachePosition, uint32_t remainingTriangles) {
+        if (remainingTriangles == 0) {
+            return -1.0f;
+        }
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // Les sommets du dernier triangle : le suivant partagera une arête de toute façon
+                score = LAST_TRIANGLE_SCORE;
+            } else {
+                float scale = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+                score = std::pow(1.0f - (cachePosition - 3) * scale, CACHE_DECAY_POWER);
+            }
+        }
+        // Les sommets presque terminés sont privilégiés pour libérer le cache
+        return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+    }
+
+    void checkCacheSize(size_t cacheSize) {
+        if (cacheSize == 0) {
+            throw std::invalid_argument("La taille du cache de sommets doit être strictement positive.");
+        }
+    }
+
+    // Maillage aux mêmes sommets, triangles dans l'ordre donné
+    Mesh3D reorderTriangles(const Mesh3D& mesh, const std::vector<uint32_t>& order) {
+        Mesh3D result;
+        result.reserve(mesh.getVertexCount(), order.size());
+        for (const Point3D& position : mesh.getPositions()) {
+            result.addVertex(position);
+        }
+        const std::vector<uint32_t>& indices = mesh.getIndices();
+        for (uint32_t t : order) {
+            result.addTriangle(indices[3 * t], indices[3 * t + 1], indices[3 * t + 2], mesh.getFaceColor(t));
+        }
+        return result;
+    }
+}
+
+double MeshOptimizer::computeAcmr(const Mesh3D& mesh, size_t cacheSize) {
+    checkCacheSize(cacheSize);
+    if (mesh.getTriangleCount() == 0) {
+        return 0.0;
+    }
+    // FIFO : un sommet chargé au défaut n° k est évincé au défaut n° k + cacheSize
+    std::vector<int64_t> loadedAt(mesh.getVertexCount(), -1);
+    int64_t misses = 0;
+    for (uint32_t v : mesh.getIndices()) {
+        if (loadedAt[v] < 0 || misses - loadedAt[v] >= static_cast<int64_t>(cacheSize)) {
+            loadedAt[v] = misses++;
+        }
+    }
+    return static_cast<double>(misses) / mesh.getTriangleCount();
+}
+
+Mesh3D MeshOptimizer::optimizeVertexCache(const Mesh3D& mesh) {
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    const size_t vertexCount = mesh.getVertexCount();
+    const uint32_t triangleCount = static_cast<uint32_t>(mesh.getTriangleCount());
+
+    // Triangles non émis de chaque sommet, rangés de façon contiguë (les émis sont retirés par échange)
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (uint32_t v : indices) {
+        ++remaining[v];
+    }
+    std::vector<uint32_t> firstTriangle(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+    }
+    std::vector<uint32_t> vertexTriangles(indices.size());
+    std::vector<uint32_t> fill(firstTriangle.begin(), firstTriangle.end() - 1);
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            vertexTriangles[fill[indices[3 * t + k]]++] = t;
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> score(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        score[v] = vertexScore(-1, remaining[v]);
+    }
+    auto triangleScore = [&](uint32_t t) {
+        return score[indices[3 * t]] + score[indices[3 * t + 1]] + score[indices[3 * t + 2]];
+    };
+
+    std::vector<char> emitted(triangleCount, 0);
+    std::vector<uint32_t> order;
+    order.reserve(triangleCount);
+    std::vector<uint32_t> cache, nextCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    nextCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    uint32_t best = NO_TRIANGLE;
+    float bestScore = -1.0f;
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        if (triangleScore(t) > bestScore) {
+            bestScore = triangleScore(t);
+            best = t;
+        }
+    }
+    uint32_t cursor = 0; // Premier triangle peut-être non émis, pour repartir après une impasse
+
+    while (best != NO_TRIANGLE) {
+        emitted[best] = 1;
+        order.push_back(best);
+        const uint32_t* face = &indices[3 * best];
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t v = face[k];
+            uint32_t* begin = &vertexTriangles[firstTriangle[v]];
+            uint32_t* end = begin + remaining[v];
+            std::iter_swap(std::find(begin, end, best), end - 1);
+            --remaining[v];
+        }
+
+        // Le triangle émis passe en tête du cache LRU
+        nextCache.assign(face, face + 3);
+        for (uint32_t v : cache) {
+            if (v != face[0] && v != face[1] && v != face[2]) {
+                nextCache.push_back(v);
+            }
+        }
+        for (size_t i = 0; i < nextCache.size(); ++i) {
+            const uint32_t v = nextCache[i];
+            cachePosition[v] = i < FORSYTH_CACHE_SIZE ? static_cast<int>(i) : -1;
+            score[v] = vertexScore(cachePosition[v], remaining[v]);
+        }
+        if (nextCache.size() > FORSYTH_CACHE_SIZE) {
+            nextCache.resize(FORSYTH_CACHE_SIZE);
+        }
+        std::swap(cache, nextCache);
+
+        // Meilleur triangle parmi ceux qui touchent le cache
+        best = NO_TRIANGLE;
+        bestScore = -1.0f;
+        for (uint32_t v : cache) {
+            for (uint32_t i = 0; i < remaining[v]; ++i) {
+                const uint32_t t = vertexTriangles[firstTriangle[v] + i];
+                const float candidateScore = triangleScore(t);
+                if (candidateScore > bestScore) {
+                    bestScore = candidateScore;
+                    best = t;
+                }
+            }
+        }
+        if (best == NO_TRIANGLE) {
+            while (cursor < triangleCount && emitted[cursor]) {
+                ++cursor;
+            }
+            best = cursor < triangleCount ? cursor : NO_TRIANGLE;
+        }
+    }
+    return reorderTriangles(mesh, order);
+}
+
+Mesh3D MeshOptimizer::optimizeVertexFetch(const Mesh3D& mesh) {
+    constexpr uint32_t UNUSED = UINT32_MAX;
+    std::vector<uint32_t> remap(mesh.getVertexCount(), UNUSED);
+    Mesh3D result;
+    result.reserve(mesh.getVertexCount(), mesh.getTriangleCount());
+    for (uint32_t v : mesh.getIndices()) {
+        if (remap[v] == UNUSED) {
+            remap[v] = result.addVertex(mesh.getPositions()[v]);
+        }
+    }
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        result.addTriangle(remap[indices[3 * t]], remap[indices[3 * t + 1]], remap[indices[3 * t + 2]], mesh.getFaceColor(t));
+    }
+    return result;
+}
+
+Mesh3D MeshOptimizer::optimize(const Mesh3D& mesh, VertexCacheReport& report, size_t cacheSize) {
+    checkCacheSize(cacheSize);
+    report = VertexCacheReport();
+    report.cacheSize = cacheSize;
+    report.acmrBefore = computeAcmr(mesh, cacheSize);
+    Mesh3D optimized = optimizeVertexFetch(optimizeVertexCache(mesh));
+    report.acmrAfter = computeAcmr(optimized, cacheSize);
+    return optimized;
+}
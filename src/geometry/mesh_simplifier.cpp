@@ -0,0 +1,358 @@
+#include "mesh_simplifier.h"
+#include "thread_pool.h"
+#include "vertex_welder.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+    // Poids des plans de contrainte des bords ouverts, relatif aux plans des faces
+    constexpr double BOUNDARY_WEIGHT = 1000.0;
+
+    // Forme quadratique symétrique 4x4, stockée par ses dix coefficients :
+    // a00 a01 a02 a03 a11 a12 a13 a22 a23 a33
+    struct Quadric {
+        double q[10] = {};
+
+        // Ajoute le carré de la distance au plan ax + by + cz + d = 0 (normale unitaire)
+        void addPlane(double a, double b, double c, double d, double weight) {
+            q[0] += weight * a * a; q[1] += weight * a * b; q[2] += weight * a * c; q[3] += weight * a * d;
+            q[4] += weight * b * b; q[5] += weight * b * c; q[6] += weight * b * d;
+            q[7] += weight * c * c; q[8] += weight * c * d;
+            q[9] += weight * d * d;
+        }
+
+        Quadric operator+(const Quadric& other) const {
+            Quadric sum = *this;
+            for (int i = 0; i < 10; ++i) {
+                sum.q[i] += other.q[i];
+            }
+            return sum;
+        }
+
+        double evaluate(const Point3D& p) const {
+            double x = p.getX(), y = p.getY(), z = p.getZ();
+            return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x
+                 + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y
+                 + q[7] * z * z + 2 * q[8] * z
+                 + q[9];
+        }
+
+        // Point qui minimise la forme, si la partie 3x3 est inversible
+        bool minimizer(Point3D& out) const {
+            double a = q[0], b = q[1], c = q[2], d = q[4], e = q[5], f = q[7];
+            double i00 = d * f - e * e, i01 = c * e - b * f, i02 = b * e - c * d;
+            double i11 = a * f - c * c, i12 = b * c - a * e, i22 = a * d - b * b;
+            double det = a * i00 + b * i01 + c * i02;
+            double scale = std::fabs(a) + std::fabs(d) + std::fabs(f);
+            if (std::fabs(det) <= 1e-9 * scale * scale * scale) {
+                return false;
+            }
+            double r0 = -q[3], r1 = -q[6], r2 = -q[8];
+            out = Point3D(static_cast<float>((i00 * r0 + i01 * r1 + i02 * r2) / det),
+                          static_cast<float>((i01 * r0 + i11 * r1 + i12 * r2) / det),
+                          static_cast<float>((i02 * r0 + i12 * r1 + i22 * r2) / det));
+            return true;
+        }
+    };
+
+    // Contraction candidate de l'arête (u, v) : v disparaît, u prend la position target
+    struct Candidate {
+        double cost;
+        uint32_t u, v;
+        uint32_t versionU, versionV; // Versions des sommets au calcul : périmée si l'un a changé depuis.
+        Point3D target;
+
+        // Coût croissant, puis indices : l'ordre des contractions est déterministe
+        bool operator>(const Candidate& other) const {
+            return std::tie(cost, u, v) > std::tie(other.cost, other.u, other.v);
+        }
+    };
+
+    using Face = std::array<uint32_t, 3>;
+
+    uint64_t edgeKey(uint32_t a, uint32_t b) {
+        return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+
+    Point3D faceNormal(const Point3D& a, const Point3D& b, const Point3D& c) {
+        return (b - a).crossProduct(c - a);
+    }
+
+    class Simplification {
+        private:
+            std::vector<Point3D> positions;
+            std::vector<Quadric> quadrics;
+            std::vector<uint32_t> versions;
+            std::vector<char> vertexAlive;
+            std::vector<std::vector<uint32_t>> vertexFaces; // Faces incidentes (y compris mortes, filtrées à l'usage).
+            std::vector<Face> faces;
+            std::vector<Couleur> colors;
+            std::vector<char> faceAlive;
+            size_t liveFaces = 0;
+            std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> heap;
+
+            bool contains(const Face& face, uint32_t vertex) const {
+                return face[0] == vertex || face[1] == vertex || face[2] == vertex;
+            }
+
+            // Sommets voisins de u par les faces vivantes, triés et sans doublon
+            std::vector<uint32_t> neighbors(uint32_t u) const {
+                std::vector<uint32_t> result;
+                for (uint32_t f : vertexFaces[u]) {
+                    if (!faceAlive[f]) {
+                        continue;
+                    }
+                    for (uint32_t w : faces[f]) {
+                        if (w != u) {
+                            result.push_back(w);
+                        }
+                    }
+                }
+                std::sort(result.begin(), result.end());
+                result.erase(std::unique(result.begin(), result.end()), result.end());
+                return result;
+            }
+
+            Candidate makeCandidate(uint32_t u, uint32_t v) const {
+                Quadric q = quadrics[u] + quadrics[v];
+                Point3D best = positions[u];
+                double bestCost = q.evaluate(best);
+                Point3D options[3] = {positions[v], (positions[u] + positions[v]) * 0.5f, Point3D()};
+                int optionCount = q.minimizer(options[2]) ? 3 : 2;
+                for (int i = 0; i < optionCount; ++i) {
+                    double cost = q.evaluate(options[i]);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        best = options[i];
+                    }
+                }
+                return Candidate{std::max(bestCost, 0.0), u, v, versions[u], versions[v], best};
+            }
+
+            // Refuse les contractions qui pincent la surface ou retournent une face
+            bool canCollapse(uint32_t u, uint32_t v, const Point3D& target) const {
+                size_t sharedFaces = 0;
+                for (uint32_t f : vertexFaces[u]) {
+                    if (faceAlive[f] && contains(faces[f], v)) {
+                        ++sharedFaces;
+                    }
+                }
+                if (sharedFaces == 0) {
+                    return false;
+                }
+                std::vector<uint32_t> linkU = neighbors(u);
+                std::vector<uint32_t> linkV = neighbors(v);
+                std::vector<uint32_t> common;
+                std::set_intersection(linkU.begin(), linkU.end(), linkV.begin(), linkV.end(), std::back_inserter(common));
+                if (common.size() > sharedFaces) {
+                    return false;
+                }
+                for (uint32_t moved : {u, v}) {
+                    for (uint32_t f : vertexFaces[moved]) {
+                        const Face& face = faces[f];
+                        if (!faceAlive[f] || (contains(face, u) && contains(face, v))) {
+                            continue;
+                        }
+                        Point3D p[3];
+                        for (int k = 0; k < 3; ++k) {
+                            p[k] = face[k] == moved ? target : positions[face[k]];
+                        }
+                        Point3D before = faceNormal(positions[face[0]], positions[face[1]], positions[face[2]]);
+                        if (before.dotProduct(faceNormal(p[0], p[1], p[2])) <= 0.0f) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+
+            void collapse(uint32_t u, uint32_t v, const Point3D& target) {
+                positions[u] = target;
+                quadrics[u] = quadrics[u] + quadrics[v];
+                for (uint32_t f : vertexFaces[v]) {
+                    if (!faceAlive[f]) {
+                        continue;
+                    }
+                    Face& face = faces[f];
+                    if (contains(face, u)) {
+                        faceAlive[f] = false;
+                        --liveFaces;
+                        continue;
+                    }
+                    std::replace(face.begin(), face.end(), v, u);
+                    vertexFaces[u].push_back(f);
+                }
+                vertexFaces[v].clear();
+                vertexAlive[v] = false;
+
+                auto& incident = vertexFaces[u];
+                incident.erase(std::remove_if(incident.begin(), incident.end(), [this](uint32_t f) { return !faceAlive[f]; }), incident.end());
+                ++versions[u];
+                for (uint32_t w : neighbors(u)) {
+                    heap.push(makeCandidate(u, w));
+                }
+            }
+
+        public:
+            explicit Simplification(const Mesh3D& mesh) {
+                // Fusion des sommets confondus
+                VertexWelder welder;
+                welder.reserve(mesh.getVertexCount());
+                std::vector<uint32_t> remap(mesh.getVertexCount());
+                for (size_t i = 0; i < mesh.getVertexCount(); ++i) {
+                    remap[i] = welder.insert(mesh.getPositions()[i]);
+                }
+                positions = welder.getPositions();
+
+                const std::vector<uint32_t>& indices = mesh.getIndices();
+                for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+                    Face face = {remap[indices[3 * t]], remap[indices[3 * t + 1]], remap[indices[3 * t + 2]]};
+                    if (face[0] == face[1] || face[1] == face[2] || face[0] == face[2]) {
+                        continue;
+                    }
+                    faces.push_back(face);
+                    colors.push_back(mesh.getFaceColor(t));
+                }
+                liveFaces = faces.size();
+                faceAlive.assign(faces.size(), 1);
+
+                const size_t vertexCount = positions.size();
+                quadrics.assign(vertexCount, Quadric());
+                versions.assign(vertexCount, 0);
+                vertexAlive.assign(vertexCount, 1);
+                vertexFaces.assign(vertexCount, {});
+
+                // Plans des faces, pondérés par leur aire ; nombre de faces par arête
+                std::unordered_map<uint64_t, int> edgeFaces;
+                for (uint32_t f = 0; f < faces.size(); ++f) {
+                    const Face& face = faces[f];
+                    Point3D normal = faceNormal(positions[face[0]], positions[face[1]], positions[face[2]]);
+                    float length = normal.norm();
+                    if (length > 0.0f) {
+                        Point3D unit = normal * (1.0f / length);
+                        double d = -unit.dotProduct(positions[face[0]]);
+                        for (uint32_t vertex : face) {
+                            quadrics[vertex].addPlane(unit.getX(), unit.getY(), unit.getZ(), d, length / 2.0);
+                        }
+                    }
+                    for (int k = 0; k < 3; ++k) {
+                        vertexFaces[face[k]].push_back(f);
+                        ++edgeFaces[edgeKey(face[k], face[(k + 1) % 3])];
+                    }
+                }
+
+                // Bords ouverts : plan contenant l'arête, perpendiculaire à la face
+                for (const Face& face : faces) {
+                    Point3D unit = faceNormal(positions[face[0]], positions[face[1]], positions[face[2]]).normalized();
+                    for (int k = 0; k < 3; ++k) {
+                        uint32_t a = face[k], b = face[(k + 1) % 3];
+                        if (edgeFaces[edgeKey(a, b)] != 1) {
+                            continue;
+                        }
+                        Point3D edge = positions[b] - positions[a];
+                        Point3D side = edge.crossProduct(unit).normalized();
+                        double d = -side.dotProduct(positions[a]);
+                        double weight = BOUNDARY_WEIGHT * edge.dotProduct(edge);
+                        quadrics[a].addPlane(side.getX(), side.getY(), side.getZ(), d, weight);
+                        quadrics[b].addPlane(side.getX(), side.getY(), side.getZ(), d, weight);
+                    }
+                }
+
+                // Une contraction candidate par arête
+                for (const Face& face : faces) {
+                    for (int k = 0; k < 3; ++k) {
+                        uint32_t a = face[k], b = face[(k + 1) % 3];
+                        int& count = edgeFaces[edgeKey(a, b)];
+                        if (count > 0) {
+                            heap.push(makeCandidate(std::min(a, b), std::max(a, b)));
+                            count = 0;
+                        }
+                    }
+                }
+            }
+
+            void run(size_t targetTriangles) {
+                while (liveFaces > targetTriangles && !heap.empty()) {
+                    Candidate candidate = heap.top();
+                    heap.pop();
+                    const uint32_t u = candidate.u, v = candidate.v;
+                    if (!vertexAlive[u] || !vertexAlive[v] || versions[u] != candidate.versionU || versions[v] != candidate.versionV) {
+                        continue;
+                    }
+                    if (canCollapse(u, v, candidate.target)) {
+                        collapse(u, v, candidate.target);
+                    }
+                }
+            }
+
+            Mesh3D result() const {
+                std::vector<char> used(positions.size(), 0);
+                for (size_t f = 0; f < faces.size(); ++f) {
+                    if (faceAlive[f]) {
+                        for (uint32_t vertex : faces[f]) {
+                            used[vertex] = 1;
+                        }
+                    }
+                }
+                Mesh3D mesh;
+                mesh.reserve(std::count(used.begin(), used.end(), 1), liveFaces);
+                std::vector<uint32_t> newIndex(positions.size(), 0);
+                for (uint32_t vertex = 0; vertex < positions.size(); ++vertex) {
+                    if (used[vertex]) {
+                        newIndex[vertex] = mesh.addVertex(positions[vertex]);
+                    }
+                }
+                for (size_t f = 0; f < faces.size(); ++f) {
+                    if (faceAlive[f]) {
+                        const Face& face = faces[f];
+                        mesh.addTriangle(newIndex[face[0]], newIndex[face[1]], newIndex[face[2]], colors[f]);
+                    }
+                }
+                return mesh;
+            }
+    };
+
+    void checkTargets(const std::vector<size_t>& targetTriangles) {
+        for (size_t i = 1; i < targetTriangles.size(); ++i) {
+            if (targetTriangles[i] >= targetTriangles[i - 1]) {
+                throw std::invalid_argument("Les nombres de triangles visés doivent être strictement décroissants.");
+            }
+        }
+    }
+}
+
+Mesh3D MeshSimplifier::simplify(const Mesh3D& mesh, size_t targetTriangles) {
+    Simplification simplification(mesh);
+    simplification.run(targetTriangles);
+    return simplification.result();
+}
+
+std::vector<Mesh3D> MeshSimplifier::buildLodChain(const Mesh3D& mesh, const std::vector<size_t>& targetTriangles) {
+    checkTargets(targetTriangles);
+    std::vector<Mesh3D> chain;
+    chain.reserve(targetTriangles.size());
+    for (size_t target : targetTriangles) {
+        chain.push_back(simplify(chain.empty() ? mesh : chain.back(), target));
+    }
+    return chain;
+}
+
+std::vector<std::vector<Mesh3D>> MeshSimplifier::buildLodChains(const std::vector<Mesh3D>& meshes, const std::vector<size_t>& targetTriangles) {
+    checkTargets(targetTriangles);
+    std::vector<std::vector<Mesh3D>> chains(meshes.size());
+    // Un maillage par bloc : chaque chaîne est calculée entièrement par un seul thread
+    ThreadPool::shared().parallelFor(meshes.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            chains[i] = buildLodChain(meshes[i], targetTriangles);
+        }
+    });
+    return chains;
+}
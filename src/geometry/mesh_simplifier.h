@@ -0,0 +1,64 @@
+/**
+ * @file mesh_simplifier.h
+ * @brief Déclaration de la classe MeshSimplifier : simplification de maillages par contraction d'arêtes.
+ *
+ * La simplification suit la métrique d'erreur quadrique (Garland et Heckbert) : chaque sommet
+ * accumule les plans de ses faces, et l'arête dont la contraction écarte le moins la surface
+ * de ces plans est contractée en premier. Elle sert à produire automatiquement des niveaux de
+ * détail pour les maillages importés ou générés trop fins.
+ */
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include "mesh3d.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class MeshSimplifier
+ * @brief Simplification de maillages indexés et construction de chaînes de niveaux de détail.
+ *
+ * Les sommets confondus (à DEFAULT_WELD_TOLERANCE près) sont d'abord fusionnés, pour que les maillages issus de
+ * Mesh3D::fromQuads (quatre sommets par quadrilatère) soient simplifiés sans se fissurer.
+ * Une contraction est refusée si elle retourne une face ou pince la surface. Les bords
+ * ouverts sont retenus par des plans de contrainte perpendiculaires aux faces.
+ * Chaque face conserve sa couleur.
+ */
+class MeshSimplifier {
+    public:
+        /**
+         * @brief Simplifie un maillage jusqu'à un nombre de triangles.
+         *
+         * Le résultat peut garder plus de triangles que demandé si plus aucune contraction
+         * n'est possible sans retourner de face.
+         *
+         * @param mesh Le maillage à simplifier.
+         * @param targetTriangles Le nombre de triangles visé.
+         * @return Le maillage simplifié (sommets fusionnés, triangles dégénérés supprimés).
+         */
+        static Mesh3D simplify(const Mesh3D& mesh, size_t targetTriangles);
+
+        /**
+         * @brief Construit une chaîne de niveaux de détail, chaque niveau simplifiant le précédent.
+         * @param mesh Le maillage complet.
+         * @param targetTriangles Les nombres de triangles visés, strictement décroissants.
+         * @return Un maillage par nombre visé, dans le même ordre.
+         * @throw std::invalid_argument Si les nombres visés ne sont pas strictement décroissants.
+         */
+        static std::vector<Mesh3D> buildLodChain(const Mesh3D& mesh, const std::vector<size_t>& targetTriangles);
+
+        /**
+         * @brief Construit les chaînes de niveaux de détail de plusieurs maillages indépendants,
+         * répartis sur la réserve de threads partagée.
+         *
+         * Le résultat ne dépend pas du nombre de threads.
+         *
+         * @param meshes Les maillages complets.
+         * @param targetTriangles Les nombres de triangles visés, strictement décroissants.
+         * @return Pour chaque maillage, sa chaîne de niveaux de détail.
+         * @throw std::invalid_argument Si les nombres visés ne sont pas strictement décroissants.
+         */
+        static std::vector<std::vector<Mesh3D>> buildLodChains(const std::vector<Mesh3D>& meshes, const std::vector<size_t>& targetTriangles);
+};
+
+#endif // MESH_SIMPLIFIER_H
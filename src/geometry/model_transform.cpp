@@ -0,0 +1,64 @@
+#include "model_transform.h"
+#include <stdexcept>
+
+ModelTransform::ModelTransform(const Point3D& position, const Quaternion& orientation, float scale)
+    : position(position), orientation(orientation.normalized()), scale(scale) {
+    if (scale <= 0) {
+        throw std::invalid_argument("L'échelle doit être strictement positive.");
+    }
+}
+
+void ModelTransform::setScale(float newScale) {
+    if (newScale <= 0) {
+        throw std::invalid_argument("L'échelle doit être strictement positive.");
+    }
+    scale = newScale;
+}
+
+// Rotation autour d'un centre : l'orientation et la position tournent ensemble.
+// Le quaternion est renormalisé pour éviter toute dérive après de nombreuses rotations.
+void ModelTransform::rotate(const Quaternion& rotation, const Point3D& center) {
+    orientation = (rotation * orientation).normalized();
+    position = center + rotation.rotate(position - center);
+}
+
+void ModelTransform::scaleBy(float factor, const Point3D& center) {
+    if (factor <= 0) {
+        throw std::invalid_argument("Le facteur d'échelle doit être strictement positif.");
+    }
+    scale *= factor;
+    position = center + (position - center) * factor;
+}
+
+// M = T * R * S
+Transform3D ModelTransform::toTransform3D() const {
+    return Transform3D::scaling(scale)
+        .then(Transform3D::rotation(orientation))
+        .then(Transform3D::translation(position));
+}
+
+// M^-1 = S^-1 * R^-1 * T^-1
+Transform3D ModelTransform::toInverseTransform3D() const {
+    return Transform3D::translation(Point3D() - position)
+        .then(Transform3D::rotation(orientation.conjugate()))
+        .then(Transform3D::scaling(1.0f / scale));
+}
+
+// Inverse de T * R * S : S^-1 * R^-1 * T^-1, soit une position de -R^-1(position) / scale
+ModelTransform ModelTransform::inverse() const {
+    const Quaternion conjugate = orientation.conjugate();
+    return ModelTransform(conjugate.rotate(Point3D() - position) / scale, conjugate, 1.0f / scale);
+}
+
+ModelTransform operator*(const ModelTransform& parent, const ModelTransform& child) {
+    return ModelTransform(parent.apply(child.position),
+                          parent.orientation * child.orientation,
+                          parent.scale * child.scale);
+}
+
+std::ostream& operator<<(std::ostream& os, const ModelTransform& model) {
+    os << "ModelTransform[Position: " << model.getPosition()
+       << ", Orientation: " << model.getOrientation()
+       << ", Scale: " << model.getScale() << "]";
+    return os;
+}
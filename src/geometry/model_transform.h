@@ -0,0 +1,144 @@
+/**
+ * @file model_transform.h
+ * @brief Déclaration de la classe ModelTransform, la transformation de modèle d'un objet 3D.
+ *
+ * Un objet garde sa géométrie en espace objet (immuable) et une transformation de modèle
+ * (position, orientation, échelle). Déplacer ou tourner l'objet ne modifie que cette
+ * transformation, en O(1) ; elle n'est appliquée aux sommets qu'au moment de la projection.
+ */
+#ifndef MODEL_TRANSFORM_H
+#define MODEL_TRANSFORM_H
+
+#include "point3d.h"
+#include "quaternion.h"
+#include "transform3d.h"
+#include <iostream>
+
+/**
+ * @class ModelTransform
+ * @brief Transformation de modèle : échelle uniforme, puis rotation, puis translation.
+ *
+ * Un point `p` de l'espace objet est placé dans le monde en
+ * `position + orientation.rotate(p * scale)`.
+ */
+class ModelTransform {
+    private:
+        Point3D position;        // Position de l'origine de l'espace objet dans le monde.
+        Quaternion orientation;  // Orientation (quaternion unitaire).
+        float scale;             // Facteur d'échelle uniforme (strictement positif).
+
+    public:
+        /**
+         * @brief Constructeur (par défaut : transformation identité).
+         * @param position La position dans le monde.
+         * @param orientation L'orientation (quaternion unitaire).
+         * @param scale Le facteur d'échelle uniforme.
+         * @throw std::invalid_argument Si l'échelle n'est pas strictement positive.
+         */
+        ModelTransform(const Point3D& position = Point3D(), const Quaternion& orientation = Quaternion(), float scale = 1.0f);
+
+        const Point3D& getPosition() const { return position; }
+        const Quaternion& getOrientation() const { return orientation; }
+        float getScale() const { return scale; }
+
+        /**
+         * @brief Modifie la position.
+         * @param newPosition La nouvelle position.
+         */
+        void setPosition(const Point3D& newPosition) { position = newPosition; }
+
+        /**
+         * @brief Modifie l'orientation.
+         * @param newOrientation La nouvelle orientation (normalisée par la méthode).
+         */
+        void setOrientation(const Quaternion& newOrientation) { orientation = newOrientation.normalized(); }
+
+        /**
+         * @brief Modifie l'échelle.
+         * @param newScale Le nouveau facteur d'échelle.
+         * @throw std::invalid_argument Si l'échelle n'est pas strictement positive.
+         */
+        void setScale(float newScale);
+
+        /**
+         * @brief Translate l'objet dans le monde.
+         * @param offset Le vecteur de translation.
+         */
+        void translate(const Point3D& offset) { position = position + offset; }
+
+        /**
+         * @brief Tourne l'objet autour d'un centre exprimé dans le monde.
+         * @param rotation La rotation (quaternion unitaire).
+         * @param center Le centre de rotation.
+         */
+        void rotate(const Quaternion& rotation, const Point3D& center);
+
+        /**
+         * @brief Tourne l'objet autour d'un axe principal passant par un centre.
+         * @param angle L'angle de rotation en radians.
+         * @param axis L'axe de rotation ('x', 'y' ou 'z').
+         * @param center Le centre de rotation.
+         * @throw std::invalid_argument Si l'axe est invalide.
+         */
+        void rotate(float angle, char axis, const Point3D& center) {
+            rotate(Quaternion::fromAxisAngle(axis, angle), center);
+        }
+
+        /**
+         * @brief Met l'objet à l'échelle autour d'un centre exprimé dans le monde.
+         * @param factor Le facteur d'échelle.
+         * @param center Le centre de la mise à l'échelle.
+         * @throw std::invalid_argument Si le facteur n'est pas strictement positif.
+         */
+        void scaleBy(float factor, const Point3D& center);
+
+        /**
+         * @brief Place un point de l'espace objet dans le monde.
+         * @param p Le point en espace objet.
+         * @return Le point dans le monde.
+         */
+        Point3D apply(const Point3D& p) const { return position + orientation.rotate(p * scale); }
+
+        /**
+         * @brief Ramène un point du monde dans l'espace objet.
+         * @param p Le point dans le monde.
+         * @return Le point en espace objet.
+         */
+        Point3D applyInverse(const Point3D& p) const { return orientation.conjugate().rotate(p - position) / scale; }
+
+        /**
+         * @brief Convertit la transformation en matrice 3x4 (objet vers monde).
+         * @return La matrice correspondante.
+         */
+        Transform3D toTransform3D() const;
+
+        /**
+         * @brief Convertit la transformation inverse en matrice 3x4 (monde vers objet).
+         * @return La matrice correspondante.
+         */
+        Transform3D toInverseTransform3D() const;
+
+        /**
+         * @brief Retourne la transformation inverse (monde vers objet).
+         * @return La transformation telle que `inverse().apply(apply(p)) == p`.
+         */
+        ModelTransform inverse() const;
+
+        /**
+         * @brief Composition : `(parent * child)` place d'abord dans le repère du parent, puis dans le monde.
+         * @param parent La transformation du parent.
+         * @param child La transformation de l'enfant, relative au parent.
+         * @return La transformation composée.
+         */
+        friend ModelTransform operator*(const ModelTransform& parent, const ModelTransform& child);
+
+        /**
+         * @brief Surcharge de l'opérateur d'insertion pour afficher la transformation.
+         * @param os Le flux de sortie.
+         * @param model La transformation à afficher.
+         * @return Le flux de sortie modifié.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const ModelTransform& model);
+};
+
+#endif // MODEL_TRANSFORM_H
@@ -140,24 +140,16 @@ int main(int argc, char* argv[]) {
                         translation2D = translation2D + Point2D(MOVE_STEP, 0);
                         break;
                     case SDLK_a:
-                        for (auto& quad : sphere.getQuads()) {
-                            quad.rotate(ROTATE_STEP, 'x', sphere.getCenter());
-                        }
+                        sphere.rotate(ROTATE_STEP, 'x', sphere.getCenter());
                         break;
                     case SDLK_z:
-                        for (auto& quad : sphere.getQuads()) {
-                            quad.rotate(-ROTATE_STEP, 'x', sphere.getCenter());
-                        }
+                        sphere.rotate(-ROTATE_STEP, 'x', sphere.getCenter());
                         break;
                     case SDLK_e:
-                        for (auto& quad : sphere.getQuads()) {
-                            quad.rotate(ROTATE_STEP, 'y', sphere.getCenter());
-                        }
+                        sphere.rotate(ROTATE_STEP, 'y', sphere.getCenter());
                         break;
                     case SDLK_r:
-                        for (auto& quad : sphere.getQuads()) {
-                            quad.rotate(-ROTATE_STEP, 'y', sphere.getCenter());
-                        }
+                        sphere.rotate(-ROTATE_STEP, 'y', sphere.getCenter());
                         break;
                 }
             }
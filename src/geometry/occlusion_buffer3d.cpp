@@ -0,0 +1,232 @@
+#include "occlusion_buffer3d.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Coordonnée de pixel bornée au tampon (les coordonnées démesurées ne débordent pas l'entier)
+int clampPixel(float value, int limit) {
+    return static_cast<int>(std::clamp(value, 0.0f, static_cast<float>(limit)));
+}
+
+} // namespace
+
+OcclusionBuffer3D::OcclusionBuffer3D(int width, int height)
+    : width(width), height(height), projectionPlaneDistance(1.0f), scaleX(1.0f), scaleY(1.0f), offsetX(0.0f), offsetY(0.0f) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Les dimensions du tampon d'occlusion doivent être strictement positives.");
+    }
+    depths.assign(static_cast<size_t>(width) * height, std::numeric_limits<float>::infinity());
+}
+
+void OcclusionBuffer3D::begin(const Point3D& eye, float projectionPlaneDistance, float screenWidth, float screenHeight,
+                              const Point2D& screenOffset) {
+    if (projectionPlaneDistance <= 0 || screenWidth <= 0 || screenHeight <= 0) {
+        throw std::invalid_argument("Les paramètres de la projection doivent être strictement positifs.");
+    }
+    this->eye = eye;
+    this->projectionPlaneDistance = projectionPlaneDistance;
+    scaleX = width / screenWidth;
+    scaleY = height / screenHeight;
+    offsetX = screenOffset.getX() * scaleX;
+    offsetY = screenOffset.getY() * scaleY;
+    std::fill(depths.begin(), depths.end(), std::numeric_limits<float>::infinity());
+    stats = OcclusionStats();
+}
+
+// Même projection que le rendu, mise à l'échelle du tampon
+bool OcclusionBuffer3D::project(const Point3D& point, float& x, float& y, float& w) const {
+    const Point3D d = point - eye;
+    if (d.getZ() <= 0) {
+        return false;
+    }
+    w = projectionPlaneDistance + d.getZ();
+    const float s = projectionPlaneDistance / w;
+    x = d.getX() * s * scaleX + width * 0.5f + offsetX;
+    y = d.getY() * s * scaleY + height * 0.5f + offsetY;
+    return true;
+}
+
+// Un pixel est couvert si ses quatre coins sont du côté intérieur de chaque arête : le carré est alors
+// dans le polygone (dans son noyau s'il n'est pas convexe). L'inverse de la profondeur étant affine à
+// l'écran sur le plan de chaque triangle de l'éventail, son minimum sur le pixel est atteint en un coin :
+// la profondeur écrite est la plus lointaine du polygone sur le pixel.
+void OcclusionBuffer3D::rasterize(const Point3D* vertices, int count) {
+    float x[4], y[4], w[4];
+    for (int i = 0; i < count; ++i) {
+        if (!project(vertices[i], x[i], y[i], w[i])) {
+            return;
+        }
+    }
+    // Un quadrilatère est remis dans l'ordre angulaire autour de son centre, à l'écran
+    if (count == 4) {
+        const float cx = (x[0] + x[1] + x[2] + x[3]) * 0.25f, cy = (y[0] + y[1] + y[2] + y[3]) * 0.25f;
+        int order[4] = {0, 1, 2, 3};
+        float angle[4];
+        for (int i = 0; i < 4; ++i) {
+            angle[i] = std::atan2(y[i] - cy, x[i] - cx);
+        }
+        std::sort(order, order + 4, [&angle](int a, int b) { return angle[a] < angle[b]; });
+        float sx[4], sy[4], sw[4];
+        for (int i = 0; i < 4; ++i) {
+            sx[i] = x[order[i]];
+            sy[i] = y[order[i]];
+            sw[i] = w[order[i]];
+        }
+        std::copy(sx, sx + 4, x);
+        std::copy(sy, sy + 4, y);
+        std::copy(sw, sw + 4, w);
+    }
+    float area = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const int j = (i + 1) % count;
+        area += x[i] * y[j] - x[j] * y[i];
+    }
+    if (std::fabs(area) < 1e-6f) {
+        return;
+    }
+    stats.occluderTriangles += count - 2;
+
+    // Pixels dont le carré est dans la boîte du polygone
+    const float minX = *std::min_element(x, x + count), maxX = *std::max_element(x, x + count);
+    const float minY = *std::min_element(y, y + count), maxY = *std::max_element(y, y + count);
+    const int x0 = clampPixel(std::ceil(minX), width);
+    const int x1 = clampPixel(std::floor(maxX), width);
+    const int y0 = clampPixel(std::ceil(minY), height);
+    const int y1 = clampPixel(std::floor(maxY), height);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    // Arêtes orientées vers l'intérieur : a x + b y + c >= 0
+    float edgeA[4], edgeB[4], edgeC[4];
+    const float orientation = area > 0 ? 1.0f : -1.0f;
+    for (int i = 0; i < count; ++i) {
+        const int j = (i + 1) % count;
+        edgeA[i] = (y[i] - y[j]) * orientation;
+        edgeB[i] = (x[j] - x[i]) * orientation;
+        edgeC[i] = (x[i] * y[j] - x[j] * y[i]) * orientation;
+    }
+    // Inverse de la profondeur sur le plan de chaque triangle de l'éventail : p x + q y + r
+    float planeP[2], planeQ[2], planeR[2];
+    const int planeCount = count - 2;
+    for (int t = 0; t < planeCount; ++t) {
+        const int a = 0, b = t + 1, c = t + 2;
+        const float ia = 1.0f / w[a], ib = 1.0f / w[b], ic = 1.0f / w[c];
+        const float det = (x[b] - x[a]) * (y[c] - y[a]) - (x[c] - x[a]) * (y[b] - y[a]);
+        if (std::fabs(det) < 1e-6f) {
+            planeP[t] = 0.0f;
+            planeQ[t] = 0.0f;
+            planeR[t] = std::min({ia, ib, ic});
+            continue;
+        }
+        planeP[t] = ((ib - ia) * (y[c] - y[a]) - (ic - ia) * (y[b] - y[a])) / det;
+        planeQ[t] = ((ic - ia) * (x[b] - x[a]) - (ib - ia) * (x[c] - x[a])) / det;
+        planeR[t] = ia - planeP[t] * x[a] - planeQ[t] * y[a];
+    }
+    // Inverse de la profondeur la plus lointaine en un coin de pixel, ou -1 hors du polygone
+    auto cornerInverseDepth = [&](float px, float py) {
+        for (int i = 0; i < count; ++i) {
+            if (edgeA[i] * px + edgeB[i] * py + edgeC[i] < 0) {
+                return -1.0f;
+            }
+        }
+        float inverse = planeP[0] * px + planeQ[0] * py + planeR[0];
+        for (int t = 1; t < planeCount; ++t) {
+            inverse = std::min(inverse, planeP[t] * px + planeQ[t] * py + planeR[t]);
+        }
+        return inverse;
+    };
+
+    for (int py = y0; py < y1; ++py) {
+        for (int px = x0; px < x1; ++px) {
+            const float c0 = cornerInverseDepth(static_cast<float>(px), static_cast<float>(py));
+            const float c1 = cornerInverseDepth(static_cast<float>(px + 1), static_cast<float>(py));
+            const float c2 = cornerInverseDepth(static_cast<float>(px), static_cast<float>(py + 1));
+            const float c3 = cornerInverseDepth(static_cast<float>(px + 1), static_cast<float>(py + 1));
+            const float nearestInverse = std::min({c0, c1, c2, c3});
+            if (nearestInverse <= 0) {
+                continue;
+            }
+            float& depth = depths[static_cast<size_t>(py) * width + px];
+            depth = std::min(depth, 1.0f / nearestInverse);
+        }
+    }
+}
+
+void OcclusionBuffer3D::addOccluder(const Triangle3D& triangle) {
+    const Point3D vertices[3] = {triangle.getP1(), triangle.getP2(), triangle.getP3()};
+    rasterize(vertices, 3);
+}
+
+// La face est rastérisée d'un seul tenant : les pixels à cheval sur sa diagonale restent couverts.
+// Ses sommets distincts sont lus sur les deux triangles, dont l'orientation a pu être inversée (orient).
+void OcclusionBuffer3D::addOccluder(const Quad3D& face) {
+    const Triangle3D& first = face.getFirstTriangle();
+    const Triangle3D& second = face.getSecondTriangle();
+    Point3D corners[4] = {first.getP1(), first.getP2(), first.getP3()};
+    int count = 3;
+    for (const Point3D& p : {second.getP1(), second.getP2(), second.getP3()}) {
+        if (count < 4 && !(p == corners[0]) && !(p == corners[1]) && !(p == corners[2])) {
+            corners[count++] = p;
+        }
+    }
+    if (count == 4) {
+        rasterize(corners, 4);
+    } else {
+        addOccluder(first);
+        addOccluder(second);
+    }
+}
+
+void OcclusionBuffer3D::addOccluder(const Pave3D& cube) {
+    for (const Quad3D& face : cube.getFaces()) {
+        addOccluder(face);
+    }
+    ++stats.occluders;
+}
+
+// La boîte est masquée si chaque pixel touché par sa projection a un occulteur plus proche que son coin le plus proche
+bool OcclusionBuffer3D::isOccluded(const BoundingBox3D& box) {
+    ++stats.tested;
+    if (box.isEmpty()) {
+        return false;
+    }
+    const Point3D& low = box.getMin();
+    const Point3D& high = box.getMax();
+    float minX = std::numeric_limits<float>::max(), minY = minX, maxX = -minX, maxY = -minX;
+    float nearest = minX;
+    for (int corner = 0; corner < 8; ++corner) {
+        const Point3D p((corner & 1) ? high.getX() : low.getX(), (corner & 2) ? high.getY() : low.getY(),
+                        (corner & 4) ? high.getZ() : low.getZ());
+        float x, y, w;
+        if (!project(p, x, y, w)) {
+            return false;
+        }
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        nearest = std::min(nearest, w);
+    }
+
+    const int x0 = clampPixel(std::floor(minX), width);
+    const int x1 = clampPixel(std::ceil(maxX), width);
+    const int y0 = clampPixel(std::floor(minY), height);
+    const int y1 = clampPixel(std::ceil(maxY), height);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+    for (int py = y0; py < y1; ++py) {
+        const float* row = &depths[static_cast<size_t>(py) * width];
+        for (int px = x0; px < x1; ++px) {
+            if (row[px] >= nearest) {
+                return false;
+            }
+        }
+    }
+    ++stats.occluded;
+    return true;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file occlusion_buffer3d.h
+ * @brief Déclaration de la classe OcclusionBuffer3D : tampon de profondeur conservatif pour l'élimination des objets masqués.
+ *
+ * Quelques grands objets (les occulteurs, par exemple des pavés) sont rastérisés dans un tampon de
+ * profondeur de faible résolution. Avant de soumettre les triangles d'un objet, sa boîte englobante
+ * est projetée à l'écran et comparée au tampon : si chaque pixel qu'elle couvre est déjà masqué par
+ * un occulteur plus proche, l'objet n'est pas rendu.
+ */
+#ifndef OCCLUSION_BUFFER3D_H
+#define OCCLUSION_BUFFER3D_H
+
+#include "point2d.h"
+#include "point3d.h"
+#include "triangle3d.h"
+#include "quad3d.h"
+#include "pave3d.h"
+#include "bounding_volume3d.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Résolution par défaut du tampon d'occlusion (environ un pixel pour 9 x 9 pixels d'un écran 1200 x 900).
+ */
+constexpr int DEFAULT_OCCLUSION_BUFFER_WIDTH = 128;
+constexpr int DEFAULT_OCCLUSION_BUFFER_HEIGHT = 96;
+
+/**
+ * @struct OcclusionStats
+ * @brief Bilan d'une image : occulteurs rastérisés et objets testés, masqués.
+ */
+struct OcclusionStats {
+    size_t occluders = 0;         ///< Objets rastérisés comme occulteurs.
+    size_t occluderTriangles = 0; ///< Triangles d'occulteurs rastérisés.
+    size_t tested = 0;            ///< Boîtes testées.
+    size_t occluded = 0;          ///< Boîtes entièrement masquées.
+
+    double occludedRatio() const { return tested > 0 ? static_cast<double>(occluded) / tested : 0.0; }
+};
+
+/**
+ * @class OcclusionBuffer3D
+ * @brief Tampon de profondeur de faible résolution, rempli de façon conservative par les occulteurs.
+ *
+ * La projection est celle du rendu (voir Frustum3D::fromProjection) : un point de position relative
+ * (dx, dy, dz) à l'œil est projeté en (dx, dy) * d / w, avec la profondeur w = d + dz, puis décalé de la
+ * translation de l'écran : le tampon couvre exactement l'écran dessiné. Un pixel n'est
+ * écrit que s'il est entièrement couvert par un triangle ou une face d'occulteur, avec la profondeur la
+ * plus lointaine de celui-ci sur ce pixel : une boîte déclarée masquée l'est donc réellement. Les
+ * triangles et les faces qui passent derrière l'œil sont ignorés, ce qui reste conservatif.
+ */
+class OcclusionBuffer3D {
+    private:
+        int width;                     // Largeur du tampon, en pixels.
+        int height;                    // Hauteur du tampon, en pixels.
+        std::vector<float> depths;     // Profondeur w de l'occulteur le plus proche, par pixel (infinie sans occulteur).
+
+        Point3D eye;                   // Position de l'œil.
+        float projectionPlaneDistance; // Distance du plan de projection.
+        float scaleX;                  // Pixels du tampon par pixel de l'écran, horizontalement.
+        float scaleY;                  // Pixels du tampon par pixel de l'écran, verticalement.
+        float offsetX;                 // Translation de l'écran, en pixels du tampon, horizontalement.
+        float offsetY;                 // Translation de l'écran, en pixels du tampon, verticalement.
+        OcclusionStats stats;          // Bilan de l'image courante.
+
+        // Position dans le tampon et profondeur w d'un point ; faux si le point n'est pas devant l'œil
+        bool project(const Point3D& point, float& x, float& y, float& w) const;
+
+        // Rastérise un triangle ou un quadrilatère plan et convexe (count = 3 ou 4, sommets dans un ordre quelconque)
+        void rasterize(const Point3D* vertices, int count);
+
+    public:
+        /**
+         * @brief Constructeur.
+         * @param width La largeur du tampon, en pixels.
+         * @param height La hauteur du tampon, en pixels.
+         * @throw std::invalid_argument Si une dimension n'est pas strictement positive.
+         */
+        explicit OcclusionBuffer3D(int width = DEFAULT_OCCLUSION_BUFFER_WIDTH, int height = DEFAULT_OCCLUSION_BUFFER_HEIGHT);
+
+        /**
+         * @brief Commence une image : vide le tampon, remet le bilan à zéro et fixe la projection.
+         * @param eye La position de l'œil.
+         * @param projectionPlaneDistance La distance du plan de projection.
+         * @param screenWidth La largeur de l'écran, en pixels.
+         * @param screenHeight La hauteur de l'écran, en pixels.
+         * @param screenOffset La translation en 2D appliquée aux points projetés, comme au rendu.
+         * @throw std::invalid_argument Si un paramètre n'est pas strictement positif.
+         */
+        void begin(const Point3D& eye, float projectionPlaneDistance, float screenWidth, float screenHeight,
+                   const Point2D& screenOffset = Point2D(0, 0));
+
+        /**
+         * @brief Rastérise un triangle d'occulteur, placé dans le monde.
+         * @param triangle Le triangle.
+         */
+        void addOccluder(const Triangle3D& triangle);
+
+        /**
+         * @brief Rastérise une face d'occulteur d'un seul tenant (sans fissure le long de sa diagonale).
+         * @param face La face, placée dans le monde.
+         */
+        void addOccluder(const Quad3D& face);
+
+        /**
+         * @brief Rastérise les six faces d'un pavé.
+         * @param cube Le pavé.
+         */
+        void addOccluder(const Pave3D& cube);
+
+        /**
+         * @brief Teste si une boîte est entièrement masquée par les occulteurs rastérisés.
+         *
+         * Une boîte qui passe derrière l'œil ou sort entièrement du tampon n'est jamais déclarée masquée.
+         *
+         * @param box La boîte englobante de l'objet.
+         * @return true si l'objet peut être omis.
+         */
+        bool isOccluded(const BoundingBox3D& box);
+
+        /**
+         * @brief Retourne le bilan de l'image courante (depuis begin).
+         */
+        const OcclusionStats& getStats() const { return stats; }
+
+        int getWidth() const { return width; }
+        int getHeight() const { return height; }
+
+        /**
+         * @brief Retourne la profondeur w stockée pour un pixel du tampon (infinie sans occulteur).
+         */
+        float depthAt(int x, int y) const { return depths[static_cast<size_t>(y) * width + x]; }
+};
+
+#endif // OCCLUSION_BUFFER3D_H
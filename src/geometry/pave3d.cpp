@@ -1,29 +1,40 @@
 #include "pave3d.h"
+#include "vertex_buffer3d.h"
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
 
 // Constructeur par défaut
-Pave3D::Pave3D() {
-    faces[0] = Quad3D(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), Couleur(255, 255, 255));
-    faces[1] = Quad3D(Point3D(0, 0, 1), Point3D(1, 0, 1), Point3D(1, 1, 1), Point3D(0, 1, 1), Couleur(255, 255, 255));
-    faces[2] = Quad3D(Point3D(0, 0, 0), Point3D(0, 1, 0), Point3D(0, 1, 1), Point3D(0, 0, 1), Couleur(255, 255, 255));
-    faces[3] = Quad3D(Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(1, 1, 1), Point3D(1, 0, 1), Couleur(255, 255, 255));
-    faces[4] = Quad3D(Point3D(0, 1, 0), Point3D(1, 1, 0), Point3D(1, 1, 1), Point3D(0, 1, 1), Couleur(255, 255, 255));
-    faces[5] = Quad3D(Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 0, 1), Point3D(0, 0, 1), Couleur(255, 255, 255));
-
-    validateGeometry();
+Pave3D::Pave3D() : faces(std::make_shared<std::array<Quad3D, 6>>()), model(), worldDirty(true), propertiesDirty(true) {
+    // Cube unité : valide par construction, les faces ne sont pas revalidées
+    std::array<Quad3D, 6>& faces = *this->faces;
+    const Couleur white(UNCHECKED, 255, 255, 255);
+    faces[0] = Quad3D(UNCHECKED, Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(0, 1, 0), white);
+    faces[1] = Quad3D(UNCHECKED, Point3D(0, 0, 1), Point3D(1, 0, 1), Point3D(1, 1, 1), Point3D(0, 1, 1), white);
+    faces[2] = Quad3D(UNCHECKED, Point3D(0, 0, 0), Point3D(0, 1, 0), Point3D(0, 1, 1), Point3D(0, 0, 1), white);
+    faces[3] = Quad3D(UNCHECKED, Point3D(1, 0, 0), Point3D(1, 1, 0), Point3D(1, 1, 1), Point3D(1, 0, 1), white);
+    faces[4] = Quad3D(UNCHECKED, Point3D(0, 1, 0), Point3D(1, 1, 0), Point3D(1, 1, 1), Point3D(0, 1, 1), white);
+    faces[5] = Quad3D(UNCHECKED, Point3D(0, 0, 0), Point3D(1, 0, 0), Point3D(1, 0, 1), Point3D(0, 0, 1), white);
 }
 
 // Constructeur paramétré
-Pave3D::Pave3D(const std::array<Quad3D, 6>& faces) : faces(faces) {
+Pave3D::Pave3D(const std::array<Quad3D, 6>& faces)
+    : faces(std::make_shared<std::array<Quad3D, 6>>(faces)), model(), worldDirty(true), propertiesDirty(true) {
     validateGeometry();
 }
 
 Pave3D::Pave3D(const Quad3D& front_quad, const Quad3D& back_quad, const Quad3D& left_quad, const Quad3D& right_quad, const Quad3D& top_quad, const Quad3D& bottom_quad)
-    : faces{front_quad, back_quad, left_quad, right_quad, top_quad, bottom_quad} {
+    : faces(std::make_shared<std::array<Quad3D, 6>>(std::array<Quad3D, 6>{front_quad, back_quad, left_quad, right_quad, top_quad, bottom_quad})),
+      model(), worldDirty(true), propertiesDirty(true) {
 }
 
-Pave3D::Pave3D(const Point3D& origin, float length, float width, float height, const Couleur& color) {
+Pave3D::Pave3D(const Point3D& origin, float length, float width, float height, const Couleur& color)
+    : faces(std::make_shared<std::array<Quad3D, 6>>()), model(), worldDirty(true), propertiesDirty(true) {
+    // Des dimensions non nulles suffisent à garantir des faces valides : elles ne sont pas revalidées
+    if (length == 0 || width == 0 || height == 0) {
+        throw std::runtime_error("Les dimensions du pavé doivent être non nulles.");
+    }
+    std::array<Quad3D, 6>& faces = *this->faces;
     Point3D p1 = origin;
     Point3D p2 = origin + Point3D(length, 0, 0);
     Point3D p3 = origin + Point3D(length, width, 0);
@@ -34,62 +45,143 @@ Pave3D::Pave3D(const Point3D& origin, float length, float width, float height, c
     Point3D p7 = origin + Point3D(length, width, height);
     Point3D p8 = origin + Point3D(0, width, height);
 
-    faces[0] = Quad3D(p1, p2, p3, p4, color); // Bas
-    faces[1] = Quad3D(p5, p6, p7, p8, color); // Haut
-    faces[2] = Quad3D(p1, p4, p8, p5, color); // Gauche
-    faces[3] = Quad3D(p2, p3, p7, p6, color); // Droite
-    faces[4] = Quad3D(p1, p2, p6, p5, color); // Avant
-    faces[5] = Quad3D(p4, p3, p7, p8, color); // Arrière
+    faces[0] = Quad3D(UNCHECKED, p1, p2, p3, p4, color); // Bas
+    faces[1] = Quad3D(UNCHECKED, p5, p6, p7, p8, color); // Haut
+    faces[2] = Quad3D(UNCHECKED, p1, p4, p8, p5, color); // Gauche
+    faces[3] = Quad3D(UNCHECKED, p2, p3, p7, p6, color); // Droite
+    faces[4] = Quad3D(UNCHECKED, p1, p2, p6, p5, color); // Avant
+    faces[5] = Quad3D(UNCHECKED, p4, p3, p7, p8, color); // Arrière
+}
+
+// Constructeur par copie : les faces sont partagées
+Pave3D::Pave3D(const Pave3D& other)
+    : faces(other.faces), model(other.model), worldDirty(true),
+      localArea(other.localArea), localVolume(other.localVolume), localBox(other.localBox),
+      localRadius(other.localRadius), propertiesDirty(other.propertiesDirty) {}
 
-    validateGeometry();
+// Copie-sur-écriture des faces partagées
+std::array<Quad3D, 6>& Pave3D::mutableFaces() {
+    if (faces.use_count() > 1) {
+        faces = std::make_shared<std::array<Quad3D, 6>>(*faces);
+    }
+    worldDirty = true;
+    propertiesDirty = true;
+    return *faces;
 }
 
-// Constructeur par copie
-Pave3D::Pave3D(const Pave3D& other) : faces(other.faces) {}
+void Pave3D::bakeModelTransform() {
+    std::array<Quad3D, 6> placed = getFaces();
+    mutableFaces() = placed;
+    model = ModelTransform();
+}
+
+// Faces placées dans le monde (recalculées à la demande)
+const std::array<Quad3D, 6>& Pave3D::getFaces() const {
+    if (worldDirty) {
+        Transform3D toWorld = model.toTransform3D();
+        worldFaces = *faces;
+        for (auto& face : worldFaces) {
+            face.transform(toWorld);
+        }
+        worldDirty = false;
+    }
+    return worldFaces;
+}
 
 // Accesseur pour une face
 const Quad3D& Pave3D::getFace(size_t index) const {
-    if (index >= faces.size()) {
+    if (index >= faces->size()) {
         throw std::out_of_range("Index hors limites pour les faces du pavé.");
     }
-    return faces[index];
+    return getFaces()[index];
 }
 
 // Accesseur modifiable pour une face
 Quad3D& Pave3D::getFace(size_t index) {
-    if (index >= faces.size()) {
+    if (index >= faces->size()) {
         throw std::out_of_range("Index hors limites pour les faces du pavé.");
     }
-    return faces[index];
+    bakeModelTransform();
+    return mutableFaces()[index];
 }
 
-// Calcul du volume
-float Pave3D::volume() const {
-    float length = faces[0].getFirstTriangle().getP1().distance(faces[0].getFirstTriangle().getP2());
-    float width = faces[0].getFirstTriangle().getP2().distance(faces[0].getFirstTriangle().getP3());
-    float height = faces[0].getFirstTriangle().getP1().distance(faces[1].getFirstTriangle().getP1());
+// Accesseur pour une face en espace objet
+const Quad3D& Pave3D::getLocalFace(size_t index) const {
+    if (index >= faces->size()) {
+        throw std::out_of_range("Index hors limites pour les faces du pavé.");
+    }
+    return (*faces)[index];
+}
 
-    if (length <= 0 || width <= 0 || height <= 0) {
-        throw std::runtime_error("Dimensions invalides pour le pavé.");
+void Pave3D::exportMesh(Mesh3D& out) const {
+    out.clear();
+    out.appendQuads(faces->data(), faces->size());
+}
+
+// Grandeurs dérivées des faces en espace objet, recalculées seulement après une modification des faces
+void Pave3D::refreshProperties() const {
+    if (!propertiesDirty) {
+        return;
     }
+    const std::array<Quad3D, 6>& faces = *this->faces;
 
-    return length * width * height;
+    localArea = 0.0f;
+    localBox = BoundingBox3D();
+    for (const auto& face : faces) {
+        localArea += face.surface();
+        const Triangle3D& t1 = face.getFirstTriangle();
+        const Triangle3D& t2 = face.getSecondTriangle();
+        const Point3D vertices[] = {t1.getP1(), t1.getP2(), t1.getP3(), t2.getP1(), t2.getP2(), t2.getP3()};
+        localBox.expand(vertices, 6);
+    }
+
+    Point3D middle = localBox.center();
+    localRadius = 0.0f;
+    for (const auto& face : faces) {
+        for (const Triangle3D* t : {&face.getFirstTriangle(), &face.getSecondTriangle()}) {
+            localRadius = std::max({localRadius, middle.distance(t->getP1()), middle.distance(t->getP2()), middle.distance(t->getP3())});
+        }
+    }
+
+    const Triangle3D& first = faces[0].getFirstTriangle();
+    float length = first.getP1().distance(first.getP2());
+    float width = first.getP2().distance(first.getP3());
+    float height = first.getP1().distance(faces[1].getFirstTriangle().getP1());
+    localVolume = (length <= 0 || width <= 0 || height <= 0) ? -1.0f : length * width * height;
+
+    propertiesDirty = false;
+}
+
+// Calcul du volume (dimensions en espace objet, mises à l'échelle)
+float Pave3D::volume() const {
+    refreshProperties();
+    if (localVolume < 0) {
+        throw std::runtime_error("Dimensions invalides pour le pavé.");
+    }
+    float scale = model.getScale();
+    return localVolume * scale * scale * scale;
 }
 
 // Calcul de la surface totale
 float Pave3D::surfaceArea() const {
-    static float cachedArea = -1.0f;
-    if (cachedArea < 0) {
-        cachedArea = 0.0f;
-        for (const auto& face : faces) {
-            cachedArea += face.surface();
-        }
-    }
-    return cachedArea;
+    refreshProperties();
+    float scale = model.getScale();
+    return localArea * scale * scale;
+}
+
+BoundingBox3D Pave3D::boundingBox() const {
+    refreshProperties();
+    return localBox.transformed(model.toTransform3D());
+}
+
+BoundingSphere3D Pave3D::boundingSphere() const {
+    refreshProperties();
+    return BoundingSphere3D(model.apply(localBox.center()), localRadius * model.getScale());
 }
 
 // Validation de la géométrie du pavé
 void Pave3D::validateGeometry() const {
+    const std::array<Quad3D, 6>& faces = *this->faces;
 
     if (faces[0].surface() != faces[1].surface() ||
         faces[2].surface() != faces[3].surface() ||
@@ -106,38 +198,54 @@ void Pave3D::validateGeometry() const {
 
 // Vérification d'égalité
 bool Pave3D::equals(const Pave3D& other) const {
-    return faces == other.faces;
+    return getFaces() == other.getFaces();
 }
 
+// Rotation en O(1) : seule la transformation de modèle est modifiée
 void Pave3D::rotate(float angle, char axis, const Point3D& center) {
-    for (auto& face : faces) {
-        face.rotate(angle, axis, center);
-    }
+    model.rotate(angle, axis, center);
+    worldDirty = true;
 }
 
-Point3D Pave3D::center() const {
-    Point3D minPoint = faces[0].getFirstTriangle().getP1();
-    Point3D maxPoint = minPoint;
+// Transformation quelconque : appliquée aux faces en espace objet, M^-1 * T * M
+void Pave3D::transform(const Transform3D& transform) {
+    Transform3D local = model.toTransform3D().then(transform).then(model.toInverseTransform3D());
+    std::array<Quad3D, 6>& faces = mutableFaces();
 
+    VertexBuffer3D buffer;
+    buffer.reserve(faces.size() * 6);
     for (const auto& face : faces) {
-        for (const auto& vertex : face.getVertices()) {
-            minPoint.setX(std::min(minPoint.getX(), vertex.getX()));
-            minPoint.setY(std::min(minPoint.getY(), vertex.getY()));
-            minPoint.setZ(std::min(minPoint.getZ(), vertex.getZ()));
-
-            maxPoint.setX(std::max(maxPoint.getX(), vertex.getX()));
-            maxPoint.setY(std::max(maxPoint.getY(), vertex.getY()));
-            maxPoint.setZ(std::max(maxPoint.getZ(), vertex.getZ()));
-        }
+        face.appendVertices(buffer);
+    }
+
+    local.apply(buffer);
+    VertexBuffer3D normals, centroids;
+    buffer.computeTriangleData(normals, centroids);
+
+    for (size_t i = 0; i < faces.size(); ++i) {
+        faces[i].loadVertices(buffer, i * 6, normals, centroids);
     }
-    return (minPoint + maxPoint) * 0.5f;
+}
+
+// L'orientation est calculée en espace objet : la transformation de modèle conserve le sens
+void Pave3D::orient(const Point3D& eye) {
+    Point3D localEye = model.applyInverse(eye);
+    for (auto& face : mutableFaces()) {
+        face.orient(localEye);
+    }
+}
+
+// Le centre du pavé (milieu de sa boîte englobante en espace objet) est placé dans le monde
+Point3D Pave3D::center() const {
+    refreshProperties();
+    return model.apply(localBox.center());
 }
 
 float Pave3D::averageDepth() const {
     float totalDepth = 0.0f;
     int vertexCount = 0;
 
-    for (const auto& face : faces) {
+    for (const auto& face : getFaces()) {
         totalDepth += face.getFirstTriangle().averageDepth();
         totalDepth += face.getSecondTriangle().averageDepth();
         vertexCount += 6; // 3 sommets par triangle, 2 triangles par face
@@ -149,8 +257,8 @@ float Pave3D::averageDepth() const {
 // Surcharge de l'opérateur de flux
 std::ostream& operator<<(std::ostream& os, const Pave3D& pave) {
     os << "Pave3D :\n";
-    for (size_t i = 0; i < pave.faces.size(); ++i) {
-        os << "  Face " << i + 1 << ": " << pave.faces[i] << "\n";
+    for (size_t i = 0; i < pave.faces->size(); ++i) {
+        os << "  Face " << i + 1 << ": " << pave.getFace(i) << "\n";
     }
     return os;
 }
@@ -158,35 +266,36 @@ std::ostream& operator<<(std::ostream& os, const Pave3D& pave) {
 // Calcule les faces visibles
 std::vector<Quad3D> Pave3D::getVisibleFaces(const Point3D& eye) const {
     std::vector<Quad3D> visibleFaces;
-    for (const auto& face : faces) {
-        Point3D normal = face.getNormal();
-        Point3D toEye = eye - face.center();
-
-        if (normal.dotProduct(toEye) > 0) {
-            visibleFaces.push_back(face);
-        }
-    }
+    forEachVisibleFace(eye, [&visibleFaces](const Quad3D& face) { visibleFaces.push_back(face); });
     return visibleFaces;
 }
 
+size_t Pave3D::getVisibleFaces(const Point3D& eye, std::array<const Quad3D*, 6>& out) const {
+    size_t count = 0;
+    forEachVisibleFace(eye, [&out, &count](const Quad3D& face) { out[count++] = &face; });
+    return count;
+}
+
 // Définir la couleur d'une face
 void Pave3D::setFaceColor(size_t index, const Couleur& color) {
-    if (index >= faces.size()) {
+    if (index >= faces->size()) {
         throw std::out_of_range("Index hors limites pour les faces du pavé.");
     }
-    faces[index].setColor(color);
+    mutableFaces()[index].setColor(color);
 }
 
 // Retourner la couleur d'une face
 Couleur Pave3D::getFaceColor(size_t index) const {
-    if (index >= faces.size()) {
+    if (index >= faces->size()) {
         throw std::out_of_range("Index hors limites pour les faces du pavé.");
     }
-    return faces[index].getColor();
+    return (*faces)[index].getColor();
 }
 
+// Translation ajustée à la profondeur de chaque sommet : non affine, elle est appliquée aux faces dans le monde
 void Pave3D::translate(const Point3D& offset, float projectionDistance) {
-    for (auto& face : faces) {
+    bakeModelTransform();
+    for (auto& face : mutableFaces()) {
         Triangle3D t1 = face.getFirstTriangle();
         Triangle3D t2 = face.getSecondTriangle();
 
@@ -202,9 +311,8 @@ void Pave3D::translate(const Point3D& offset, float projectionDistance) {
     }
 }
 
-// Translate le pavé
+// Translate le pavé en O(1)
 void Pave3D::translate(const Point3D& offset) {
-    for (auto& face : faces) {
-        face.translate(offset);
-    }
+    model.translate(offset);
+    worldDirty = true;
 }
\ No newline at end of file
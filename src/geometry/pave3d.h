@@ -4,6 +4,7 @@
  *
  * Cette classe représente un pavé, ou parallélipipède rectangle, défini par six faces planes (des Quad3D)
  * et une couleur associée. Elle fournit des méthodes pour manipuler et interroger ses propriétés géométriques.
+ * Les faces sont stockées en espace objet et placées dans le monde par une transformation de modèle.
  */
 
 #ifndef PAVE3D_H
@@ -11,8 +12,13 @@
 
 #include "point3d.h"
 #include "quad3d.h"
+#include "transform3d.h"
+#include "model_transform.h"
+#include "bounding_volume3d.h"
+#include "mesh3d.h"
 #include "../couleur.h"
 #include <array>
+#include <memory>
 #include <vector>
 #include "geometry_utils.h"
 
@@ -23,12 +29,44 @@
  * La classe Pave3D permet de stocker les six faces d'un pavé et d'interagir avec ses
  * propriétés géométriques et visuelles, telles que son volume, sa surface totale et sa couleur.
  *
+ * Tourner ou translater le pavé ne modifie que sa transformation de modèle (O(1)) ;
+ * les copies partagent les mêmes faces tant qu'elles ne sont pas modifiées.
+ *
  * @note Les faces doivent former un pavé valide, où les faces opposées sont égales et parallèles,
  * et où les angles entre les faces adjacentes sont droits.
  */
 class Pave3D {
 private:
-    std::array<Quad3D, 6> faces; ///< Tableau contenant les six faces du pavé (avant, arrière, gauche, droite, haut, bas).
+    std::shared_ptr<std::array<Quad3D, 6>> faces; ///< Les six faces du pavé en espace objet (avant, arrière, gauche, droite, haut, bas).
+    ModelTransform model;                         ///< Transformation de modèle (objet vers monde).
+    mutable std::array<Quad3D, 6> worldFaces;     ///< Cache des faces placées dans le monde.
+    mutable bool worldDirty;                      ///< Indique si le cache doit être recalculé.
+
+    // Grandeurs dérivées des faces en espace objet, propres à chaque instance et recalculées
+    // à la demande après une modification des faces. Les grandeurs dans le monde s'en déduisent
+    // en O(1) par la transformation de modèle (échelle uniforme).
+    mutable float localArea = 0.0f;               ///< Surface totale en espace objet.
+    mutable float localVolume = 0.0f;             ///< Volume en espace objet (négatif si les dimensions sont invalides).
+    mutable BoundingBox3D localBox;               ///< Boîte englobante en espace objet.
+    mutable float localRadius = 0.0f;             ///< Rayon de la sphère englobante centrée sur la boîte, en espace objet.
+    mutable bool propertiesDirty;                 ///< Indique si les grandeurs dérivées doivent être recalculées.
+
+    /**
+     * @brief Recalcule les grandeurs dérivées des faces si elles ont été modifiées.
+     */
+    void refreshProperties() const;
+
+    /**
+     * @brief Accès modifiable aux faces en espace objet, copiées au préalable si elles sont partagées.
+     * @return Une référence modifiable vers les faces.
+     */
+    std::array<Quad3D, 6>& mutableFaces();
+
+    /**
+     * @brief Fige la transformation de modèle dans les faces (qui deviennent les faces dans le monde)
+     * et remet la transformation de modèle à l'identité.
+     */
+    void bakeModelTransform();
 
     /**
      * @brief Valide la géométrie du pavé.
@@ -74,6 +112,7 @@ public:
      * @param width La largeur du pavé.
      * @param height La hauteur du pavé.
      * @param color La couleur associée au pavé.
+     * @throw std::runtime_error Si une dimension est nulle.
      */
     Pave3D(const Point3D& origin, float length, float width, float height, const Couleur& color);
 
@@ -84,7 +123,7 @@ public:
     Pave3D(const Pave3D& other);
 
     /**
-     * @brief Accesseur pour une face du pavé.
+     * @brief Accesseur pour une face du pavé, placée dans le monde.
      * @param index Index de la face (0 à 5 : avant, arrière, gauche, droite, haut, bas).
      * @return La face demandée (Quad3D).
      * @throw std::out_of_range Si l'index est hors des limites.
@@ -93,11 +132,69 @@ public:
 
     /**
      * @brief Accesseur modifiable pour une face du pavé.
+     *
+     * La transformation de modèle est d'abord figée dans les faces, pour que la face
+     * renvoyée soit la face dans le monde. Le rendu utilise plutôt getLocalFace().
+     *
      * @param index Index de la face (0 à 5).
      * @return Une référence modifiable vers la face demandée.
      */
     Quad3D& getFace(size_t index);
 
+    /**
+     * @brief Accesseur pour les six faces placées dans le monde (recalculées à la demande, puis mises en cache).
+     * @return Une référence constante vers les faces.
+     */
+    const std::array<Quad3D, 6>& getFaces() const;
+
+    /**
+     * @brief Accesseur pour une face en espace objet.
+     * @param index Index de la face (0 à 5).
+     * @return La face demandée, avant application de la transformation de modèle.
+     * @throw std::out_of_range Si l'index est hors des limites.
+     */
+    const Quad3D& getLocalFace(size_t index) const;
+
+    /**
+     * @brief Accesseur pour les faces partagées en espace objet, afin qu'un autre pavé puisse les réutiliser.
+     * @return Un pointeur partagé vers les faces.
+     */
+    std::shared_ptr<const std::array<Quad3D, 6>> getMesh() const { return faces; }
+
+    /**
+     * @brief Exporte les faces en espace objet dans un maillage indexé (vidé au préalable).
+     *
+     * Le maillage passé garde sa capacité : le rendu le réutilise d'une image à l'autre.
+     *
+     * @param out Le maillage à remplir (24 sommets, 12 triangles, une couleur par face).
+     */
+    void exportMesh(Mesh3D& out) const;
+
+    /**
+     * @brief Retourne les faces en espace objet sous forme de maillage indexé.
+     * @return Le maillage.
+     */
+    Mesh3D toMesh() const {
+        Mesh3D mesh;
+        exportMesh(mesh);
+        return mesh;
+    }
+
+    /**
+     * @brief Accesseur pour la transformation de modèle.
+     * @return La transformation de modèle du pavé.
+     */
+    const ModelTransform& getModelTransform() const { return model; }
+
+    /**
+     * @brief Modifie la transformation de modèle.
+     * @param newModel La nouvelle transformation.
+     */
+    void setModelTransform(const ModelTransform& newModel) {
+        model = newModel;
+        worldDirty = true;
+    }
+
     /**
      * @brief Obtient les faces visibles du pavé pour un point d'observation donné.
      * @param eye La position de l'œil (observateur).
@@ -105,6 +202,38 @@ public:
      */
     std::vector<Quad3D> getVisibleFaces(const Point3D& eye) const;
 
+    /**
+     * @brief Obtient les faces visibles sans allocation.
+     * @param eye La position de l'œil (observateur).
+     * @param out Reçoit un pointeur vers chaque face visible (faces placées dans le monde).
+     * @return Le nombre de faces visibles, rangées en tête de out.
+     */
+    size_t getVisibleFaces(const Point3D& eye, std::array<const Quad3D*, 6>& out) const;
+
+    /**
+     * @brief Appelle un visiteur pour chaque face visible, sans copie ni allocation.
+     * @param eye La position de l'œil (observateur).
+     * @param visit Le visiteur, appelé avec chaque face visible (const Quad3D&).
+     */
+    template <typename Visitor>
+    void forEachVisibleFace(const Point3D& eye, Visitor&& visit) const {
+        for (const auto& face : getFaces()) {
+            if (isFaceVisible(face, eye)) {
+                visit(face);
+            }
+        }
+    }
+
+    /**
+     * @brief Indique si une face est tournée vers l'œil.
+     * @param face La face (placée dans le monde).
+     * @param eye La position de l'œil.
+     * @return true si la face est visible, false sinon.
+     */
+    static bool isFaceVisible(const Quad3D& face, const Point3D& eye) {
+        return face.getUnitNormal().dotProduct(eye - face.center()) > 0;
+    }
+
     /**
      * @brief Modifie la couleur d'une face spécifique du pavé.
      * @param index L'indice de la face (de 0 à 5).
@@ -122,17 +251,30 @@ public:
     Couleur getFaceColor(size_t index) const;
 
     /**
-     * @brief Calcule le volume du pavé.
+     * @brief Calcule le volume du pavé (mis en cache, O(1) après une rotation ou une translation).
      * @return Le volume du pavé (float).
+     * @throw std::runtime_error Si les dimensions du pavé sont invalides.
      */
     float volume() const;
 
     /**
-     * @brief Calcule la surface totale du pavé.
+     * @brief Calcule la surface totale du pavé (mise en cache, O(1) après une rotation ou une translation).
      * @return La surface totale du pavé (float).
      */
     float surfaceArea() const;
 
+    /**
+     * @brief Calcule la boîte englobante du pavé dans le monde (O(1) à partir de la boîte en espace objet).
+     * @return La boîte englobante alignée sur les axes.
+     */
+    BoundingBox3D boundingBox() const;
+
+    /**
+     * @brief Calcule une sphère englobante du pavé dans le monde (O(1)).
+     * @return La sphère centrée sur le centre du pavé, contenant tous ses sommets.
+     */
+    BoundingSphere3D boundingSphere() const;
+
     /**
      * @brief Vérifie si deux pavés sont égaux.
      * @param other L'autre pavé à comparer.
@@ -141,7 +283,7 @@ public:
     bool equals(const Pave3D& other) const;
 
     /**
-     * @brief Translate le pavé dans l'espace 3D.
+     * @brief Translate le pavé dans l'espace 3D (O(1), seule la transformation de modèle est modifiée).
      * @param offset Le décalage à appliquer (Point3D).
      */
     void translate(const Point3D& offset);
@@ -154,7 +296,7 @@ public:
     void translate(const Point3D& offset, float projectionDistance);
 
     /**
-     * @brief Effectue une rotation du pavé autour d'un axe donné.
+     * @brief Effectue une rotation du pavé autour d'un axe donné (O(1), seule la transformation de modèle est modifiée).
      * @param angle L'angle de rotation en radians.
      * @param axis L'axe de rotation ('x', 'y' ou 'z').
      * @param center Le centre de rotation.
@@ -162,7 +304,19 @@ public:
     void rotate(float angle, char axis, const Point3D& center);
 
     /**
-     * @brief Calcule le centre géométrique du pavé.
+     * @brief Applique une transformation affine quelconque aux faces du pavé (en espace objet, en une passe).
+     * @param transform La transformation à appliquer.
+     */
+    void transform(const Transform3D& transform);
+
+    /**
+     * @brief Oriente les faces dans le sens trigonométrique vu depuis l'œil.
+     * @param eye La position de l'œil dans le monde.
+     */
+    void orient(const Point3D& eye);
+
+    /**
+     * @brief Calcule le centre géométrique du pavé (milieu de sa boîte englobante en espace objet, O(1)).
      * @return Le centre géométrique du pavé (Point3D).
      */
     Point3D center() const;
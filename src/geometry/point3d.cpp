@@ -2,64 +2,35 @@
 #include <cmath>
 #include "geometry_utils.h"
 
-Point3D::Point3D(float x, float y, float z) : x(x), y(y), z(z) {}
-
-Point3D::Point3D(const Point3D& other){
-    x = other.getX();
-    y = other.getY();
-    z = other.getZ();
-}
-
-float Point3D::getX() const{
-    return x;
-}
-
-float Point3D::getY() const{
-    return y;
-}
-
-float Point3D::getZ() const{
-    return z;
-}
-
-float Point3D::distance(const Point3D& other) const {
-    return std::sqrt((other.x - x) * (other.x - x) +
-                     (other.y - y) * (other.y - y) +
-                     (other.z - z) * (other.z - z));
-}
-
-
 float Point3D::distance(const Point3D& p1, const Point3D& p2){
     return p1.distance(p2);
 }
 
-Point3D Point3D::crossProduct(const Point3D& other) const {
-    return Point3D(
-        y * other.z - z * other.y,
-        z * other.x - x * other.z,
-        x * other.y - y * other.x
-    );
-}
-
 Point3D Point3D::crossProduct(const Point3D& p1, const Point3D& p2){
     return p1.crossProduct(p2);
 }
 
-float Point3D::dotProduct(const Point3D& other) const{
-    return getX() * other.getX() + getY() * other.getY() + getZ() * other.getZ();
+void Point3D::minMax(const Point3D* points, std::size_t count, Point3D& lower, Point3D& upper) {
+    Vec4 low = lower.v;
+    Vec4 high = upper.v;
+    for (std::size_t i = 0; i < count; ++i) {
+        low = Vec4::min(low, points[i].v);
+        high = Vec4::max(high, points[i].v);
+    }
+    lower = Point3D(low);
+    upper = Point3D(high);
 }
 
 bool Point3D::areCollinear(const Point3D& p1, const Point3D& p2, const Point3D& p3) {
     Point3D v1 = p2 - p1;
     Point3D v2 = p3 - p1;
 
-    return v1.crossProduct(v2).norm() < TOLERANCE;
+    // Normes plutôt que carrés : le produit ne déborde pas pour de grandes coordonnées
+    return v1.crossProduct(v2).norm() <= TOLERANCE * v1.norm() * v2.norm();
 }
 
 bool Point3D::equals(const Point3D& other) const {
-    return std::fabs(x - other.x) < TOLERANCE &&
-           std::fabs(y - other.y) < TOLERANCE &&
-           std::fabs(z - other.z) < TOLERANCE;
+    return Vec4::nearlyEqual(v, other.v, TOLERANCE);
 }
 
 bool operator==(const Point3D& lhs, const Point3D& rhs) {
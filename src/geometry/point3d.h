@@ -1,30 +1,168 @@
 /**
  * @file Point3D.h
- * @brief Déclaration de la classe Point3D pour représenter un point dans l'espace 3D.
+ * @brief Déclaration de la classe BasicPoint3D pour représenter un point dans l'espace 3D.
  * 
- * Cette classe représente un point dans l'espace tridimensionnel avec des coordonnées x, y et z.
+ * Cette classe représente un point dans l'espace tridimensionnel avec des coordonnées x, y et z,
+ * paramétrée par le type des coordonnées :
+ * - Point3D (float) est le chemin rapide du rendu : les coordonnées sont stockées dans un Vec4
+ *   aligné (w = 0) et les calculs vectoriels utilisent SSE ;
+ * - Point3Dd (double) sert aux coordonnées de grands mondes, où float ne distingue plus deux
+ *   points proches loin de l'origine. Le rendu les convertit en float relatifs à la caméra
+ *   (cameraRelative) avant toute projection.
  */
 #ifndef POINT3D_H
 #define POINT3D_H
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <stdexcept>
+#include <cstddef>
+#include <type_traits>
 #include "geometry_utils.h"
+#include "vec4.h"
 
 /**
- * @class Point3D
- * @brief Classe représentant un point dans l'espace 3D.
+ * @class BasicPoint3D
+ * @brief Point dans l'espace 3D, de coordonnées de type Scalar.
+ *
+ * Version générique (double) : mêmes opérations que Point3D, en arithmétique scalaire, avec la
+ * tolérance ScalarTraits<Scalar>::tolerance.
+ */
+template <typename Scalar>
+class BasicPoint3D {
+
+    private:
+        Scalar x; // Coordonnée x.
+        Scalar y; // Coordonnée y.
+        Scalar z; // Coordonnée z.
+
+    public:
+        BasicPoint3D(Scalar x = 0, Scalar y = 0, Scalar z = 0) : x(x), y(y), z(z) {}
+
+        Scalar getX() const { return x; }
+        Scalar getY() const { return y; }
+        Scalar getZ() const { return z; }
+        void setX(Scalar newX) { x = newX; }
+        void setY(Scalar newY) { y = newY; }
+        void setZ(Scalar newZ) { z = newZ; }
+
+        Scalar dotProduct(const BasicPoint3D& other) const { return x * other.x + y * other.y + z * other.z; }
+
+        BasicPoint3D crossProduct(const BasicPoint3D& other) const {
+            return BasicPoint3D(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x);
+        }
+
+        static BasicPoint3D crossProduct(const BasicPoint3D& p1, const BasicPoint3D& p2) { return p1.crossProduct(p2); }
+
+        Scalar crossDot(const BasicPoint3D& b, const BasicPoint3D& c) const { return crossProduct(b).dotProduct(c); }
+
+        Scalar norm() const { return std::sqrt(dotProduct(*this)); }
+
+        Scalar distance(const BasicPoint3D& other) const { return (*this - other).norm(); }
+
+        static Scalar distance(const BasicPoint3D& p1, const BasicPoint3D& p2) { return p1.distance(p2); }
+
+        BasicPoint3D normalized() const {
+            Scalar length = norm();
+            return length > 0 ? *this * (1 / length) : BasicPoint3D();
+        }
+
+        static BasicPoint3D min(const BasicPoint3D& a, const BasicPoint3D& b) {
+            return BasicPoint3D(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z));
+        }
+
+        static BasicPoint3D max(const BasicPoint3D& a, const BasicPoint3D& b) {
+            return BasicPoint3D(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z));
+        }
+
+        static void minMax(const BasicPoint3D* points, std::size_t count, BasicPoint3D& lower, BasicPoint3D& upper) {
+            for (std::size_t i = 0; i < count; ++i) {
+                lower = min(lower, points[i]);
+                upper = max(upper, points[i]);
+            }
+        }
+
+        // Test relatif : |e1 x e2| = |e1| |e2| sin(angle), comparé à la tolérance fois |e1| |e2|
+        static bool areCollinear(const BasicPoint3D& p1, const BasicPoint3D& p2, const BasicPoint3D& p3) {
+            const BasicPoint3D e1 = p2 - p1, e2 = p3 - p1;
+            return e1.crossProduct(e2).norm() <= ScalarTraits<Scalar>::tolerance * e1.norm() * e2.norm();
+        }
+
+        bool equals(const BasicPoint3D& other) const {
+            const Scalar tolerance = ScalarTraits<Scalar>::tolerance;
+            return std::abs(x - other.x) <= tolerance && std::abs(y - other.y) <= tolerance && std::abs(z - other.z) <= tolerance;
+        }
+
+        friend bool operator==(const BasicPoint3D& p1, const BasicPoint3D& p2) { return p1.equals(p2); }
+        friend bool operator!=(const BasicPoint3D& p1, const BasicPoint3D& p2) { return !p1.equals(p2); }
+
+        friend BasicPoint3D operator-(const BasicPoint3D& p1, const BasicPoint3D& p2) {
+            return BasicPoint3D(p1.x - p2.x, p1.y - p2.y, p1.z - p2.z);
+        }
+
+        BasicPoint3D operator+(const BasicPoint3D& other) const { return BasicPoint3D(x + other.x, y + other.y, z + other.z); }
+
+        friend BasicPoint3D operator*(const BasicPoint3D& p, Scalar scalar) { return BasicPoint3D(p.x * scalar, p.y * scalar, p.z * scalar); }
+
+        friend BasicPoint3D operator/(const BasicPoint3D& p, Scalar scalar) {
+            if (scalar == 0) {
+                throw std::invalid_argument("Division par zéro.");
+            }
+            return p * (1 / scalar);
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const BasicPoint3D& point) {
+            os << "(" << point.x << ", " << point.y << ", " << point.z << ")";
+            return os;
+        }
+
+        void rotate(float angle, char axis, const BasicPoint3D& center) {
+            BasicPoint3D offset = *this - center;
+            const Scalar sinA = std::sin(static_cast<Scalar>(angle));
+            const Scalar cosA = std::cos(static_cast<Scalar>(angle));
+            switch (axis) {
+                case 'x':
+                    offset = BasicPoint3D(offset.x, offset.y * cosA - offset.z * sinA, offset.y * sinA + offset.z * cosA);
+                    break;
+                case 'y':
+                    offset = BasicPoint3D(offset.x * cosA + offset.z * sinA, offset.y, -offset.x * sinA + offset.z * cosA);
+                    break;
+                case 'z':
+                    offset = BasicPoint3D(offset.x * cosA - offset.y * sinA, offset.x * sinA + offset.y * cosA, offset.z);
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid axis for rotation");
+            }
+            *this = offset + center;
+        }
+};
+
+template <>
+class BasicPoint3D<float>;
+
+/**
+ * @brief Point du chemin de rendu, en float.
+ */
+using Point3D = BasicPoint3D<float>;
+
+/**
+ * @brief Point de grand monde, en double.
+ */
+using Point3Dd = BasicPoint3D<double>;
+
+/**
+ * @class BasicPoint3D<float>
+ * @brief Classe représentant un point dans l'espace 3D (chemin rapide float, SSE).
  * 
  * La classe Point3D permet de stocker les coordonnées d'un point en trois dimensions
  * et fournit des méthodes pour calculer la distance entre deux points.
  */
-class Point3D {
+template <>
+class BasicPoint3D<float> {
 
     private:
-        float x;
-        float y;
-        float z;
+        Vec4 v; // Coordonnées (x, y, z, 0).
 
     public:
         /**
@@ -33,61 +171,73 @@ class Point3D {
         * @param y Coordonnée y du point.
         * @param z Coordonnée z du point.
         */
-        Point3D(float x = 0, float y = 0, float z = 0);
+        BasicPoint3D(float x = 0, float y = 0, float z = 0) : v(x, y, z, 0.0f) {}
+
+        /**
+         * @brief Constructeur à partir d'un vecteur SIMD (dont w vaut 0).
+         * @param vec Le vecteur.
+         */
+        explicit BasicPoint3D(const Vec4& vec) : v(vec) {}
 
         /**
          * @brief Constructeur par copie de la classe Point3D.
          * @param other Le point à copier.
          */
-        Point3D(const Point3D& other);
+        BasicPoint3D(const Point3D& other) = default;
 
         /**
          * @brief Destructeur de la classe Point3D.
          */
-        ~Point3D(){};
+        ~BasicPoint3D() = default;
 
         /**
         * @brief Accesseur pour la coordonnée x.
         * @return La coordonnée x du point.
         */
-        float getX() const;
+        float getX() const { return v.x(); }
 
         /**
         * @brief Accesseur pour la coordonnée y.
         * @return La coordonnée y du point.
         */
-        float getY() const;
+        float getY() const { return v.y(); }
 
         /**
         * @brief Accesseur pour la coordonnée z.
         * @return La coordonnée z du point.
         */
-        float getZ() const;
+        float getZ() const { return v.z(); }
+
+        /**
+         * @brief Accesseur pour le vecteur SIMD sous-jacent.
+         * @return Le vecteur (x, y, z, 0).
+         */
+        const Vec4& vec() const { return v; }
 
         /**
          * @brief Modifie la coordonnée x.
          * @param newX La nouvelle valeur pour la coordonnée x.
          */
-        void setX(float newX) { x = newX; }
+        void setX(float newX) { v.setX(newX); }
 
         /**
          * @brief Modifie la coordonnée y.
          * @param newY La nouvelle valeur pour la coordonnée y.
          */
-        void setY(float newY) { y = newY; }
+        void setY(float newY) { v.setY(newY); }
 
         /**
          * @brief Modifie la coordonnée z.
          * @param newZ La nouvelle valeur pour la coordonnée z.
          */
-        void setZ(float newZ) { z = newZ; }
+        void setZ(float newZ) { v.setZ(newZ); }
 
         /**
          * @brief Calcule la distance (euclidienne) entre ce point et un autre point donné.
          * @param other L'autre point avec lequel calculer la distance.
          * @return La distance entre ce point et l'autre point.
          */
-        float distance(const Point3D& other) const;
+        float distance(const Point3D& other) const { return (v - other.v).length(); }
 
         /**
          * @brief Calcule la distance (euclidienne) entre deux points donnés.
@@ -102,7 +252,7 @@ class Point3D {
          * @param other L'autre point avec lequel calculer le produit vectoriel.
          * @return Le produit vectoriel entre les deux points.
          */
-        Point3D crossProduct(const Point3D& other) const;
+        Point3D crossProduct(const Point3D& other) const { return Point3D(Vec4::cross(v, other.v)); }
 
         /**
          * @brief Calcule le produit vectoriel entre deux points.
@@ -117,18 +267,55 @@ class Point3D {
          * @param other L'autre point avec lequel calculer le produit scalaire.
          * @return Le produit scalaire entre les deux points.
          */
-        float dotProduct(const Point3D& other) const;
+        float dotProduct(const Point3D& other) const { return Vec4::dot(v, other.v); }
+
+        /**
+         * @brief Calcule le produit mixte (this x b) . c en une seule passe.
+         * @param b Le deuxième vecteur du produit vectoriel.
+         * @param c Le vecteur du produit scalaire.
+         * @return Le produit mixte.
+         */
+        float crossDot(const Point3D& b, const Point3D& c) const { return Vec4::crossDot(v, b.v, c.v); }
 
         /**
          * @brief Calcule la norme du vecteur représenté par le point.
          * @return La norme du vecteur.
          */
         float norm() const {
-            return std::sqrt(x * x + y * y + z * z);
+            return v.length();
         }
 
+        /**
+         * @brief Calcule le vecteur unitaire de même direction.
+         * @return Le vecteur normalisé, ou le vecteur nul si la norme est nulle.
+         */
+        Point3D normalized() const { return Point3D(v.normalized()); }
+
+        /**
+         * @brief Minimum composante par composante de deux points.
+         */
+        static Point3D min(const Point3D& a, const Point3D& b) { return Point3D(Vec4::min(a.v, b.v)); }
+
+        /**
+         * @brief Maximum composante par composante de deux points.
+         */
+        static Point3D max(const Point3D& a, const Point3D& b) { return Point3D(Vec4::max(a.v, b.v)); }
+
+        /**
+         * @brief Étend un intervalle [lower, upper] pour contenir une série de points.
+         * @param points Les points.
+         * @param count Le nombre de points.
+         * @param lower Le minimum courant, mis à jour.
+         * @param upper Le maximum courant, mis à jour.
+         */
+        static void minMax(const Point3D* points, std::size_t count, Point3D& lower, Point3D& upper);
+
         /**
          * @brief Vérifie si trois points sont alingnés.
+         *
+         * Le test ne dépend pas de l'échelle : le sinus de l'angle en p1, |e1 x e2| / (|e1| |e2|),
+         * est comparé à la tolérance. Deux points confondus sont considérés comme alignés.
+         *
          * @param p1 Le premier point.
          * @param p2 Le deuxième point.
          * @param p3 Le troisième point.
@@ -148,12 +335,7 @@ class Point3D {
          * @param other Le point à copier.
          * @return Une référence à ce point modifié.
          */
-        Point3D& operator=(const Point3D& other){
-            x = other.getX();
-            y = other.getY();
-            z = other.getZ();
-            return *this;
-        }
+        Point3D& operator=(const Point3D& other) = default;
 
         /**
          * @brief Compare deux points pour l'égalité.
@@ -177,11 +359,11 @@ class Point3D {
          * @return Le point résultant de la soustraction.
          */
         friend Point3D operator-(const Point3D& p1, const Point3D& p2) {
-            return Point3D(p1.x - p2.x, p1.y - p2.y, p1.z - p2.z);
+            return Point3D(p1.v - p2.v);
         }
 
         Point3D operator+(const Point3D& other) const {
-            return Point3D(x + other.x, y + other.y, z + other.z);
+            return Point3D(v + other.v);
         }
 
         /**
@@ -191,7 +373,7 @@ class Point3D {
          * @return Le point résultant de la multiplication.
          */
         friend Point3D operator*(const Point3D& p, float scalar) {
-            return Point3D(p.x * scalar, p.y * scalar, p.z * scalar);
+            return Point3D(p.v * scalar);
         }
 
         /**
@@ -231,9 +413,9 @@ class Point3D {
          */
         void rotate(float angle, char axis, const Point3D& center) {
 
-            float x = this->x - center.getX();
-            float y = this->y - center.getY();
-            float z = this->z - center.getZ();
+            float x = getX() - center.getX();
+            float y = getY() - center.getY();
+            float z = getZ() - center.getZ();
 
             float sinA = std::sin(angle);
             float cosA = std::cos(angle);
@@ -264,11 +446,38 @@ class Point3D {
                     throw std::invalid_argument("Invalid axis for rotation");
             }
 
-            this->x = x + center.getX();
-            this->y = y + center.getY();
-            this->z = z + center.getZ();
+            v = Vec4(x + center.getX(), y + center.getY(), z + center.getZ());
         }
 
 };
 
-#endif 
\ No newline at end of file
+/**
+ * @brief Convertit un point vers un autre type de coordonnées.
+ * @param point Le point.
+ * @return Le point converti (arrondi au plus proche si Target est moins précis).
+ */
+template <typename Target, typename Scalar>
+BasicPoint3D<Target> pointCast(const BasicPoint3D<Scalar>& point) {
+    if constexpr (std::is_same_v<Target, Scalar>) {
+        return point;
+    } else {
+        return BasicPoint3D<Target>(static_cast<Target>(point.getX()), static_cast<Target>(point.getY()), static_cast<Target>(point.getZ()));
+    }
+}
+
+/**
+ * @brief Exprime un point par rapport à la caméra, en float, pour le rendu.
+ *
+ * La différence est calculée dans le type d'origine avant l'arrondi : un point de grand monde
+ * proche de la caméra garde toute sa précision.
+ *
+ * @param point Le point.
+ * @param eye La position de la caméra.
+ * @return Le point relatif à la caméra.
+ */
+template <typename Scalar>
+Point3D cameraRelative(const BasicPoint3D<Scalar>& point, const BasicPoint3D<Scalar>& eye) {
+    return pointCast<float>(point - eye);
+}
+
+#endif
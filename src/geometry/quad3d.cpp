@@ -3,13 +3,17 @@
 #include <stdexcept>
 #include <cmath>
 #include "geometry_utils.h"
+#include "vertex_buffer3d.h"
+#include "transform3d.h"
 
 // Constructeur par défaut
-Quad3D::Quad3D() 
-    : triangles_{Triangle3D(), Triangle3D()} {}
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D() 
+    : triangles_{Triangle(), Triangle()} {}
 
 // Constructeur avec deux triangles et des composantes RVB
-Quad3D::Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, int rouge, int vert, int bleu)
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D(const Triangle& firstT, const Triangle& secondT, int rouge, int vert, int bleu)
     : triangles_{firstT, secondT} {
     if (!firstT.hasCommonSide(secondT)) {
         throw std::invalid_argument("The two triangles must share a common side to form a valid Quad3D.");
@@ -18,7 +22,8 @@ Quad3D::Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, int rouge, i
 }
 
 // Constructor with two triangles and a color object
-Quad3D::Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, const Couleur& color)
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D(const Triangle& firstT, const Triangle& secondT, const Couleur& color)
     : triangles_{firstT, secondT} {
     if (!firstT.hasCommonSide(secondT)) {
         throw std::invalid_argument("The two triangles must share a common side to form a valid Quad3D.");
@@ -27,76 +32,142 @@ Quad3D::Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, const Couleu
 }
 
 // Constructeur avec quatre sommets et des composantes RVB
-Quad3D::Quad3D(const Point3D& p1, const Point3D& p2, const Point3D& p3, const Point3D& p4, int rouge, int vert, int bleu)
-    : triangles_{Triangle3D(p1, p2, p3, rouge, vert, bleu),
-                 Triangle3D(p1, p3, p4, rouge, vert, bleu)} {
-    if (Point3D::areCollinear(p1, p2, p3) || Point3D::areCollinear(p1, p3, p4)) {
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D(const Point& p1, const Point& p2, const Point& p3, const Point& p4, int rouge, int vert, int bleu)
+    : BasicQuad3D(p1, p2, p3, p4, Couleur(rouge, vert, bleu)) {}
+
+// Constructeur avec quatre sommets et des composantes RVB
+// Les sommets sont validés une seule fois, puis les triangles sont construits sans nouveau test
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D(const Point& p1, const Point& p2, const Point& p3, const Point& p4, const Couleur& color)
+    : triangles_{Triangle(UNCHECKED, p1, p2, p3, color),
+                 Triangle(UNCHECKED, p1, p3, p4, color)} {
+    if (validate(p1, p2, p3, p4) != GeometryError::None) {
         throw std::runtime_error("Les sommets fournis ne forment pas un quadrilatère valide.");
     }
-    if (!triangles_[0].hasCommonSide(triangles_[1])) {
-        throw std::runtime_error("Les triangles générés doivent partager un côté.");
+}
+
+template <typename Scalar>
+GeometryError BasicQuad3D<Scalar>::validate(const Point& p1, const Point& p2, const Point& p3, const Point& p4) noexcept {
+    if (Point::areCollinear(p1, p2, p3) || Point::areCollinear(p1, p3, p4)) {
+        return GeometryError::CollinearPoints;
     }
+    return GeometryError::None;
 }
 
-// Constructeur avec quatre sommets et des composantes RVB
-Quad3D::Quad3D(const Point3D& p1, const Point3D& p2, const Point3D& p3, const Point3D& p4, const Couleur& color)
-    : triangles_{Triangle3D(p1, p2, p3, color),
-                 Triangle3D(p1, p3, p4, color)} {
-    if (Point3D::areCollinear(p1, p2, p3) || Point3D::areCollinear(p1, p3, p4)) {
-        throw std::runtime_error("Les sommets fournis ne forment pas un quadrilatère valide.");
+template <typename Scalar>
+GeometryError BasicQuad3D<Scalar>::tryCreate(const Point& p1, const Point& p2, const Point& p3, const Point& p4,
+                                const Couleur& color, BasicQuad3D& out) noexcept {
+    GeometryError error = validate(p1, p2, p3, p4);
+    if (error == GeometryError::None) {
+        out = BasicQuad3D(UNCHECKED, p1, p2, p3, p4, color);
     }
-    if (!triangles_[0].hasCommonSide(triangles_[1])) {
-        throw std::runtime_error("Les triangles générés doivent partager un côté.");
+    return error;
+}
+
+template <typename Scalar>
+GeometryError BasicQuad3D<Scalar>::tryCreate(const Point& p1, const Point& p2, const Point& p3, const Point& p4,
+                                int rouge, int vert, int bleu, BasicQuad3D& out) noexcept {
+    if (!Couleur::isValid(rouge, vert, bleu)) {
+        return GeometryError::InvalidColor;
     }
+    return tryCreate(p1, p2, p3, p4, Couleur(UNCHECKED, rouge, vert, bleu), out);
 }
 
-Quad3D::Quad3D(const Quad3D& other)
+template <typename Scalar>
+BasicQuad3D<Scalar>::BasicQuad3D(const BasicQuad3D& other)
     : triangles_{other.triangles_[0], other.triangles_[1]}{}
 
 // Accesseur pour le premier triangle
-const Triangle3D& Quad3D::getFirstTriangle() const noexcept {
+template <typename Scalar>
+const BasicTriangle3D<Scalar>& BasicQuad3D<Scalar>::getFirstTriangle() const noexcept {
     return triangles_[0];
 }
 
 // Accesseur pour le deuxième triangle
-const Triangle3D& Quad3D::getSecondTriangle() const noexcept {
+template <typename Scalar>
+const BasicTriangle3D<Scalar>& BasicQuad3D<Scalar>::getSecondTriangle() const noexcept {
     return triangles_[1];
 }
 
 // Accesseur pour la couleur
-Couleur Quad3D::getColor() const {
+template <typename Scalar>
+Couleur BasicQuad3D<Scalar>::getColor() const {
     return triangles_[0].getColor();
 }
 
-std::vector<Point3D> Quad3D::getVertices() const {
-    return {triangles_[0].getP1(), triangles_[0].getP2(), triangles_[0].getP3(),
-            triangles_[1].getP3()};
+template <typename Scalar>
+std::vector<BasicPoint3D<Scalar>> BasicQuad3D<Scalar>::getVertices() const {
+    std::array<Point, 4> corners = getCorners();
+    return std::vector<Point>(corners.begin(), corners.end());
+}
+
+template <typename Scalar>
+void BasicQuad3D<Scalar>::appendVertices(VertexBuffer3D& buffer) const {
+    for (const auto& triangle : triangles_) {
+        buffer.push_back(pointCast<float>(triangle.getP1()));
+        buffer.push_back(pointCast<float>(triangle.getP2()));
+        buffer.push_back(pointCast<float>(triangle.getP3()));
+    }
+}
+
+template <typename Scalar>
+void BasicQuad3D<Scalar>::storeVertices(VertexBuffer3D& buffer, size_t first) const {
+    for (const auto& triangle : triangles_) {
+        buffer.set(first, pointCast<float>(triangle.getP1()));
+        buffer.set(first + 1, pointCast<float>(triangle.getP2()));
+        buffer.set(first + 2, pointCast<float>(triangle.getP3()));
+        first += 3;
+    }
+}
+
+template <typename Scalar>
+void BasicQuad3D<Scalar>::loadVertices(const VertexBuffer3D& buffer, size_t first) {
+    for (auto& triangle : triangles_) {
+        triangle.setVertices(pointCast<Scalar>(buffer.get(first)), pointCast<Scalar>(buffer.get(first + 1)), pointCast<Scalar>(buffer.get(first + 2)));
+        first += 3;
+    }
+}
+
+template <typename Scalar>
+void BasicQuad3D<Scalar>::loadVertices(const VertexBuffer3D& buffer, size_t first, const VertexBuffer3D& normals, const VertexBuffer3D& centroids) {
+    for (auto& triangle : triangles_) {
+        size_t t = first / 3;
+        triangle.setVertices(UNCHECKED, pointCast<Scalar>(buffer.get(first)), pointCast<Scalar>(buffer.get(first + 1)),
+                             pointCast<Scalar>(buffer.get(first + 2)), pointCast<Scalar>(normals.get(t)), pointCast<Scalar>(centroids.get(t)));
+        first += 3;
+    }
 }
 
 // Modificateur pour la couleur avec un objet Couleur
-void Quad3D::setColor(const Couleur& color) {
+template <typename Scalar>
+void BasicQuad3D<Scalar>::setColor(const Couleur& color) {
     triangles_[0].setColor(color);
     triangles_[1].setColor(color);
 }
 
 // Modificateur pour la couleur avec des composantes RVB
-void Quad3D::setColor(int rouge, int vert, int bleu) {
+template <typename Scalar>
+void BasicQuad3D<Scalar>::setColor(int rouge, int vert, int bleu) {
     triangles_[0].setColor(rouge, vert, bleu);
     triangles_[1].setColor(rouge, vert, bleu);
 }
 
 // Calcul de la surface
-float Quad3D::surface() const {
+template <typename Scalar>
+Scalar BasicQuad3D<Scalar>::surface() const {
     return triangles_[0].area() + triangles_[1].area();
 }
 
 // Vérifie si un point est un sommet du quad
-bool Quad3D::isVertex(const Point3D& p) const {
+template <typename Scalar>
+bool BasicQuad3D<Scalar>::isVertex(const Point& p) const {
     return triangles_[0].isVertex(p) || triangles_[1].isVertex(p);
 }
 
 // Vérifie si deux quads partagent un côté
-bool Quad3D::hasCommonSide(const Quad3D& other) const {
+template <typename Scalar>
+bool BasicQuad3D<Scalar>::hasCommonSide(const BasicQuad3D& other) const {
     return triangles_[0].hasCommonSide(other.getFirstTriangle()) ||
            triangles_[0].hasCommonSide(other.getSecondTriangle()) ||
            triangles_[1].hasCommonSide(other.getFirstTriangle()) ||
@@ -104,12 +175,14 @@ bool Quad3D::hasCommonSide(const Quad3D& other) const {
 }
 
 // Vérifie si deux quads ont la même surface
-bool Quad3D::sameSurface(const Quad3D& other) const {
-    return std::fabs(surface() - other.surface()) < TOLERANCE;
+template <typename Scalar>
+bool BasicQuad3D<Scalar>::sameSurface(const BasicQuad3D& other) const {
+    return std::fabs(surface() - other.surface()) < ScalarTraits<Scalar>::tolerance;
 }
 
 // Comparaison de quads
-bool Quad3D::equals(const Quad3D& other) const {
+template <typename Scalar>
+bool BasicQuad3D<Scalar>::equals(const BasicQuad3D& other) const {
     return (triangles_[0].equals(other.getFirstTriangle()) &&
             triangles_[1].equals(other.getSecondTriangle())) ||
            (triangles_[0].equals(other.getSecondTriangle()) &&
@@ -117,51 +190,66 @@ bool Quad3D::equals(const Quad3D& other) const {
 }
 
 // Surcharge de l'opérateur ==
-bool Quad3D::operator==(const Quad3D& other) const {
+template <typename Scalar>
+bool BasicQuad3D<Scalar>::operator==(const BasicQuad3D& other) const {
     return equals(other);
 }
 
-void Quad3D::orient(const Point3D& eye) {
+template <typename Scalar>
+void BasicQuad3D<Scalar>::orient(const Point& eye) {
     triangles_[0].orient(eye);
     triangles_[1].orient(eye);
 
-    auto normal1 = triangles_[0].getNormale();
-    auto normal2 = triangles_[1].getNormale();
+    const Point& normal1 = triangles_[0].getUnitNormal();
+    const Point& normal2 = triangles_[1].getUnitNormal();
 
     if (normal1.dotProduct(normal2) < 0) {
         triangles_[1].swapVertices(1, 3);
     }
 }
 
-Point3D Quad3D::center() const {
-    auto vertices = getVertices();
-    Point3D center;
+template <typename Scalar>
+BasicPoint3D<Scalar> BasicQuad3D<Scalar>::center() const {
+    std::array<Point, 4> vertices = getCorners();
+    Point center;
     for (const auto& vertex : vertices) {
         center = center + vertex;
     }
-    return center / static_cast<float>(vertices.size());
+    return center / static_cast<Scalar>(vertices.size());
 }
 
 // Surcharge de l'opérateur <<
-std::ostream& operator<<(std::ostream& os, const Quad3D& quad) {
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& os, const BasicQuad3D<Scalar>& quad) {
     os << "Quad3D:\n";
     os << "  Triangle 1: " << quad.getFirstTriangle() << "\n";
     os << "  Triangle 2: " << quad.getSecondTriangle() << "\n";
     return os;
 }
 
-void Quad3D::rotate(float angle, char axis) {
-    Point3D quadCenter = center();
+template <typename Scalar>
+void BasicQuad3D<Scalar>::rotate(float angle, char axis) {
+    transform(BasicTransform3D<Scalar>::rotation(angle, axis, center()));
+}
+
+template <typename Scalar>
+void BasicQuad3D<Scalar>::rotate(float angle, char axis, const Point& center) {
+    transform(BasicTransform3D<Scalar>::rotation(angle, axis, center));
+}
 
-    triangles_[0].rotate(angle, axis, quadCenter);
-    triangles_[1].rotate(angle, axis, quadCenter);
+template <typename Scalar>
+Scalar BasicQuad3D<Scalar>::averageDepth() const {
+    return (triangles_[0].averageDepth() + triangles_[1].averageDepth()) / 2;
 }
 
-void Quad3D::rotate(float angle, char axis, const Point3D& center) {
-    triangles_[0].rotate(angle, axis, center);
-    triangles_[1].rotate(angle, axis, center);
+template <typename Scalar>
+BasicQuad3D<float> BasicQuad3D<Scalar>::cameraRelative(const Point& eye) const {
+    BasicQuad3D<float> relative;
+    relative.triangles_ = {triangles_[0].cameraRelative(eye), triangles_[1].cameraRelative(eye)};
+    return relative;
 }
 
-float Quad3D::averageDepth() const {
-    return (triangles_[0].averageDepth() + triangles_[1].averageDepth()) / 2.0f;
-}
\ No newline at end of file
+template class BasicQuad3D<float>;
+template class BasicQuad3D<double>;
+template std::ostream& operator<<(std::ostream&, const Quad3D&);
+template std::ostream& operator<<(std::ostream&, const Quad3Dd&);
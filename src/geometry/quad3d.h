@@ -1,6 +1,9 @@
 /**
  * @file quad3D.h
- * @brief Déclaration de la classe Quad3D pour représenter un quadrilatère dans l'espace 3D.
+ * @brief Déclaration de la classe BasicQuad3D pour représenter un quadrilatère dans l'espace 3D.
+ *
+ * Quad3D (float) sert au rendu ; Quad3Dd (double) aux grands mondes. Les conteneurs SoA
+ * (VertexBuffer3D) restent en float : un Quad3Dd y est arrondi.
  */
 
 #ifndef QUAD3D_H
@@ -11,24 +14,35 @@
 #include "vector"
 #include <array>
 
+class VertexBuffer3D;
+template <typename Scalar>
+class BasicTransform3D;
+
 /**
- * @class Quad3D
- * @brief Classe représentant un quadrilatère dans l'espace 3D.
+ * @class BasicQuad3D
+ * @brief Classe représentant un quadrilatère dans l'espace 3D, de coordonnées de type Scalar.
  * 
  * La classe Quad3D permet de manipuler des quadrilatères composés de deux triangles 
  * dans un espace tridimensionnel, et fournit des méthodes pour calculer leurs propriétés.
  */
-class Quad3D {
+template <typename Scalar>
+class BasicQuad3D {
 private:
-    std::array<Triangle3D, 2> triangles_; ///< Tableau contenant les deux triangles qui composent le quadrilatère.
+    using Point = BasicPoint3D<Scalar>;
+    using Triangle = BasicTriangle3D<Scalar>;
+
+    template <typename Other>
+    friend class BasicQuad3D;
+
+    std::array<Triangle, 2> triangles_; ///< Tableau contenant les deux triangles qui composent le quadrilatère.
 
 public:
     /**
-     * @brief Constructeur par défaut de la classe Quad3D.
+     * @brief Constructeur par défaut de la classe BasicQuad3D.
      * 
      * Initialise un quadrilatère vide.
      */
-    Quad3D();
+    BasicQuad3D();
 
     /**
      * @brief Constructeur initialisant un quadrilatère à partir de deux triangles.
@@ -40,7 +54,7 @@ public:
      * @param bleu La composante bleue de la couleur du quadrilatère.
      * @pre Les triangles ne doivent pas être alignés.
      */
-    Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, int rouge = 0, int vert = 0, int bleu = 0);
+    BasicQuad3D(const Triangle& firstT, const Triangle& secondT, int rouge = 0, int vert = 0, int bleu = 0);
 
     /**
      * @brief Constructeur initialisant un quadrilatère à partir de deux triangles.
@@ -50,14 +64,14 @@ public:
      * @param color La couleur du quadrilatère.
      * @pre Les triangles ne doivent pas être alignés.
      */
-    Quad3D(const Triangle3D& firstT, const Triangle3D& secondT, const Couleur& color);
+    BasicQuad3D(const Triangle& firstT, const Triangle& secondT, const Couleur& color);
 
     /**
-     * @brief Constructeur par copie de la classe Quad3D.
+     * @brief Constructeur par copie de la classe BasicQuad3D.
      * 
      * @param other Le quadrilatère à copier.
      */
-    Quad3D(const Quad3D& other);
+    BasicQuad3D(const BasicQuad3D& other);
 
     /**
      * @brief Constructeur construisant un quadrilatère à partir de quatre points.
@@ -70,7 +84,7 @@ public:
      * @param bleu La composante bleue de la couleur du quadrilatère.
      * @pre Trois points ne doivents pas être alignés.
      */
-    Quad3D(const Point3D &p1, const Point3D &p2, const Point3D &p3, const Point3D &p4, int rouge = 0, int vert = 0, int bleu = 0);
+    BasicQuad3D(const Point &p1, const Point &p2, const Point &p3, const Point &p4, int rouge = 0, int vert = 0, int bleu = 0);
 
     /**
      * @brief Constructeur construisant un quadrilatère à partir de quatre points.
@@ -81,24 +95,79 @@ public:
      * @param color La couleur du quadrilatère.
      * @pre Trois points ne doivents pas être alignés.
      */
-    Quad3D(const Point3D& p1, const Point3D& p2, const Point3D& p3, const Point3D& p4, const Couleur& color);
+    BasicQuad3D(const Point& p1, const Point& p2, const Point& p3, const Point& p4, const Couleur& color);
+
+    /**
+     * @brief Constructeur sans validation, pour les sommets produits par un générateur.
+     *
+     * Les triangles (p1, p2, p3) et (p1, p3, p4) sont construits directement, sans test
+     * d'alignement ni de côté commun.
+     *
+     * @param p1 Premier sommet du quadrilatère.
+     * @param p2 Deuxième sommet du quadrilatère.
+     * @param p3 Troisième sommet du quadrilatère.
+     * @param p4 Quatrième sommet du quadrilatère.
+     * @param color La couleur du quadrilatère.
+     * @pre Trois points ne sont pas alignés (non vérifié).
+     */
+    BasicQuad3D(Unchecked, const Point& p1, const Point& p2, const Point& p3, const Point& p4, const Couleur& color)
+        : triangles_{Triangle(UNCHECKED, p1, p2, p3, color),
+                     Triangle(UNCHECKED, p1, p3, p4, color)} {}
+
+    /**
+     * @brief Vérifie, sans exception, que quatre sommets forment un quadrilatère valide.
+     *
+     * Les triangles (p1, p2, p3) et (p1, p3, p4) partagent toujours le côté [p1, p3] :
+     * seul l'alignement des sommets est testé.
+     *
+     * @return GeometryError::None si le quadrilatère est valide, GeometryError::CollinearPoints sinon.
+     */
+    static GeometryError validate(const Point& p1, const Point& p2, const Point& p3, const Point& p4) noexcept;
+
+    /**
+     * @brief Fabrique validante sans exception, pour les données fournies par l'utilisateur.
+     * @param p1 Premier sommet du quadrilatère.
+     * @param p2 Deuxième sommet du quadrilatère.
+     * @param p3 Troisième sommet du quadrilatère.
+     * @param p4 Quatrième sommet du quadrilatère.
+     * @param color La couleur du quadrilatère.
+     * @param out Reçoit le quadrilatère construit si les sommets sont valides (inchangé sinon).
+     * @return Le code d'erreur (GeometryError::None en cas de succès).
+     */
+    static GeometryError tryCreate(const Point& p1, const Point& p2, const Point& p3, const Point& p4,
+                                   const Couleur& color, BasicQuad3D& out) noexcept;
+
+    /**
+     * @brief Fabrique validante sans exception, à partir de composantes RVB brutes.
+     * @param p1 Premier sommet du quadrilatère.
+     * @param p2 Deuxième sommet du quadrilatère.
+     * @param p3 Troisième sommet du quadrilatère.
+     * @param p4 Quatrième sommet du quadrilatère.
+     * @param rouge La composante rouge.
+     * @param vert La composante verte.
+     * @param bleu La composante bleue.
+     * @param out Reçoit le quadrilatère construit si les sommets et la couleur sont valides (inchangé sinon).
+     * @return GeometryError::InvalidColor si une composante sort de [0, 255], sinon le code de tryCreate.
+     */
+    static GeometryError tryCreate(const Point& p1, const Point& p2, const Point& p3, const Point& p4,
+                                   int rouge, int vert, int bleu, BasicQuad3D& out) noexcept;
 
     /**
      * @brief Détruit le quadrilatère.
      */
-    ~Quad3D(){}
+    ~BasicQuad3D(){}
 
     /**
      * @brief Retourne le premier triangle du quadrilatère.
-     * @return const Triangle3D& Référence constante vers le premier triangle.
+     * @return const Triangle& Référence constante vers le premier triangle.
      */
-    const Triangle3D& getFirstTriangle() const noexcept;
+    const Triangle& getFirstTriangle() const noexcept;
 
     /**
      * @brief Retourne le deuxième triangle du quadrilatère.
-     * @return const Triangle3D& Référence constante vers le deuxième triangle.
+     * @return const Triangle& Référence constante vers le deuxième triangle.
      */
-    const Triangle3D& getSecondTriangle() const noexcept;
+    const Triangle& getSecondTriangle() const noexcept;
 
     /**
      * @brief Accesseur pour la couleur du quadrilatère.
@@ -154,9 +223,9 @@ public:
 
     /**
      * @brief Calcule la surface totale du quadrilatère.
-     * @return float La surface totale du quadrilatère.
+     * @return La surface totale du quadrilatère.
      */
-    float surface() const;
+    Scalar surface() const;
 
     /**
      * @brief Vérifie si un point est un sommet du quadrilatère.
@@ -164,7 +233,7 @@ public:
      * @return true Si le point est un sommet du quadrilatère.
      * @return false Sinon.
      */
-    bool isVertex(const Point3D& p) const;
+    bool isVertex(const Point& p) const;
 
     /**
      * @brief Vérifie si deux quadrilatères ont un côté en commun.
@@ -172,7 +241,7 @@ public:
      * @return true Si les deux quadrilatères ont un côté en commun.
      * @return false Sinon.
      */
-    bool hasCommonSide(const Quad3D& other) const;
+    bool hasCommonSide(const BasicQuad3D& other) const;
 
     /**
      * @brief Vérifie si deux quadrilatères ont un côté en commun (méthode statique).
@@ -181,7 +250,7 @@ public:
      * @return true Si les deux quadrilatères ont un côté en commun.
      * @return false Sinon.
      */
-    static bool hasCommonSide(const Quad3D& q1, const Quad3D& q2);
+    static bool hasCommonSide(const BasicQuad3D& q1, const BasicQuad3D& q2);
 
     /**
      * @brief Vérifie si deux quadrilatères ont la même surface.
@@ -189,7 +258,7 @@ public:
      * @return true Si les deux quadrilatères ont la même surface.
      * @return false Sinon.
      */
-    bool sameSurface(const Quad3D& other) const;
+    bool sameSurface(const BasicQuad3D& other) const;
 
     /**
      * @brief Compare deux quadrilatères pour vérifier s'ils sont égaux.
@@ -197,35 +266,85 @@ public:
      * @return true Si les deux quadrilatères sont égaux.
      * @return false Sinon.
      */
-    bool equals(const Quad3D& other) const;
+    bool equals(const BasicQuad3D& other) const;
 
     /**
      * @brief Calcule la normale au quadrilatère.
-     * @return Point3D Normale calculée à partir du premier triangle.
+     * @return Point Normale calculée à partir du premier triangle.
      */
-    Point3D getNormal() const {
+    Point getNormal() const {
         return getFirstTriangle().getNormale();
     }
 
+    /**
+     * @brief Retourne la normale unitaire stockée du premier triangle (sans recalcul).
+     * @return const Point& Normale unitaire du quadrilatère.
+     */
+    const Point& getUnitNormal() const {
+        return getFirstTriangle().getUnitNormal();
+    }
+
     /**
      * @brief Surcharge de l'opérateur d'égalité pour les quadrilatères.
      * @param other L'autre quadrilatère à comparer.
      * @return true Si les quadrilatères sont égaux.
      * @return false Sinon.
      */
-    bool operator==(const Quad3D& other) const;
+    bool operator==(const BasicQuad3D& other) const;
 
     /**
      * @brief Retrieves the vertices of the quadrilateral.
-     * @return A vector of Point3D objects representing the vertices of the quadrilateral.
+     * @return A vector of Point objects representing the vertices of the quadrilateral.
      */
-    std::vector<Point3D> getVertices() const;
+    std::vector<Point> getVertices() const;
+
+    /**
+     * @brief Retourne les quatre sommets du quadrilatère sans allocation.
+     * @return Les sommets dans l'ordre de getVertices().
+     */
+    std::array<Point, 4> getCorners() const {
+        return {triangles_[0].getP1(), triangles_[0].getP2(), triangles_[0].getP3(), triangles_[1].getP3()};
+    }
+
+    /**
+     * @brief Ajoute les six sommets des deux triangles à un conteneur SoA.
+     * @param buffer Le conteneur de sommets à compléter.
+     */
+    void appendVertices(VertexBuffer3D& buffer) const;
+
+    /**
+     * @brief Écrit les six sommets des deux triangles dans un conteneur SoA déjà dimensionné.
+     *
+     * Contrairement à appendVertices, plusieurs quadrilatères peuvent écrire en parallèle
+     * dans des plages disjointes du même conteneur.
+     *
+     * @param buffer Le conteneur de sommets (au moins first + 6 sommets).
+     * @param first L'indice du premier sommet du quadrilatère dans le conteneur.
+     */
+    void storeVertices(VertexBuffer3D& buffer, size_t first) const;
+
+    /**
+     * @brief Relit les six sommets des deux triangles depuis un conteneur SoA.
+     * @param buffer Le conteneur de sommets.
+     * @param first L'indice du premier sommet du quadrilatère dans le conteneur.
+     */
+    void loadVertices(const VertexBuffer3D& buffer, size_t first);
+
+    /**
+     * @brief Relit les six sommets, avec les normales et centroïdes calculés par lots
+     * (voir VertexBuffer3D::computeTriangleData).
+     * @param buffer Le conteneur de sommets.
+     * @param first L'indice du premier sommet du quadrilatère dans le conteneur (multiple de 3).
+     * @param normals Les normales unitaires, une par triangle.
+     * @param centroids Les centroïdes, un par triangle.
+     */
+    void loadVertices(const VertexBuffer3D& buffer, size_t first, const VertexBuffer3D& normals, const VertexBuffer3D& centroids);
 
     /**
      * @brief Translate le quadrilatère dans l'espace 3D.
-     * @param offset Le décalage à appliquer (Point3D).
+     * @param offset Le décalage à appliquer (Point).
      */
-    void translate(const Point3D& offset) {
+    void translate(const Point& offset) {
         triangles_[0].translate(offset);
         triangles_[1].translate(offset);
     }
@@ -235,13 +354,13 @@ public:
      * @param eye L'oeil de la caméra.
      * @return void
      */
-    void orient(const Point3D& eye);
+    void orient(const Point& eye);
 
     /**
      * @brief Retourne le centre du quadrilatère.
-     * @return Point3D Le centre du quadrilatère.
+     * @return Point Le centre du quadrilatère.
      */
-    Point3D center() const;
+    Point center() const;
 
     /**
      * @brief Effectue une rotation du quadrilatère autour d'un axe donné.
@@ -256,63 +375,71 @@ public:
      * @param axis Axe de rotation ('x', 'y' ou 'z').
      * @param center Centre de rotation.
      */
-    void rotate(float angle, char axis, const Point3D& center);
+    void rotate(float angle, char axis, const Point& center);
+
+    /**
+     * @brief Applique une transformation affine aux sommets du quadrilatère.
+     * @param transform La transformation à appliquer.
+     */
+    void transform(const BasicTransform3D<Scalar>& transform) {
+        triangles_[0].transform(transform);
+        triangles_[1].transform(transform);
+    }
+
+    /**
+     * @brief Exprime le quadrilatère par rapport à la caméra, en float, pour le rendu.
+     * @param eye La position de la caméra.
+     * @return Le quadrilatère relatif à la caméra, de même couleur.
+     */
+    BasicQuad3D<float> cameraRelative(const Point& eye) const;
 
     /**
      * @brief Calculates the average depth of the quad.
      * @return The average depth of the two triangles composing the quad.
      */
-    float averageDepth() const;
+    Scalar averageDepth() const;
 
     /**
      * @brief Calcule le centroïde du quadrilatère.
-     * @return Point3D Centroïde moyen des triangles.
+     * @return Point Centroïde moyen des triangles.
      */
-    Point3D getCentroid() const {
+    Point getCentroid() const {
 
-        Point3D centroid1 = triangles_[0].getCentroid();
-        Point3D centroid2 = triangles_[1].getCentroid();
+        Point centroid1 = triangles_[0].getCentroid();
+        Point centroid2 = triangles_[1].getCentroid();
 
-        return (centroid1 + centroid2) * 0.5;
+        return (centroid1 + centroid2) * Scalar(0.5);
     }
 
-    /**
-     * @brief Surcharge de l'opérateur de flux pour afficher les informations d'un quadrilatère.
-     * @param os Flux de sortie.
-     * @param quad Le quadrilatère à afficher.
-     * @return std::ostream& Le flux de sortie modifié.
-     */
-    friend std::ostream& operator<<(std::ostream& os, const Quad3D& quad);
-
     /**
      * @brief Compare la profondeur moyenne de deux quadrilatères en 3D.
      * @param other Le quadrilatère avec lequel effectuer la comparaison.
      * @return `true` si la profondeur moyenne de ce quadrilatère est inférieure à celle de `other`,
      *         `false` sinon.
      */
-    bool operator<(const Quad3D& other) const {
+    bool operator<(const BasicQuad3D& other) const {
         return this->averageDepth() < other.averageDepth();
     }
 
     /**
-     * @brief Opérateur d'affectation par défaut pour la classe Quad3D.
-     * @param other L'objet `Quad3D` à copier.
+     * @brief Opérateur d'affectation par défaut pour la classe BasicQuad3D.
+     * @param other L'objet `BasicQuad3D` à copier.
      * @return Une référence à cet objet après l'affectation.
      */
-    Quad3D& operator=(const Quad3D&) = default;
+    BasicQuad3D& operator=(const BasicQuad3D&) = default;
 
     /**
      * @brief Calcule la distance moyenne entre les sommets du quad et un point donné.
      * @param point Le point de référence pour lequel calculer la distance moyenne.
      * @return La distance moyenne entre les sommets du quad et le point donné.
      */
-    float averageDistanceTo(const Point3D& point) const {
+    Scalar averageDistanceTo(const Point& point) const {
 
-        const Triangle3D& t1 = getFirstTriangle();
-        const Triangle3D& t2 = getSecondTriangle();
+        const Triangle& t1 = getFirstTriangle();
+        const Triangle& t2 = getSecondTriangle();
 
         // Calculer la distance moyenne pour chaque triangle
-        float totalDistance = 0.0f;
+        Scalar totalDistance = 0;
         totalDistance += t1.getP1().distance(point);
         totalDistance += t1.getP2().distance(point);
         totalDistance += t1.getP3().distance(point);
@@ -321,9 +448,34 @@ public:
         totalDistance += t2.getP3().distance(point);
 
 
-        return totalDistance / 6.0f;
+        return totalDistance / 6;
     }
 
 };
 
+/**
+ * @brief Surcharge de l'opérateur de flux pour afficher les informations d'un quadrilatère.
+ * @param os Flux de sortie.
+ * @param quad Le quadrilatère à afficher.
+ * @return std::ostream& Le flux de sortie modifié.
+ */
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& os, const BasicQuad3D<Scalar>& quad);
+
+/**
+ * @brief Quadrilatère du chemin de rendu, en float.
+ */
+using Quad3D = BasicQuad3D<float>;
+
+/**
+ * @brief Quadrilatère de grand monde, en double.
+ */
+using Quad3Dd = BasicQuad3D<double>;
+
+// Instanciés dans quad3d.cpp
+extern template class BasicQuad3D<float>;
+extern template class BasicQuad3D<double>;
+extern template std::ostream& operator<<(std::ostream&, const Quad3D&);
+extern template std::ostream& operator<<(std::ostream&, const Quad3Dd&);
+
 #endif // QUAD3D_H
@@ -0,0 +1,63 @@
+#include "quaternion.h"
+#include <cmath>
+#include <stdexcept>
+#include "geometry_utils.h"
+
+Quaternion Quaternion::fromAxisAngle(const Point3D& axis, float angle) {
+    float length = axis.norm();
+    if (length < TOLERANCE) {
+        throw std::invalid_argument("L'axe de rotation ne peut pas être nul.");
+    }
+    float s = std::sin(angle * 0.5f) / length;
+    return Quaternion(std::cos(angle * 0.5f), axis.getX() * s, axis.getY() * s, axis.getZ() * s);
+}
+
+Quaternion Quaternion::fromAxisAngle(char axis, float angle) {
+    switch (axis) {
+        case 'x': return fromAxisAngle(Point3D(1, 0, 0), angle);
+        case 'y': return fromAxisAngle(Point3D(0, 1, 0), angle);
+        case 'z': return fromAxisAngle(Point3D(0, 0, 1), angle);
+        default:
+            throw std::invalid_argument("Axe invalide. Utilisez 'x', 'y' ou 'z'.");
+    }
+}
+
+Quaternion Quaternion::normalized() const {
+    float n = norm();
+    if (n < TOLERANCE) {
+        throw std::invalid_argument("Impossible de normaliser un quaternion nul.");
+    }
+    return Quaternion(w / n, x / n, y / n, z / n);
+}
+
+// Produit de Hamilton
+Quaternion operator*(const Quaternion& a, const Quaternion& b) {
+    return Quaternion(
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w
+    );
+}
+
+// v' = v + 2w (u x v) + 2 u x (u x v), avec u = (x, y, z)
+Point3D Quaternion::rotate(const Point3D& v) const {
+    Point3D u(x, y, z);
+    Point3D t = u.crossProduct(v) * 2.0f;
+    return v + t * w + u.crossProduct(t);
+}
+
+void Quaternion::toMatrix(float m[9]) const {
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    m[0] = 1 - 2 * (yy + zz); m[1] = 2 * (xy - wz);     m[2] = 2 * (xz + wy);
+    m[3] = 2 * (xy + wz);     m[4] = 1 - 2 * (xx + zz); m[5] = 2 * (yz - wx);
+    m[6] = 2 * (xz - wy);     m[7] = 2 * (yz + wx);     m[8] = 1 - 2 * (xx + yy);
+}
+
+std::ostream& operator<<(std::ostream& os, const Quaternion& q) {
+    os << "(" << q.getW() << ", " << q.getX() << ", " << q.getY() << ", " << q.getZ() << ")";
+    return os;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file quaternion.h
+ * @brief Déclaration de la classe Quaternion pour représenter une orientation dans l'espace 3D.
+ */
+#ifndef QUATERNION_H
+#define QUATERNION_H
+
+#include "point3d.h"
+#include <iostream>
+
+/**
+ * @class Quaternion
+ * @brief Classe représentant un quaternion (w, x, y, z).
+ *
+ * Les quaternions unitaires représentent des rotations autour d'un axe quelconque.
+ * Ils se composent sans dérive numérique notable et se convertissent en matrice 3x3
+ * pour être appliqués à un grand nombre de sommets.
+ */
+class Quaternion {
+    private:
+        float w; // Partie réelle.
+        float x; // Composante i.
+        float y; // Composante j.
+        float z; // Composante k.
+
+    public:
+        /**
+         * @brief Constructeur initialisant le quaternion (par défaut : identité).
+         * @param w Partie réelle.
+         * @param x Composante i.
+         * @param y Composante j.
+         * @param z Composante k.
+         */
+        Quaternion(float w = 1, float x = 0, float y = 0, float z = 0) : w(w), x(x), y(y), z(z) {}
+
+        /**
+         * @brief Construit le quaternion d'une rotation autour d'un axe quelconque.
+         * @param axis L'axe de rotation (n'a pas besoin d'être normalisé).
+         * @param angle L'angle de rotation en radians.
+         * @return Le quaternion unitaire correspondant.
+         * @throw std::invalid_argument Si l'axe est nul.
+         */
+        static Quaternion fromAxisAngle(const Point3D& axis, float angle);
+
+        /**
+         * @brief Construit le quaternion d'une rotation autour d'un axe principal.
+         * @param axis L'axe de rotation ('x', 'y' ou 'z').
+         * @param angle L'angle de rotation en radians.
+         * @return Le quaternion unitaire correspondant.
+         * @throw std::invalid_argument Si l'axe est invalide.
+         */
+        static Quaternion fromAxisAngle(char axis, float angle);
+
+        float getW() const { return w; }
+        float getX() const { return x; }
+        float getY() const { return y; }
+        float getZ() const { return z; }
+
+        /**
+         * @brief Calcule la norme du quaternion.
+         * @return La norme du quaternion.
+         */
+        float norm() const { return std::sqrt(w * w + x * x + y * y + z * z); }
+
+        /**
+         * @brief Retourne le quaternion normalisé.
+         * @return Le quaternion unitaire de même direction.
+         * @throw std::invalid_argument Si le quaternion est nul.
+         */
+        Quaternion normalized() const;
+
+        /**
+         * @brief Retourne le conjugué du quaternion (l'inverse pour un quaternion unitaire).
+         * @return Le quaternion conjugué.
+         */
+        Quaternion conjugate() const { return Quaternion(w, -x, -y, -z); }
+
+        /**
+         * @brief Composition de deux rotations : `(a * b)` applique d'abord `b`, puis `a`.
+         * @param a Le premier quaternion.
+         * @param b Le deuxième quaternion.
+         * @return Le produit de Hamilton des deux quaternions.
+         */
+        friend Quaternion operator*(const Quaternion& a, const Quaternion& b);
+
+        /**
+         * @brief Applique la rotation représentée par le quaternion (unitaire) à un vecteur.
+         * @param v Le vecteur à tourner.
+         * @return Le vecteur tourné.
+         */
+        Point3D rotate(const Point3D& v) const;
+
+        /**
+         * @brief Convertit le quaternion (unitaire) en matrice de rotation 3x3.
+         * @param m Les 9 coefficients de la matrice, stockés ligne par ligne.
+         */
+        void toMatrix(float m[9]) const;
+
+        /**
+         * @brief Surcharge de l'opérateur d'insertion pour afficher un quaternion.
+         * @param os Le flux de sortie.
+         * @param q Le quaternion à afficher.
+         * @return Le flux de sortie modifié.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const Quaternion& q);
+};
+
+#endif // QUATERNION_H
@@ -0,0 +1,50 @@
+#include "ray3d.h"
+#include "geometry_utils.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Ray3D::Ray3D(const Point3D& origin, const Point3D& direction) : origin(origin) {
+    float length = direction.norm();
+    if (length < TOLERANCE) {
+        throw std::invalid_argument("La direction d'un rayon ne peut pas être nulle.");
+    }
+    this->direction = direction * (1.0f / length);
+    // Une composante nulle donne un inverse infini, traité à part dans le test des slabs
+    inverseDirection = Point3D(1.0f / this->direction.getX(), 1.0f / this->direction.getY(), 1.0f / this->direction.getZ());
+}
+
+bool Ray3D::intersects(const BoundingBox3D& box, float& tEntry, float maxDistance) const {
+    if (box.isEmpty()) {
+        return false;
+    }
+    const float o[3] = {origin.getX(), origin.getY(), origin.getZ()};
+    const float inverse[3] = {inverseDirection.getX(), inverseDirection.getY(), inverseDirection.getZ()};
+    const float lo[3] = {box.getMin().getX(), box.getMin().getY(), box.getMin().getZ()};
+    const float hi[3] = {box.getMax().getX(), box.getMax().getY(), box.getMax().getZ()};
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (std::isinf(inverse[axis])) {
+            // Rayon parallèle au slab : tout ou rien selon la position de l'origine
+            if (o[axis] < lo[axis] || o[axis] > hi[axis]) {
+                return false;
+            }
+            continue;
+        }
+        float t1 = (lo[axis] - o[axis]) * inverse[axis];
+        float t2 = (hi[axis] - o[axis]) * inverse[axis];
+        tMin = std::max(tMin, std::min(t1, t2));
+        tMax = std::min(tMax, std::max(t1, t2));
+        if (tMin > tMax) {
+            return false;
+        }
+    }
+    tEntry = tMin;
+    return true;
+}
+
+std::ostream& operator<<(std::ostream& os, const Ray3D& ray) {
+    os << "Ray3D[Origin: " << ray.origin << ", Direction: " << ray.direction << "]";
+    return os;
+}
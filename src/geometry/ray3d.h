@@ -0,0 +1,63 @@
+/**
+ * @file ray3d.h
+ * @brief Déclaration de la classe Ray3D : demi-droite pour les requêtes de sélection et de visibilité.
+ */
+#ifndef RAY3D_H
+#define RAY3D_H
+
+#include "point3d.h"
+#include "bounding_volume3d.h"
+#include <iostream>
+#include <limits>
+
+/**
+ * @class Ray3D
+ * @brief Rayon défini par une origine et une direction unitaire.
+ *
+ * L'inverse de la direction est précalculé pour le test des plans parallèles (slabs) contre
+ * les boîtes englobantes, répété à chaque nœud des structures d'accélération.
+ */
+class Ray3D {
+    private:
+        Point3D origin;           // Origine du rayon.
+        Point3D direction;        // Direction unitaire.
+        Point3D inverseDirection; // Inverses des composantes de la direction (infinies si nulles).
+
+    public:
+        /**
+         * @brief Constructeur.
+         * @param origin L'origine du rayon.
+         * @param direction La direction (normalisée par le constructeur).
+         * @throw std::invalid_argument Si la direction est nulle.
+         */
+        Ray3D(const Point3D& origin, const Point3D& direction);
+
+        const Point3D& getOrigin() const { return origin; }
+        const Point3D& getDirection() const { return direction; }
+
+        /**
+         * @brief Calcule le point du rayon à une distance donnée de l'origine.
+         * @param t La distance.
+         * @return Le point origin + t * direction.
+         */
+        Point3D pointAt(float t) const { return origin + direction * t; }
+
+        /**
+         * @brief Teste l'intersection avec une boîte englobante (méthode des slabs).
+         * @param box La boîte.
+         * @param tEntry La distance d'entrée dans la boîte (0 si l'origine est dans la boîte).
+         * @param maxDistance La distance au-delà de laquelle les intersections sont ignorées.
+         * @return true si le rayon rencontre la boîte à une distance comprise entre 0 et maxDistance.
+         */
+        bool intersects(const BoundingBox3D& box, float& tEntry, float maxDistance = std::numeric_limits<float>::max()) const;
+
+        /**
+         * @brief Surcharge de l'opérateur d'insertion pour afficher le rayon.
+         * @param os Le flux de sortie.
+         * @param ray Le rayon à afficher.
+         * @return Le flux de sortie modifié.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const Ray3D& ray);
+};
+
+#endif // RAY3D_H
@@ -1,45 +1,200 @@
 #include "sphere3d.h"
 #include <stdexcept>
 #include <cmath>
-#include <iostream>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <unordered_map>
 #include "geometry_utils.h"
+#include "vertex_buffer3d.h"
+#include "thread_pool.h"
+#include "vertex_welder.h"
 
 // Constructeur avec centre, rayon, subdivisions et couleur RGB
-Sphere3D::Sphere3D(const Point3D& center, float radius, int subdivisions)
-    : center(center), radius(radius), subdivisions(subdivisions) {
+Sphere3D::Sphere3D(const Point3D& center, float radius, int subdivisions, SphereTessellation tessellation)
+    : mesh(), model(), subdivisions(subdivisions), tessellation(tessellation), meshError(0.0f),
+      worldQuads(), worldDirty(true), coarseLods(), currentLod(0) {
     if (radius <= 0) throw std::invalid_argument("Radius must be positive.");
     if (subdivisions <= 0) throw std::invalid_argument("Subdivisions must be positive.");
-    generateQuads(subdivisions, subdivisions, Couleur(255,255,255));
+    model = ModelTransform(center, Quaternion(), radius);
+    buildLods();
+}
+
+std::shared_ptr<std::vector<Quad3D>> Sphere3D::generateMesh(int level) const {
+    if (tessellation == SphereTessellation::Icosphere) {
+        return generateIcosphere(level, Couleur(UNCHECKED, 255, 255, 255));
+    }
+    return generateQuads(level, level, Couleur(UNCHECKED, 255, 255, 255));
+}
+
+// Le maillage complet, puis des niveaux de plus en plus grossiers
+void Sphere3D::buildLods() {
+    mesh = generateMesh(subdivisions);
+    meshError = tessellationError(*mesh);
+    worldDirty = true;
+    lodStrips.clear();
+
+    coarseLods.clear();
+    currentLod = 0;
+    const int minLevel = (tessellation == SphereTessellation::Icosphere) ? 1 : 3;
+    int level = subdivisions;
+    while (true) {
+        level = (tessellation == SphereTessellation::Icosphere) ? level - 1 : level / 2;
+        if (level < minLevel) {
+            break;
+        }
+        auto quads = generateMesh(level);
+        float error = tessellationError(*quads);
+        coarseLods.push_back({quads, error});
+    }
+}
+
+float Sphere3D::tessellationError(const std::vector<Quad3D>& quads) {
+    float maxError = 0.0f;
+    for (const auto& quad : quads) {
+        for (const Triangle3D* t : {&quad.getFirstTriangle(), &quad.getSecondTriangle()}) {
+            Point3D normal = (t->getP2() - t->getP1()).crossProduct(t->getP3() - t->getP1());
+            float length = normal.norm();
+            if (length <= 0.0f) {
+                continue;
+            }
+            float planeDistance = std::abs(normal.dotProduct(t->getP1())) / length;
+            maxError = std::max(maxError, 1.0f - planeDistance);
+        }
+    }
+    return maxError;
+}
+
+const std::vector<Quad3D>& Sphere3D::getLodQuads(int level) const {
+    if (level < 0 || level >= getLodCount()) {
+        throw std::out_of_range("Invalid level of detail.");
+    }
+    return level == 0 ? *mesh : *coarseLods[level - 1].quads;
+}
+
+void Sphere3D::exportMesh(Mesh3D& out, int level) const {
+    const std::vector<Quad3D>& quads = getLodQuads(level);
+    out.clear();
+    out.appendQuads(quads);
+}
+
+const StripMesh3D& Sphere3D::getLodStrips(int level) const {
+    const std::vector<Quad3D>& quads = getLodQuads(level);
+    if (lodStrips.size() != static_cast<size_t>(getLodCount())) {
+        lodStrips.assign(getLodCount(), nullptr);
+    }
+    auto& strips = lodStrips[level];
+    if (!strips) {
+        WeldReport report;
+        strips = std::make_shared<const StripMesh3D>(StripMesh3D::build(VertexWelder::weld(quads, report)));
+    }
+    return *strips;
+}
+
+float Sphere3D::getLodError(int level) const {
+    if (level < 0 || level >= getLodCount()) {
+        throw std::out_of_range("Invalid level of detail.");
+    }
+    return level == 0 ? meshError : coarseLods[level - 1].error;
+}
+
+int Sphere3D::selectLod(const Point3D& eye, float projectionPlaneDistance, float maxPixelError, float hysteresis) {
+    const float radius = getRadius();
+    // Même projection que le rendu : échelle d / (d + dz), évaluée au point le plus proche de l'œil
+    float nearest = getCenter().getZ() - eye.getZ() - radius;
+    if (nearest <= 0.0f) {
+        currentLod = 0;
+        return currentLod;
+    }
+    const float pixelsPerUnit = radius * projectionPlaneDistance / (projectionPlaneDistance + nearest);
+
+    // Niveau le plus grossier dont l'erreur projetée ne dépasse pas le seuil
+    auto coarsestWithin = [&](float threshold) {
+        for (int level = getLodCount() - 1; level > 0; --level) {
+            if (getLodError(level) * pixelsPerUnit <= threshold) {
+                return level;
+            }
+        }
+        return 0;
+    };
+
+    int target = coarsestWithin(maxPixelError);
+    if (target > currentLod) {
+        // Hystérésis : ne passer à un niveau plus grossier que nettement sous le seuil
+        target = std::max(currentLod, coarsestWithin(maxPixelError * (1.0f - hysteresis)));
+    }
+    currentLod = std::min(target, getLodCount() - 1);
+    return currentLod;
 }
 
 // Accesseur pour le centre
 const Point3D Sphere3D::getCenter() const {
-    return center;
+    return model.getPosition();
 }
 
-// Modificateur pour le centre
+// Modificateur pour le centre : seule la transformation de modèle change
 void Sphere3D::setCenter(const Point3D& newCenter) {
-    center = newCenter;
-    generateQuads(subdivisions, subdivisions, Couleur(255,255,255));
+    model.setPosition(newCenter);
+    worldDirty = true;
 }
 
 // Accesseur pour le rayon
 float Sphere3D::getRadius() const {
-    return radius;
+    return model.getScale();
 }
 
-// Modificateur pour le rayon
+// Le maillage unitaire est contenu dans la sphère unité : le rayon du modèle suffit
+BoundingBox3D Sphere3D::boundingBox() const {
+    Point3D half(model.getScale(), model.getScale(), model.getScale());
+    return BoundingBox3D(model.getPosition() - half, model.getPosition() + half);
+}
+
+BoundingSphere3D Sphere3D::boundingSphere() const {
+    return BoundingSphere3D(model.getPosition(), model.getScale());
+}
+
+// Modificateur pour le rayon : le maillage est unitaire, le rayon est l'échelle du modèle
 void Sphere3D::setRadius(float newRadius) {
     if (newRadius <= 0) {
         throw std::invalid_argument("The radius must be strictly positive.");
     }
-    radius = newRadius;
-    generateQuads(subdivisions, subdivisions, Couleur(255,255,255));
+    model.setScale(newRadius);
+    worldDirty = true;
 }
 
-// Accesseur pour les quadrilatères
+// Accesseur pour les quadrilatères placés dans le monde (recalculés à la demande)
 const std::vector<Quad3D>& Sphere3D::getQuads() const {
-    return quads;
+    if (worldDirty) {
+        Transform3D toWorld = model.toTransform3D();
+        worldQuads = *mesh;
+        parallelChunks(worldQuads.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                worldQuads[i].transform(toWorld);
+            }
+        });
+        worldDirty = false;
+    }
+    return worldQuads;
+}
+
+std::vector<Quad3D>& Sphere3D::unshare(std::shared_ptr<std::vector<Quad3D>>& quads) {
+    if (quads.use_count() > 1) {
+        quads = std::make_shared<std::vector<Quad3D>>(*quads);
+    }
+    return *quads;
+}
+
+// Copie-sur-écriture d'un niveau de détail grossier partagé
+std::vector<Quad3D>& Sphere3D::mutableCoarseLod(size_t index) {
+    lodStrips.clear();
+    return unshare(coarseLods[index].quads);
+}
+
+// Copie-sur-écriture du maillage partagé
+std::vector<Quad3D>& Sphere3D::mutableMesh() {
+    worldDirty = true;
+    lodStrips.clear();
+    return unshare(mesh);
 }
 
 /**
@@ -48,10 +203,10 @@ const std::vector<Quad3D>& Sphere3D::getQuads() const {
  * @param color La nouvelle couleur.
  */
 void Sphere3D::setQuadColor(int index, const Couleur& color) {
-    if (index < 0 || index >= static_cast<int>(quads.size())) {
+    if (index < 0 || index >= static_cast<int>(mesh->size())) {
         throw std::out_of_range("Invalid quad index.");
     }
-    quads[index].setColor(color);
+    mutableMesh()[index].setColor(color);
 }
 
 /**
@@ -60,67 +215,228 @@ void Sphere3D::setQuadColor(int index, const Couleur& color) {
  * @return La couleur du quadrilatère.
  */
 Couleur Sphere3D::getQuadColor(int index) const {
-    if (index < 0 || index >= static_cast<int>(quads.size())) {
+    if (index < 0 || index >= static_cast<int>(mesh->size())) {
         throw std::out_of_range("Invalid quad index.");
     }
-    return quads[index].getColor();
+    return (*mesh)[index].getColor();
 }
 
 // Calcul du volume de la sphère
 float Sphere3D::volume() const {
-    return (4.0f / 3.0f) * M_PI * std::pow(radius, 3);
+    return (4.0f / 3.0f) * M_PI * std::pow(getRadius(), 3);
 }
 
 // Calcul de la surface totale de la sphère
 float Sphere3D::surfaceArea() const {
-    return 4 * M_PI * std::pow(radius, 2);
+    return 4 * M_PI * std::pow(getRadius(), 2);
 }
 
-// Génération des quadrilatères
-void Sphere3D::generateQuads(int numSlices, int numStacks, const Couleur& color) {
-    quads.clear();
+// Génération des quadrilatères de la sphère unité centrée à l'origine.
+// Les sinus et cosinus sont tabulés une fois par anneau et par tranche, et les sommets
+// d'une grille (numStacks + 1) x numSlices sont calculés une seule fois. Les rangées
+// polaires sont des éventails de triangles, regroupés deux à deux en quadrilatères.
+// Les sommets étant valides par construction, les quadrilatères ne sont pas revalidés.
+std::shared_ptr<std::vector<Quad3D>> Sphere3D::generateQuads(int numSlices, int numStacks, const Couleur& color) {
     const float pi = M_PI;
     if (numSlices <= 0 || numStacks <= 0) {
         throw std::invalid_argument("numSlices et numStacks doivent être supérieurs à 0.");
     }
+    auto quads = std::make_shared<std::vector<Quad3D>>();
 
-    auto computePoint = [this](float theta, float phi) -> Point3D {
-        return Point3D(
-            center.getX() + radius * sin(theta) * cos(phi),
-            center.getY() + radius * cos(theta),
-            center.getZ() + radius * sin(theta) * sin(phi)
-        );
-    };
+    // En dessous de 3 tranches ou de 2 anneaux, toutes les faces sont dégénérées
+    if (numSlices < 3 || numStacks < 2) {
+        return quads;
+    }
+
+    std::vector<float> sinTheta(numStacks + 1), cosTheta(numStacks + 1);
+    for (int i = 0; i <= numStacks; ++i) {
+        float theta = i * (pi / numStacks);
+        sinTheta[i] = std::sin(theta);
+        cosTheta[i] = std::cos(theta);
+    }
+    // Pôles exacts
+    sinTheta[0] = sinTheta[numStacks] = 0.0f;
+    cosTheta[0] = 1.0f;
+    cosTheta[numStacks] = -1.0f;
 
-    auto shouldSkipQuad = [](const Point3D& p1, const Point3D& p2, const Point3D& p3, const Point3D& p4) -> bool {
-        return p1.distance(p2) < TOLERANCE || p2.distance(p3) < TOLERANCE || p3.distance(p4) < TOLERANCE || p4.distance(p1) < TOLERANCE;
+    std::vector<float> sinPhi(numSlices), cosPhi(numSlices);
+    for (int j = 0; j < numSlices; ++j) {
+        float phi = j * (2 * pi / numSlices);
+        sinPhi[j] = std::sin(phi);
+        cosPhi[j] = std::cos(phi);
+    }
+
+    // Sommets de la grille : l'anneau i, la tranche j (la tranche numSlices est la tranche 0)
+    std::vector<Point3D> grid;
+    grid.reserve(static_cast<size_t>(numStacks + 1) * numSlices);
+    for (int i = 0; i <= numStacks; ++i) {
+        for (int j = 0; j < numSlices; ++j) {
+            grid.emplace_back(sinTheta[i] * cosPhi[j], cosTheta[i], sinTheta[i] * sinPhi[j]);
+        }
+    }
+    auto vertex = [&](int i, int j) -> const Point3D& {
+        return grid[static_cast<size_t>(i) * numSlices + (j % numSlices)];
     };
 
-    for (int i = 0; i < numStacks; ++i) {
-        float theta1 = i * (pi / numStacks);
-        float theta2 = (i + 1) * (pi / numStacks);
+    const int capQuads = (numSlices + 1) / 2;
+    quads->reserve(static_cast<size_t>(numStacks - 2) * numSlices + 2 * capQuads);
+
+    // Calotte nord : triangles (pôle, a_j, a_j+1) regroupés deux à deux.
+    // Avec un nombre impair de tranches, le dernier quadrilatère recouvre le premier triangle.
+    const Point3D& north = vertex(0, 0);
+    for (int j = 0; j < numSlices; j += 2) {
+        quads->emplace_back(UNCHECKED, north, vertex(1, j), vertex(1, j + 1), vertex(1, j + 2), color);
+    }
 
+    for (int i = 1; i < numStacks - 1; ++i) {
         for (int j = 0; j < numSlices; ++j) {
-            float phi1 = j * (2 * pi / numSlices);
-            float phi2 = (j + 1) * (2 * pi / numSlices);
+            quads->emplace_back(UNCHECKED, vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1), color);
+        }
+    }
 
-            Point3D p1 = computePoint(theta1, phi1);
-            Point3D p2 = computePoint(theta2, phi1);
-            Point3D p3 = computePoint(theta2, phi2);
-            Point3D p4 = computePoint(theta1, phi2);
+    // Calotte sud : triangles (pôle, b_j+1, b_j) regroupés deux à deux
+    const Point3D& south = vertex(numStacks, 0);
+    for (int j = 0; j < numSlices; j += 2) {
+        quads->emplace_back(UNCHECKED, south, vertex(numStacks - 1, j + 2), vertex(numStacks - 1, j + 1), vertex(numStacks - 1, j), color);
+    }
+    return quads;
+}
 
-            if (shouldSkipQuad(p1, p2, p3, p4)) {
-                continue;
-            }
+// Génération de l'icosphère unité. Chaque losange (q1, q2, q3, q4) porte les triangles
+// (q1, q2, q3) et (q1, q3, q4), de diagonale q1-q3, orientés vers l'extérieur.
+std::shared_ptr<std::vector<Quad3D>> Sphere3D::generateIcosphere(int levels, const Couleur& color) {
+    if (levels < 0) {
+        throw std::invalid_argument("Le nombre de subdivisions doit être positif.");
+    }
+    // Chaque niveau quadruple le maillage : un nombre de subdivisions prévu pour une sphère UV serait démesuré
+    if (levels > MAX_ICOSPHERE_LEVEL) {
+        throw std::invalid_argument("Le nombre de subdivisions d'une icosphère ne doit pas dépasser MAX_ICOSPHERE_LEVEL.");
+    }
+    const float t = (1.0f + std::sqrt(5.0f)) / 2.0f;
+    std::vector<Point3D> vertices = {
+        Point3D(-1, t, 0), Point3D(1, t, 0), Point3D(-1, -t, 0), Point3D(1, -t, 0),
+        Point3D(0, -1, t), Point3D(0, 1, t), Point3D(0, -1, -t), Point3D(0, 1, -t),
+        Point3D(t, 0, -1), Point3D(t, 0, 1), Point3D(-t, 0, -1), Point3D(-t, 0, 1)
+    };
+    for (auto& vertex : vertices) {
+        vertex = vertex / vertex.norm();
+    }
+
+    // Les 20 faces de l'icosaèdre, regroupées deux à deux le long d'une arête commune
+    std::vector<std::array<int, 4>> rhombi = {
+        {5, 0, 11, 4}, {1, 0, 5, 9}, {7, 0, 1, 8}, {10, 0, 7, 6}, {11, 0, 10, 2},
+        {4, 3, 9, 5}, {2, 3, 4, 11}, {6, 3, 2, 10}, {8, 3, 6, 7}, {9, 3, 8, 1}
+    };
+
+    // Cache des milieux d'arêtes : une arête partagée n'est subdivisée qu'une fois
+    std::unordered_map<std::uint64_t, int> midpoints;
+    auto midpoint = [&](int a, int b) -> int {
+        std::uint64_t key = (static_cast<std::uint64_t>(std::min(a, b)) << 32) | static_cast<std::uint32_t>(std::max(a, b));
+        auto it = midpoints.find(key);
+        if (it != midpoints.end()) {
+            return it->second;
+        }
+        Point3D m = vertices[a] + vertices[b];
+        vertices.push_back(m / m.norm());
+        int index = static_cast<int>(vertices.size()) - 1;
+        midpoints.emplace(key, index);
+        return index;
+    };
+
+    for (int level = 0; level < levels; ++level) {
+        std::vector<std::array<int, 4>> next;
+        next.reserve(rhombi.size() * 4);
+        midpoints.clear();
+        midpoints.reserve(rhombi.size() * 5);
+        vertices.reserve(vertices.size() + rhombi.size() * 3);
 
-            quads.emplace_back(Quad3D(p1, p2, p3, p4, color));
+        for (const auto& r : rhombi) {
+            int a = r[0], b = r[1], c = r[2], d = r[3];
+            int ab = midpoint(a, b), bc = midpoint(b, c), cd = midpoint(c, d);
+            int da = midpoint(d, a), ac = midpoint(a, c);
+            next.push_back({a, ab, ac, da});
+            next.push_back({ab, b, bc, ac});
+            next.push_back({ac, bc, c, cd});
+            next.push_back({da, ac, cd, d});
         }
+        rhombi.swap(next);
+    }
+
+    auto quads = std::make_shared<std::vector<Quad3D>>();
+    quads->reserve(rhombi.size());
+    for (const auto& r : rhombi) {
+        quads->emplace_back(UNCHECKED, vertices[r[0]], vertices[r[1]], vertices[r[2]], vertices[r[3]], color);
     }
-    std::cout << quads.size() << " quads générés pour la sphère.\n";
+    return quads;
 }
 
+// Rotation en O(1) : seule la transformation de modèle est modifiée
 void Sphere3D::rotate(float angle, char axis, const Point3D& origin) {
-    for (auto& quad : quads) {
-        quad.rotate(angle, axis, origin);
+    model.rotate(angle, axis, origin);
+    worldDirty = true;
+}
+
+void Sphere3D::translate(const Point3D& offset) {
+    model.translate(offset);
+    worldDirty = true;
+}
+
+// Transformation quelconque : appliquée au maillage en espace objet, M^-1 * T * M
+void Sphere3D::transform(const Transform3D& transform) {
+    Transform3D local = model.toTransform3D().then(transform).then(model.toInverseTransform3D());
+
+    // Copie vers le conteneur SoA, transformation et relecture : chaque étape est répartie par blocs
+    auto applyLocal = [&local](std::vector<Quad3D>& quads) {
+        VertexBuffer3D buffer(quads.size() * 6);
+        parallelChunks(quads.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                quads[i].storeVertices(buffer, i * 6);
+            }
+        });
+
+        local.apply(buffer);
+        VertexBuffer3D normals, centroids;
+        buffer.computeTriangleData(normals, centroids);
+
+        parallelChunks(quads.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                quads[i].loadVertices(buffer, i * 6, normals, centroids);
+            }
+        });
+    };
+
+    applyLocal(mutableMesh());
+    for (size_t i = 0; i < coarseLods.size(); ++i) {
+        applyLocal(mutableCoarseLod(i));
+    }
+}
+
+// L'orientation est calculée en espace objet : la transformation de modèle conserve le sens.
+// Un niveau n'est copié (s'il est partagé) que si l'un de ses triangles doit être retourné.
+void Sphere3D::orient(const Point3D& eye) {
+    const Point3D localEye = model.applyInverse(eye);
+    // Même test que Triangle3D::orient
+    auto needsFlip = [&localEye](const std::vector<Quad3D>& quads) {
+        return std::any_of(quads.begin(), quads.end(), [&localEye](const Quad3D& quad) {
+            const Triangle3D& t1 = quad.getFirstTriangle();
+            const Triangle3D& t2 = quad.getSecondTriangle();
+            return t1.getUnitNormal().dotProduct(localEye - t1.getCentroid()) < 0 ||
+                   t2.getUnitNormal().dotProduct(localEye - t2.getCentroid()) < 0;
+        });
+    };
+    auto orientLevel = [&](std::shared_ptr<std::vector<Quad3D>>& quads) {
+        if (!needsFlip(*quads)) {
+            return false;
+        }
+        for (auto& quad : unshare(quads)) {
+            quad.orient(localEye);
+        }
+        return true;
+    };
+    if (orientLevel(mesh)) {
+        worldDirty = true;
+    }
+    for (Lod& lod : coarseLods) {
+        orientLevel(lod.quads);
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
  *
  * La classe Sphere3D permet de représenter une sphère à l'aide d'un centre et d'un rayon.
  * La sphère est discrétisée en un ensemble de quadrilatères (à travers des Quad3D).
+ * Les quadrilatères sont stockés une fois en espace objet (sphère unité centrée à l'origine)
+ * et placés dans le monde par une transformation de modèle (position = centre, échelle = rayon).
  */
 
 #ifndef SPHERE3D_H
@@ -11,40 +13,152 @@
 
 #include "point3d.h"
 #include "quad3d.h"
+#include "transform3d.h"
+#include "model_transform.h"
+#include "mesh3d.h"
+#include "strip_mesh3d.h"
+#include "bounding_volume3d.h"
 #include "../couleur.h"
+#include <memory>
 #include <vector>
 #include <cmath>
 #include <stdexcept>
 
+/**
+ * @brief Mode de tessellation d'une sphère.
+ */
+enum class SphereTessellation {
+    UV,        ///< Anneaux et tranches (coordonnées sphériques), calottes polaires en éventails.
+    Icosphere  ///< Icosaèdre subdivisé : triangles de tailles presque uniformes.
+};
+
+/**
+ * @brief Nombre maximal de subdivisions d'une icosphère (10 * 4^8 = 655 360 quadrilatères).
+ */
+constexpr int MAX_ICOSPHERE_LEVEL = 8;
+
 /**
  * @class Sphere3D
  * @brief Classe représentant une sphère dans l'espace 3D.
  *
  * La sphère est approximée par un ensemble de quadrilatères (à travers des Quad3D).
+ * Tourner ou déplacer la sphère ne modifie que sa transformation de modèle (O(1)) ;
+ * les copies partagent le même maillage tant qu'il n'est pas modifié.
  */
 class Sphere3D {
     private:
-        Point3D center;              // Centre de la sphère.
-        float radius;                // Rayon de la sphère.
-        int subdivisions;            // Nombre de subdivisions pour discrétiser la sphère.
-        std::vector<Quad3D> quads;   // Ensemble des quadrilatères représentant la sphère.
+        std::shared_ptr<std::vector<Quad3D>> mesh; // Quadrilatères en espace objet, partagés entre copies.
+        ModelTransform model;                      // Transformation de modèle (position = centre, échelle = rayon).
+        int subdivisions;                          // Nombre de subdivisions pour discrétiser la sphère.
+        SphereTessellation tessellation;           // Mode de tessellation du maillage.
+        float meshError;                           // Écart maximal du maillage complet à la sphère unité.
+        mutable std::vector<Quad3D> worldQuads;    // Cache des quadrilatères placés dans le monde.
+        mutable bool worldDirty;                   // Indique si le cache doit être recalculé.
+
+        /**
+         * @brief Niveau de détail grossier, précalculé à la construction.
+         */
+        struct Lod {
+            std::shared_ptr<std::vector<Quad3D>> quads; // Quadrilatères en espace objet, partagés entre copies.
+            float error;                                // Écart maximal à la sphère unité.
+        };
+        std::vector<Lod> coarseLods;               // Niveaux plus grossiers que le maillage, du plus fin au plus grossier.
+        int currentLod;                            // Niveau de détail choisi à la dernière sélection.
+        // Bandes de chaque niveau, construites à la demande. Elles ne décrivent que la topologie et les
+        // couleurs : orient, qui ne fait que retourner des triangles, ne les invalide pas.
+        mutable std::vector<std::shared_ptr<const StripMesh3D>> lodStrips;
+
+        /**
+         * @brief Génère les quadrilatères approximant la sphère unité centrée à l'origine.
+         *
+         * Les sinus et cosinus sont tabulés par anneau et par tranche. Les calottes polaires
+         * sont des éventails de triangles regroupés deux à deux en quadrilatères. Les sommets
+         * étant valides par construction, les quadrilatères sont créés sans validation.
+         * Moins de 3 tranches ou de 2 anneaux donnent un maillage vide.
+         *
+         * @return Le maillage généré.
+         */
+        static std::shared_ptr<std::vector<Quad3D>> generateQuads(int numSlices, int numStacks, const Couleur& color = Couleur(255, 255, 255));
+
+        /**
+         * @brief Génère le maillage de la sphère unité par subdivision d'un icosaèdre.
+         *
+         * Les 20 faces de l'icosaèdre sont regroupées en 10 losanges ; chaque subdivision
+         * découpe un losange en 4, les milieux d'arêtes étant partagés via un cache, puis
+         * projetés sur la sphère. Chaque Quad3D contient ainsi deux triangles de l'icosphère :
+         * le maillage compte 10 * 4^levels quadrilatères (20 * 4^levels triangles).
+         *
+         * @param levels Le nombre de subdivisions, entre 0 et MAX_ICOSPHERE_LEVEL.
+         * @param color La couleur des quadrilatères.
+         * @return Le maillage généré.
+         * @throw std::invalid_argument Si levels est négatif ou dépasse MAX_ICOSPHERE_LEVEL.
+         */
+        static std::shared_ptr<std::vector<Quad3D>> generateIcosphere(int levels, const Couleur& color = Couleur(255, 255, 255));
+
+        /**
+         * @brief Génère le maillage d'un niveau de subdivision selon le mode de tessellation.
+         * @param level Le nombre de subdivisions.
+         * @return Le maillage généré.
+         */
+        std::shared_ptr<std::vector<Quad3D>> generateMesh(int level) const;
+
+        /**
+         * @brief Calcule l'écart maximal d'un maillage inscrit à la sphère unité.
+         *
+         * Pour chaque triangle, l'écart est 1 moins la distance de l'origine à son plan
+         * (majorant de l'écart réel).
+         *
+         * @param quads Le maillage en espace objet.
+         * @return L'écart maximal.
+         */
+        static float tessellationError(const std::vector<Quad3D>& quads);
+
+        /**
+         * @brief Génère le maillage et les niveaux de détail grossiers.
+         *
+         * Le nombre de subdivisions est divisé par deux à chaque niveau en mode UV (au moins 3),
+         * et diminué d'un niveau en mode icosphère (au moins 1).
+         */
+        void buildLods();
 
         /**
-         * @brief Génère les quadrilatères approximant la sphère.
-         * Cette méthode utilise une approche basée sur les coordonnées sphériques
-         * pour créer les quadrilatères approximant la sphère.
+         * @brief Accès modifiable au maillage, copié au préalable s'il est partagé.
+         * @return Une référence modifiable vers les quadrilatères en espace objet.
          */
-        void generateQuads(int numSlices, int numStacks, const Couleur& color = Couleur(255, 255, 255));
+        std::vector<Quad3D>& mutableMesh();
+
+        /**
+         * @brief Copie un niveau de détail s'il est partagé, sans invalider les bandes.
+         *
+         * Réservé aux modifications qui ne changent ni les sommets ni les couleurs (orient).
+         *
+         * @param quads Le maillage ou un niveau grossier.
+         * @return Une référence modifiable vers les quadrilatères du niveau.
+         */
+        static std::vector<Quad3D>& unshare(std::shared_ptr<std::vector<Quad3D>>& quads);
+
+        /**
+         * @brief Accès modifiable à un niveau de détail grossier, copié au préalable s'il est partagé.
+         * @param index L'indice dans coarseLods.
+         * @return Une référence modifiable vers les quadrilatères du niveau.
+         */
+        std::vector<Quad3D>& mutableCoarseLod(size_t index);
 
     public:
         /**
          * @brief Constructeur de la classe Sphere3D.
          * @param center Le centre de la sphère.
          * @param radius Le rayon de la sphère (doit être positif).
-         * @param subdivisions Le nombre de subdivisions pour discrétiser la sphère (doit être > 0).
+         * @param subdivisions Le nombre de subdivisions pour discrétiser la sphère (doit être > 0) :
+         * anneaux et tranches en mode UV, niveaux de subdivision de l'icosaèdre en mode Icosphere
+         * (au plus MAX_ICOSPHERE_LEVEL).
+         * @param tessellation Le mode de tessellation. À qualité visuelle égale, une icosphère
+         * demande environ 30 à 40 % de triangles en moins qu'une sphère UV.
          * @pre Le rayon doit être strictement positif.
+         * @throw std::invalid_argument Si le rayon ou le nombre de subdivisions est invalide.
          */
-        Sphere3D(const Point3D& center = Point3D(), float radius = 1, int subdivisions = 1);
+        Sphere3D(const Point3D& center = Point3D(), float radius = 1, int subdivisions = 1,
+                 SphereTessellation tessellation = SphereTessellation::UV);
 
         /**
          * @brief Constructeur par copie de la classe Sphere3D.
@@ -52,8 +166,10 @@ class Sphere3D {
          * @return Une nouvelle sphère qui est une copie de other.
          */
         Sphere3D(const Sphere3D& other)
-            : center(other.center), radius(other.radius), subdivisions(other.subdivisions), quads(other.quads) {
-            if (radius <= 0 || subdivisions <= 0) {
+            : mesh(other.mesh), model(other.model), subdivisions(other.subdivisions),
+              tessellation(other.tessellation), meshError(other.meshError), worldQuads(), worldDirty(true),
+              coarseLods(other.coarseLods), currentLod(other.currentLod), lodStrips(other.lodStrips) {
+            if (!mesh || subdivisions <= 0) {
                 throw std::invalid_argument("Cannot copy a sphere with invalid parameters.");
             }
         }
@@ -63,6 +179,12 @@ class Sphere3D {
          */
         const Point3D getCenter() const;
 
+        /**
+         * @brief Accesseur pour le mode de tessellation.
+         * @return Le mode de tessellation du maillage.
+         */
+        SphereTessellation getTessellation() const { return tessellation; }
+
         /**
          * @brief Modifie le centre de la sphère.
          * @param center Le nouveau centre de la sphère.
@@ -75,6 +197,18 @@ class Sphere3D {
          */
         float getRadius() const;
 
+        /**
+         * @brief Calcule la boîte englobante de la sphère dans le monde (O(1)).
+         * @return La boîte centrée sur la sphère, de demi-dimension égale au rayon.
+         */
+        BoundingBox3D boundingBox() const;
+
+        /**
+         * @brief Retourne la sphère englobante de la sphère dans le monde (O(1)).
+         * @return La sphère de même centre et de même rayon.
+         */
+        BoundingSphere3D boundingSphere() const;
+
         /**
          * @brief Modifie le rayon de la sphère.
          * @param radius Le nouveau rayon (doit être strictement positif).
@@ -83,21 +217,130 @@ class Sphere3D {
         void setRadius(float radius);
 
         /**
-         * @brief Accesseur constant pour les quadrilatères qui composent la sphère.
+         * @brief Accesseur constant pour les quadrilatères qui composent la sphère, placés dans le monde.
+         *
+         * Les quadrilatères sont recalculés à partir du maillage et de la transformation
+         * de modèle au premier appel qui suit une modification, puis mis en cache.
+         * Le rendu utilise plutôt getLocalQuads() et getModelTransform().
+         *
          * @return Une référence constante vers le vecteur des quadrilatères (`std::vector<Quad3D>`).
          */
         const std::vector<Quad3D>& getQuads() const;
 
         /**
-         * @brief Accesseur modifiable pour les quadrilatères qui composent la sphère.
-         * @return Une référence modifiable vers le vecteur des quadrilatères (`std::vector<Quad3D>`).
+         * @brief Accesseur pour les quadrilatères en espace objet (sphère unité centrée à l'origine).
+         * @return Une référence constante vers le maillage.
          */
-        std::vector<Quad3D>& getQuads() {
-            return quads;
+        const std::vector<Quad3D>& getLocalQuads() const { return *mesh; }
+
+        /**
+         * @brief Accesseur pour le maillage partagé, afin qu'une autre sphère puisse le réutiliser.
+         * @return Un pointeur partagé vers le maillage en espace objet.
+         */
+        std::shared_ptr<const std::vector<Quad3D>> getMesh() const { return mesh; }
+
+        /**
+         * @brief Accesseur pour la transformation de modèle.
+         * @return La transformation de modèle de la sphère.
+         */
+        const ModelTransform& getModelTransform() const { return model; }
+
+        /**
+         * @brief Modifie la transformation de modèle.
+         * @param newModel La nouvelle transformation (position = centre, échelle = rayon).
+         */
+        void setModelTransform(const ModelTransform& newModel) {
+            model = newModel;
+            worldDirty = true;
         }
 
+        /**
+         * @brief Retourne le nombre de niveaux de détail (le niveau 0 est le maillage complet).
+         * @return Le nombre de niveaux de détail.
+         */
+        int getLodCount() const { return 1 + static_cast<int>(coarseLods.size()); }
+
+        /**
+         * @brief Accesseur pour les quadrilatères d'un niveau de détail, en espace objet.
+         * @param level Le niveau (0 = maillage complet, de plus en plus grossier ensuite).
+         * @return Une référence constante vers les quadrilatères du niveau.
+         * @throw std::out_of_range Si le niveau est invalide.
+         */
+        const std::vector<Quad3D>& getLodQuads(int level) const;
+
+        /**
+         * @brief Exporte un niveau de détail en espace objet dans un maillage indexé (vidé au préalable).
+         *
+         * Le maillage passé garde sa capacité : le rendu le réutilise d'une image à l'autre.
+         *
+         * @param out Le maillage à remplir.
+         * @param level Le niveau de détail (0 = maillage complet).
+         * @throw std::out_of_range Si le niveau est invalide.
+         */
+        void exportMesh(Mesh3D& out, int level = 0) const;
+
+        /**
+         * @brief Accesseur pour un niveau de détail en bandes et éventails de triangles, en espace objet.
+         *
+         * Les anneaux deviennent des bandes et les calottes des éventails autour des pôles.
+         * Construites au premier appel (fusion des sommets puis regroupement), les bandes sont
+         * gardées jusqu'à la prochaine modification du maillage.
+         *
+         * @param level Le niveau de détail (0 = maillage complet).
+         * @return Les bandes du niveau.
+         * @throw std::out_of_range Si le niveau est invalide.
+         */
+        const StripMesh3D& getLodStrips(int level = 0) const;
+
+        /**
+         * @brief Retourne un niveau de détail en espace objet sous forme de maillage indexé.
+         * @param level Le niveau de détail (0 = maillage complet).
+         * @return Le maillage.
+         * @throw std::out_of_range Si le niveau est invalide.
+         */
+        Mesh3D toMesh(int level = 0) const {
+            Mesh3D mesh;
+            exportMesh(mesh, level);
+            return mesh;
+        }
+
+        /**
+         * @brief Écart maximal d'un niveau de détail à la sphère unité (à multiplier par le rayon).
+         * @param level Le niveau de détail.
+         * @return L'écart géométrique du niveau.
+         * @throw std::out_of_range Si le niveau est invalide.
+         */
+        float getLodError(int level) const;
+
+        /**
+         * @brief Choisit le niveau de détail à afficher selon l'erreur projetée à l'écran.
+         *
+         * L'erreur d'un niveau en pixels est son écart géométrique multiplié par le rayon et par
+         * le facteur de projection du point de la sphère le plus proche de l'œil. Le niveau le plus
+         * grossier dont l'erreur ne dépasse pas `maxPixelError` est retenu. Pour éviter les
+         * changements de niveau répétés (popping), on passe à un niveau plus grossier seulement
+         * si son erreur reste sous `maxPixelError * (1 - hysteresis)` ; le passage à un niveau
+         * plus fin est immédiat.
+         *
+         * @param eye La position de l'œil.
+         * @param projectionPlaneDistance La distance du plan de projection.
+         * @param maxPixelError L'erreur maximale tolérée, en pixels.
+         * @param hysteresis La marge relative avant de passer à un niveau plus grossier (entre 0 et 1).
+         * @return Le niveau choisi.
+         */
+        int selectLod(const Point3D& eye, float projectionPlaneDistance, float maxPixelError = 1.0f, float hysteresis = 0.25f);
+
+        /**
+         * @brief Accesseur pour le niveau de détail choisi à la dernière sélection.
+         * @return Le niveau de détail courant.
+         */
+        int getCurrentLod() const { return currentLod; }
+
         /**
          * @brief Modifie la couleur d'un quadrilatère spécifique de la sphère.
+         *
+         * L'indice se rapporte au maillage complet (niveau 0) ; les niveaux grossiers gardent leur couleur.
+         *
          * @param index L'indice du quadrilatère.
          * @param color La nouvelle couleur.
          * @throw std::out_of_range Si l'indice est invalide.
@@ -125,13 +368,41 @@ class Sphere3D {
         float surfaceArea() const;
 
         /**
-         * @brief Fait pivoter la sphère autour d'un axe donné.
+         * @brief Translate la sphère (O(1), seule la transformation de modèle est modifiée).
+         * @param offset Le vecteur de translation.
+         */
+        void translate(const Point3D& offset);
+
+        /**
+         * @brief Fait pivoter la sphère autour d'un axe donné (O(1), seule la transformation de modèle est modifiée).
          * @param angle L'angle de rotation (en radians).
          * @param axis L'axe de rotation ('x', 'y', 'z').
          * @param origin Le point autour duquel effectuer la rotation.
          */
         void rotate(float angle, char axis, const Point3D& origin);
 
+        /**
+         * @brief Applique une transformation affine quelconque à la sphère.
+         *
+         * Une transformation affine quelconque ne se réduit pas à une transformation de modèle :
+         * elle est donc appliquée au maillage (en espace objet, en une passe sur un conteneur SoA).
+         * Le centre et le rayon ne sont pas mis à jour. Pour une rotation ou une translation,
+         * préférer rotate() et translate(), en O(1).
+         *
+         * @param transform La transformation à appliquer.
+         */
+        void transform(const Transform3D& transform);
+
+        /**
+         * @brief Oriente les quadrilatères dans le sens trigonométrique vu depuis l'œil.
+         *
+         * Un niveau de détail dont aucun triangle n'est à retourner n'est pas modifié : il reste
+         * partagé avec les copies de la sphère. Les bandes déjà construites restent valables.
+         *
+         * @param eye La position de l'œil dans le monde.
+         */
+        void orient(const Point3D& eye);
+
         /**
          * @brief Opérateur d'affectation par défaut pour la classe Sphere3D.
          * @param other La sphère à copier.
@@ -0,0 +1,162 @@
+#include "strip_mesh3d.h"
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    constexpr uint32_t NO_TRIANGLE = UINT32_MAX;
+
+    uint64_t directedKey(uint32_t from, uint32_t to) {
+        return (static_cast<uint64_t>(from) << 32) | to;
+    }
+}
+
+StripMesh3D StripMesh3D::build(const Mesh3D& mesh, size_t maxLength) {
+    if (maxLength == 0) {
+        throw std::invalid_argument("Une primitive doit pouvoir contenir au moins un triangle.");
+    }
+    const std::vector<uint32_t>& meshIndices = mesh.getIndices();
+    const uint32_t triangleCount = static_cast<uint32_t>(mesh.getTriangleCount());
+    auto face = [&meshIndices](uint32_t t) {
+        return std::array<uint32_t, 3>{meshIndices[3 * t], meshIndices[3 * t + 1], meshIndices[3 * t + 2]};
+    };
+
+    // Arête orientée -> triangle qui la porte ; sommet -> triangles incidents
+    std::unordered_map<uint64_t, uint32_t> edgeOwner;
+    edgeOwner.reserve(3 * triangleCount);
+    std::vector<std::vector<uint32_t>> vertexTriangles(mesh.getVertexCount());
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        const auto f = face(t);
+        for (int k = 0; k < 3; ++k) {
+            edgeOwner.emplace(directedKey(f[k], f[(k + 1) % 3]), t);
+            vertexTriangles[f[k]].push_back(t);
+        }
+    }
+    std::vector<char> used(triangleCount, 0);
+
+    // Triangle libre portant l'arête orientée from -> to, et son troisième sommet
+    auto across = [&](uint32_t from, uint32_t to, uint32_t& third) -> uint32_t {
+        auto it = edgeOwner.find(directedKey(from, to));
+        if (it == edgeOwner.end() || used[it->second]) {
+            return NO_TRIANGLE;
+        }
+        for (uint32_t v : face(it->second)) {
+            if (v != from && v != to) {
+                third = v;
+            }
+        }
+        return it->second;
+    };
+
+    StripMesh3D result;
+    result.positions = mesh.getPositions();
+    result.indices.reserve(triangleCount + 2);
+    result.faceColors.reserve(triangleCount);
+    auto emit = [&](PrimitiveType type, const std::vector<uint32_t>& vertices, const std::vector<uint32_t>& triangles) {
+        result.primitives.push_back({type, static_cast<uint32_t>(result.indices.size()), static_cast<uint32_t>(vertices.size()),
+                                     static_cast<uint32_t>(result.faceColors.size())});
+        result.indices.insert(result.indices.end(), vertices.begin(), vertices.end());
+        for (uint32_t t : triangles) {
+            used[t] = 1;
+            result.faceColors.push_back(mesh.getFaceColor(t));
+        }
+    };
+
+    std::vector<uint32_t> vertices, triangles;
+
+    // Éventails autour des sommets de forte valence
+    for (uint32_t center = 0; center < vertexTriangles.size(); ++center) {
+        const std::vector<uint32_t>& around = vertexTriangles[center];
+        if (around.size() < FAN_MIN_VALENCE) {
+            continue;
+        }
+        for (uint32_t start : around) {
+            if (used[start]) {
+                continue;
+            }
+            // Triangle (center, x, y) ; on recule tant qu'un triangle (center, w, x) est libre
+            auto f = face(start);
+            while (f[0] != center) {
+                f = {f[1], f[2], f[0]};
+            }
+            const uint32_t origin = start;
+            uint32_t x = f[1], y = f[2];
+            for (size_t steps = 0; steps < around.size(); ++steps) {
+                uint32_t w = 0;
+                uint32_t previous = across(x, center, w);
+                if (previous == NO_TRIANGLE || previous == origin) {
+                    break;
+                }
+                start = previous;
+                y = x;
+                x = w;
+            }
+            vertices = {center, x, y};
+            triangles = {start};
+            used[start] = 1;
+            uint32_t z = 0;
+            for (uint32_t next = across(center, y, z); next != NO_TRIANGLE && triangles.size() < maxLength; next = across(center, y, z)) {
+                used[next] = 1;
+                triangles.push_back(next);
+                vertices.push_back(z);
+                y = z;
+            }
+            for (uint32_t t : triangles) {
+                used[t] = 0;
+            }
+            if (triangles.size() >= 2) {
+                emit(PrimitiveType::Fan, vertices, triangles);
+            }
+        }
+    }
+
+    // Bandes : pour chaque triangle libre, la rotation de départ qui donne la bande la plus longue
+    std::vector<uint32_t> bestVertices, bestTriangles;
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        if (used[t]) {
+            continue;
+        }
+        bestTriangles.clear();
+        auto f = face(t);
+        for (int rotation = 0; rotation < 3; ++rotation) {
+            vertices = {f[rotation], f[(rotation + 1) % 3], f[(rotation + 2) % 3]};
+            triangles = {t};
+            used[t] = 1;
+            while (triangles.size() < maxLength) {
+                // Le triangle k suivant porte l'arête v[k] -> v[k+1] (k pair) ou v[k+1] -> v[k] (k impair)
+                size_t k = vertices.size() - 2;
+                uint32_t a = vertices[k], b = vertices[k + 1], third = 0;
+                uint32_t next = (k % 2 == 0) ? across(a, b, third) : across(b, a, third);
+                if (next == NO_TRIANGLE) {
+                    break;
+                }
+                used[next] = 1;
+                triangles.push_back(next);
+                vertices.push_back(third);
+            }
+            for (uint32_t id : triangles) {
+                used[id] = 0;
+            }
+            if (triangles.size() > bestTriangles.size()) {
+                bestVertices = vertices;
+                bestTriangles = triangles;
+            }
+        }
+        emit(PrimitiveType::Strip, bestVertices, bestTriangles);
+    }
+    return result;
+}
+
+Mesh3D StripMesh3D::toMesh() const {
+    Mesh3D mesh;
+    mesh.reserve(positions.size(), faceColors.size());
+    for (const Point3D& position : positions) {
+        mesh.addVertex(position);
+    }
+    for (const TrianglePrimitive& primitive : primitives) {
+        for (uint32_t k = 0; k + 2 < primitive.count; ++k) {
+            const auto triangle = triangleAt(primitive, k);
+            mesh.addTriangle(triangle[0], triangle[1], triangle[2], faceColors[primitive.firstFace + k]);
+        }
+    }
+    return mesh;
+}
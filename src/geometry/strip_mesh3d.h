@@ -0,0 +1,114 @@
+/**
+ * @file strip_mesh3d.h
+ * @brief Déclaration de la classe StripMesh3D : maillage découpé en bandes et en éventails de triangles.
+ *
+ * Dans une bande, chaque triangle partage une arête avec le précédent : il n'apporte qu'un
+ * nouveau sommet. Dans un éventail, tous les triangles partagent le sommet central. Le rendu
+ * n'a ainsi qu'un sommet à lire par triangle ; il trie ensuite les triangles un par un (FrameBuilder).
+ */
+#ifndef STRIP_MESH3D_H
+#define STRIP_MESH3D_H
+
+#include "mesh3d.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Nombre maximal de triangles par bande ou éventail par défaut.
+ *
+ * Des primitives courtes limitent le nombre de sommets à relire quand une bande ne peut plus être prolongée.
+ */
+constexpr size_t DEFAULT_STRIP_LENGTH = 16;
+
+/**
+ * @brief Nombre minimal de triangles autour d'un sommet pour en faire un éventail (pôles des sphères UV).
+ */
+constexpr size_t FAN_MIN_VALENCE = 8;
+
+/**
+ * @brief Type d'une primitive.
+ */
+enum class PrimitiveType {
+    Strip, ///< Triangle k : (v[k], v[k+1], v[k+2]), les deux premiers échangés pour k impair.
+    Fan    ///< Triangle k : (v[0], v[k+1], v[k+2]).
+};
+
+/**
+ * @struct TrianglePrimitive
+ * @brief Une bande ou un éventail : une plage de sommets dans StripMesh3D::getIndices().
+ */
+struct TrianglePrimitive {
+    PrimitiveType type;
+    uint32_t first;     ///< Premier indice de la plage.
+    uint32_t count;     ///< Nombre d'indices (nombre de triangles + 2).
+    uint32_t firstFace; ///< Indice de la couleur du premier triangle.
+};
+
+/**
+ * @class StripMesh3D
+ * @brief Maillage indexé regroupé en bandes et éventails, construit à partir d'un Mesh3D.
+ *
+ * Les triangles gardent l'ordre cyclique de leurs sommets dans le maillage d'origine, donc leur
+ * orientation, et leur couleur. Le regroupement suit les arêtes orientées : deux triangles voisins
+ * d'orientations incohérentes ne sont simplement pas enchaînés.
+ */
+class StripMesh3D {
+    private:
+        std::vector<Point3D> positions;
+        std::vector<uint32_t> indices;
+        std::vector<TrianglePrimitive> primitives;
+        std::vector<Couleur> faceColors; // Une couleur par triangle, dans l'ordre des primitives.
+
+    public:
+        /**
+         * @brief Constructeur par défaut : aucun triangle.
+         */
+        StripMesh3D() = default;
+
+        /**
+         * @brief Regroupe les triangles d'un maillage en éventails (sommets de forte valence) puis en bandes.
+         *
+         * Les sommets doivent être partagés entre triangles voisins (voir VertexWelder).
+         *
+         * @param mesh Le maillage indexé.
+         * @param maxLength Le nombre maximal de triangles par primitive.
+         * @return Le maillage en bandes.
+         * @throw std::invalid_argument Si maxLength est nul.
+         */
+        static StripMesh3D build(const Mesh3D& mesh, size_t maxLength = DEFAULT_STRIP_LENGTH);
+
+        const std::vector<Point3D>& getPositions() const { return positions; }
+        const std::vector<uint32_t>& getIndices() const { return indices; }
+        const std::vector<TrianglePrimitive>& getPrimitives() const { return primitives; }
+        const std::vector<Couleur>& getFaceColors() const { return faceColors; }
+
+        /**
+         * @brief Retourne le nombre de triangles.
+         */
+        size_t getTriangleCount() const { return faceColors.size(); }
+
+        /**
+         * @brief Retourne les sommets du triangle k d'une primitive, dans l'ordre d'origine.
+         * @param primitive La primitive.
+         * @param k L'indice du triangle dans la primitive.
+         * @return Les indices des trois sommets.
+         */
+        std::array<uint32_t, 3> triangleAt(const TrianglePrimitive& primitive, uint32_t k) const {
+            const uint32_t* v = &indices[primitive.first];
+            if (primitive.type == PrimitiveType::Fan) {
+                return {v[0], v[k + 1], v[k + 2]};
+            }
+            return (k % 2 == 0) ? std::array<uint32_t, 3>{v[k], v[k + 1], v[k + 2]}
+                                : std::array<uint32_t, 3>{v[k + 1], v[k], v[k + 2]};
+        }
+
+        /**
+         * @brief Reconstruit la liste de triangles équivalente.
+         * @return Le maillage indexé (mêmes sommets, triangles dans l'ordre des primitives).
+         */
+        Mesh3D toMesh() const;
+};
+
+#endif // STRIP_MESH3D_H
@@ -0,0 +1,130 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    // Vrai pendant l'exécution d'un bloc : les boucles imbriquées restent séquentielles
+    thread_local bool insideChunk = false;
+
+    // Marque le thread comme étant dans un bloc, et rétablit l'état précédent même si le bloc lève une exception
+    struct ChunkScope {
+        bool previous;
+        ChunkScope() : previous(insideChunk) { insideChunk = true; }
+        ~ChunkScope() { insideChunk = previous; }
+        ChunkScope(const ChunkScope&) = delete;
+        ChunkScope& operator=(const ChunkScope&) = delete;
+    };
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Une exception ne sort jamais d'ici : elle est gardée pour parallelFor, et chaque bloc est compté,
+// exécuté ou non, pour que l'attente de fin de boucle se termine
+std::size_t ThreadPool::runChunks() {
+    std::size_t processed = 0;
+    ChunkScope scope;
+    for (std::size_t k = nextChunk.fetch_add(1); k < chunkCount; k = nextChunk.fetch_add(1)) {
+        if (!failed.load(std::memory_order_relaxed)) {
+            std::size_t begin = k * chunkSize;
+            try {
+                (*body)(begin, std::min(begin + chunkSize, count));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+        ++processed;
+    }
+    return processed;
+}
+
+void ThreadPool::workerLoop() {
+    std::size_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wakeUp.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping) {
+            return;
+        }
+        seen = generation;
+        ++activeWorkers;
+        lock.unlock();
+
+        std::size_t processed = runChunks();
+
+        lock.lock();
+        doneChunks += processed;
+        if (--activeWorkers == 0) {
+            finished.notify_all();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t chunk, const std::function<void(std::size_t, std::size_t)>& body) {
+    if (chunk == 0) {
+        throw std::invalid_argument("La taille des blocs doit être strictement positive.");
+    }
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty() || insideChunk || count <= chunk) {
+        body(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(submitMutex);
+    std::unique_lock<std::mutex> lock(mutex);
+    // Un thread réveillé en retard par la boucle précédente doit en être sorti avant la publication
+    finished.wait(lock, [&] { return activeWorkers == 0; });
+    this->body = &body;
+    this->count = count;
+    chunkSize = chunk;
+    chunkCount = (count + chunk - 1) / chunk;
+    nextChunk = 0;
+    doneChunks = 0;
+    failed = false;
+    firstError = nullptr;
+    ++generation;
+    lock.unlock();
+    wakeUp.notify_all();
+
+    std::size_t processed = runChunks();
+
+    lock.lock();
+    doneChunks += processed;
+    finished.wait(lock, [&] { return doneChunks == chunkCount && activeWorkers == 0; });
+    this->body = nullptr;
+    // Plus aucun thread n'exécute body : l'exception peut remonter à l'appelant
+    std::exception_ptr error = firstError;
+    firstError = nullptr;
+    lock.unlock();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file thread_pool.h
+ * @brief Déclaration de la classe ThreadPool, réserve de threads pour les traitements par lots.
+ *
+ * Les boucles sur de grands maillages (transformations de sommets, placement dans le monde)
+ * sont découpées en blocs de taille fixe répartis entre les threads.
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Réserve de threads exécutant des boucles parallèles découpées en blocs.
+ *
+ * Le découpage ne dépend que du nombre d'éléments et de la taille des blocs, jamais du nombre
+ * de threads : tant que chaque élément est traité indépendamment, le résultat est identique
+ * (au bit près) quel que soit le nombre de threads. Le thread appelant participe au travail.
+ */
+class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wakeUp;   // Réveille les threads lorsqu'une boucle est publiée.
+        std::condition_variable finished; // Signale la fin de tous les blocs d'une boucle.
+
+        // Boucle en cours : modifiée sous mutex uniquement lorsqu'aucun thread ne l'exécute
+        const std::function<void(std::size_t, std::size_t)>* body = nullptr;
+        std::size_t count = 0;
+        std::size_t chunkSize = 1;
+        std::size_t chunkCount = 0;
+        std::atomic<std::size_t> nextChunk{0}; // Prochain bloc à distribuer.
+        std::size_t doneChunks = 0;            // Blocs terminés (protégé par mutex).
+        std::size_t activeWorkers = 0;         // Threads en train d'exécuter des blocs (protégé par mutex).
+        std::size_t generation = 0;            // Incrémenté à chaque boucle publiée.
+        std::atomic<bool> failed{false};       // Un bloc a levé une exception : les suivants sont sautés.
+        std::exception_ptr firstError;         // Première exception levée par un bloc (protégée par mutex).
+        bool stopping = false;
+
+        std::mutex submitMutex; // Une seule boucle publiée à la fois.
+
+        void workerLoop();
+
+        // Exécute des blocs jusqu'à épuisement ; retourne le nombre de blocs traités (ou sautés après une exception)
+        std::size_t runChunks();
+
+    public:
+        /**
+         * @brief Constructeur.
+         * @param threadCount Le nombre total de threads, thread appelant compris (0 : nombre de cœurs).
+         */
+        explicit ThreadPool(std::size_t threadCount = 0);
+
+        /**
+         * @brief Destructeur : attend la fin des threads.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Retourne le nombre total de threads, thread appelant compris.
+         */
+        std::size_t getThreadCount() const { return workers.size() + 1; }
+
+        /**
+         * @brief Exécute body(début, fin) sur les blocs [k * chunk, min((k + 1) * chunk, count)).
+         *
+         * Bloque jusqu'à la fin de tous les blocs. Un appel depuis un bloc en cours
+         * (boucle imbriquée) est exécuté séquentiellement par le thread appelant.
+         * Si un bloc lève une exception, sur n'importe quel thread, les blocs non commencés sont
+         * sautés ; parallelFor attend la fin des blocs en cours, puis relance la première exception.
+         *
+         * @param count Le nombre d'éléments.
+         * @param chunk La taille d'un bloc (strictement positive).
+         * @param body La fonction appelée pour chaque bloc.
+         * @throw std::invalid_argument Si la taille de bloc est nulle.
+         * @throw L'exception levée par body, le cas échéant.
+         */
+        void parallelFor(std::size_t count, std::size_t chunk, const std::function<void(std::size_t, std::size_t)>& body);
+
+        /**
+         * @brief Réserve partagée par les traitements de la bibliothèque, créée au premier appel.
+         * @return La réserve (un thread par cœur).
+         */
+        static ThreadPool& shared();
+};
+
+/**
+ * @brief Nombre d'éléments à partir duquel les traitements par lots sont répartis entre les threads.
+ *
+ * En dessous, le coût de synchronisation dépasse le gain.
+ */
+constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
+
+/**
+ * @brief Taille des blocs des traitements par lots (multiple de 8 pour garder les blocs AVX alignés).
+ */
+constexpr std::size_t PARALLEL_CHUNK = 1 << 14;
+
+/**
+ * @brief Exécute body sur [0, count) : en un seul appel sous PARALLEL_THRESHOLD,
+ * par blocs de PARALLEL_CHUNK sur la réserve partagée au-delà.
+ * @param count Le nombre d'éléments.
+ * @param body La fonction appelée pour chaque bloc (début, fin).
+ */
+template <typename Body>
+void parallelChunks(std::size_t count, Body&& body) {
+    if (count < PARALLEL_THRESHOLD) {
+        body(std::size_t(0), count);
+        return;
+    }
+    ThreadPool::shared().parallelFor(count, PARALLEL_CHUNK, body);
+}
+
+#endif // THREAD_POOL_H
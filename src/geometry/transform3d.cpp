@@ -0,0 +1,136 @@
+#include "transform3d.h"
+#include "vertex_buffer3d.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Construit la matrice 3x4 d'une application linéaire r (3x3) autour d'un centre :
+// p' = r (p - c) + c = r p + (c - r c)
+template <typename Scalar>
+std::array<Scalar, 12> aroundCenter(const Scalar r[9], const BasicPoint3D<Scalar>& center) {
+    Scalar cx = center.getX(), cy = center.getY(), cz = center.getZ();
+    return {
+        r[0], r[1], r[2], cx - (r[0] * cx + r[1] * cy + r[2] * cz),
+        r[3], r[4], r[5], cy - (r[3] * cx + r[4] * cy + r[5] * cz),
+        r[6], r[7], r[8], cz - (r[6] * cx + r[7] * cy + r[8] * cz)
+    };
+}
+
+}
+
+template <typename Scalar>
+BasicTransform3D<Scalar>::BasicTransform3D() : m{1, 0, 0, 0,
+                                                 0, 1, 0, 0,
+                                                 0, 0, 1, 0} {}
+
+template <typename Scalar>
+BasicTransform3D<Scalar> BasicTransform3D<Scalar>::translation(const Point& offset) {
+    return BasicTransform3D({1, 0, 0, offset.getX(),
+                             0, 1, 0, offset.getY(),
+                             0, 0, 1, offset.getZ()});
+}
+
+template <typename Scalar>
+BasicTransform3D<Scalar> BasicTransform3D<Scalar>::scaling(Scalar factor, const Point& center) {
+    const Scalar r[9] = {factor, 0, 0,
+                         0, factor, 0,
+                         0, 0, factor};
+    return BasicTransform3D(aroundCenter(r, center));
+}
+
+// Rotation autour d'un axe principal : sinus et cosinus calculés une seule fois
+template <typename Scalar>
+BasicTransform3D<Scalar> BasicTransform3D<Scalar>::rotation(float angle, char axis, const Point& center) {
+    const Scalar c = std::cos(static_cast<Scalar>(angle));
+    const Scalar s = std::sin(static_cast<Scalar>(angle));
+
+    switch (axis) {
+        case 'x': {
+            const Scalar r[9] = {1, 0, 0,  0, c, -s,  0, s, c};
+            return BasicTransform3D(aroundCenter(r, center));
+        }
+        case 'y': {
+            const Scalar r[9] = {c, 0, s,  0, 1, 0,  -s, 0, c};
+            return BasicTransform3D(aroundCenter(r, center));
+        }
+        case 'z': {
+            const Scalar r[9] = {c, -s, 0,  s, c, 0,  0, 0, 1};
+            return BasicTransform3D(aroundCenter(r, center));
+        }
+        default:
+            throw std::invalid_argument("Axe invalide. Utilisez 'x', 'y' ou 'z'.");
+    }
+}
+
+template <typename Scalar>
+BasicTransform3D<Scalar> BasicTransform3D<Scalar>::rotation(float angle, const Point& axis, const Point& center) {
+    return rotation(Quaternion::fromAxisAngle(pointCast<float>(axis), angle), center);
+}
+
+// Les quaternions sont en float : la matrice de rotation est convertie, le centre garde sa précision
+template <typename Scalar>
+BasicTransform3D<Scalar> BasicTransform3D<Scalar>::rotation(const Quaternion& q, const Point& center) {
+    float rotation[9];
+    q.toMatrix(rotation);
+    Scalar r[9];
+    std::copy(rotation, rotation + 9, r);
+    return BasicTransform3D(aroundCenter(r, center));
+}
+
+// Produit de deux matrices affines 3x4 (ligne implicite 0 0 0 1)
+template <typename Scalar>
+BasicTransform3D<Scalar> operator*(const BasicTransform3D<Scalar>& a, const BasicTransform3D<Scalar>& b) {
+    std::array<Scalar, 12> r;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            Scalar value = a.at(row, 0) * b.at(0, col) +
+                           a.at(row, 1) * b.at(1, col) +
+                           a.at(row, 2) * b.at(2, col);
+            if (col == 3) {
+                value += a.at(row, 3);
+            }
+            r[row * 4 + col] = value;
+        }
+    }
+    return BasicTransform3D<Scalar>(r);
+}
+
+template <typename Scalar>
+void BasicTransform3D<Scalar>::apply(VertexBuffer3D& buffer) const {
+    if constexpr (std::is_same_v<Scalar, float>) {
+        buffer.transform(m.data());
+    } else {
+        std::array<float, 12> rounded;
+        std::copy(m.begin(), m.end(), rounded.begin());
+        buffer.transform(rounded.data());
+    }
+}
+
+template <typename Scalar>
+BasicTransform3D<float> BasicTransform3D<Scalar>::cameraRelative(const Point& eye) const {
+    std::array<float, 12> relative;
+    std::copy(m.begin(), m.end(), relative.begin());
+    relative[3] = static_cast<float>(m[3] - eye.getX());
+    relative[7] = static_cast<float>(m[7] - eye.getY());
+    relative[11] = static_cast<float>(m[11] - eye.getZ());
+    return BasicTransform3D<float>(relative);
+}
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& os, const BasicTransform3D<Scalar>& t) {
+    os << "Transform3D[";
+    for (int row = 0; row < 3; ++row) {
+        os << (row ? "; " : "") << t.at(row, 0) << ", " << t.at(row, 1) << ", " << t.at(row, 2) << ", " << t.at(row, 3);
+    }
+    os << "]";
+    return os;
+}
+
+template class BasicTransform3D<float>;
+template class BasicTransform3D<double>;
+template Transform3D operator*(const Transform3D&, const Transform3D&);
+template Transform3Dd operator*(const Transform3Dd&, const Transform3Dd&);
+template std::ostream& operator<<(std::ostream&, const Transform3D&);
+template std::ostream& operator<<(std::ostream&, const Transform3Dd&);
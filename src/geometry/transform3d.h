@@ -0,0 +1,202 @@
+/**
+ * @file transform3d.h
+ * @brief Déclaration de la classe BasicTransform3D pour représenter une transformation affine 3D.
+ *
+ * Une transformation est stockée sous forme de matrice 3x4 (rotation/échelle + translation).
+ * Elle est construite une seule fois (un seul calcul de sinus et cosinus par rotation),
+ * puis appliquée à des maillages entiers. Plusieurs opérations se composent en une seule
+ * matrice, appliquée en une seule passe.
+ *
+ * Transform3D (float) transforme les sommets du rendu ; Transform3Dd (double) place les objets
+ * d'un grand monde, puis cameraRelative en tire la Transform3D relative à la caméra.
+ */
+#ifndef TRANSFORM3D_H
+#define TRANSFORM3D_H
+
+#include "point3d.h"
+#include "quaternion.h"
+#include <array>
+#include <iostream>
+
+class VertexBuffer3D;
+
+/**
+ * @class BasicTransform3D
+ * @brief Classe représentant une transformation affine 3D (matrice 3x4), de coefficients de type Scalar.
+ *
+ * La matrice est stockée ligne par ligne :
+ * `x' = m[0]*x + m[1]*y + m[2]*z + m[3]`,
+ * `y' = m[4]*x + m[5]*y + m[6]*z + m[7]`,
+ * `z' = m[8]*x + m[9]*y + m[10]*z + m[11]`.
+ */
+template <typename Scalar>
+class BasicTransform3D {
+    private:
+        using Point = BasicPoint3D<Scalar>;
+
+        std::array<Scalar, 12> m; // Coefficients de la matrice 3x4.
+
+    public:
+        /**
+         * @brief Constructeur par défaut (transformation identité).
+         */
+        BasicTransform3D();
+
+        /**
+         * @brief Constructeur à partir des 12 coefficients de la matrice 3x4.
+         * @param matrix Les coefficients, stockés ligne par ligne.
+         */
+        explicit BasicTransform3D(const std::array<Scalar, 12>& matrix) : m(matrix) {}
+
+        /**
+         * @brief Retourne la transformation identité.
+         * @return La transformation identité.
+         */
+        static BasicTransform3D identity() { return BasicTransform3D(); }
+
+        /**
+         * @brief Construit une translation.
+         * @param offset Le vecteur de translation.
+         * @return La transformation correspondante.
+         */
+        static BasicTransform3D translation(const Point& offset);
+
+        /**
+         * @brief Construit une mise à l'échelle uniforme autour d'un centre.
+         * @param factor Le facteur d'échelle.
+         * @param center Le centre de la mise à l'échelle (par défaut : origine).
+         * @return La transformation correspondante.
+         */
+        static BasicTransform3D scaling(Scalar factor, const Point& center = Point());
+
+        /**
+         * @brief Construit une rotation autour d'un axe principal passant par un centre.
+         * @param angle L'angle de rotation en radians.
+         * @param axis L'axe de rotation ('x', 'y' ou 'z').
+         * @param center Le centre de rotation (par défaut : origine).
+         * @return La transformation correspondante.
+         * @throw std::invalid_argument Si l'axe est invalide.
+         */
+        static BasicTransform3D rotation(float angle, char axis, const Point& center = Point());
+
+        /**
+         * @brief Construit une rotation autour d'un axe quelconque passant par un centre.
+         * @param angle L'angle de rotation en radians.
+         * @param axis La direction de l'axe de rotation (n'a pas besoin d'être normalisée).
+         * @param center Le centre de rotation (par défaut : origine).
+         * @return La transformation correspondante.
+         * @throw std::invalid_argument Si l'axe est nul.
+         */
+        static BasicTransform3D rotation(float angle, const Point& axis, const Point& center = Point());
+
+        /**
+         * @brief Construit la rotation représentée par un quaternion unitaire autour d'un centre.
+         * @param q Le quaternion unitaire.
+         * @param center Le centre de rotation (par défaut : origine).
+         * @return La transformation correspondante.
+         */
+        static BasicTransform3D rotation(const Quaternion& q, const Point& center = Point());
+
+        /**
+         * @brief Accès direct aux 12 coefficients de la matrice.
+         * @return Un pointeur vers le premier coefficient.
+         */
+        const Scalar* data() const { return m.data(); }
+
+        /**
+         * @brief Accesseur pour un coefficient de la matrice.
+         * @param row La ligne (0 à 2).
+         * @param col La colonne (0 à 3).
+         * @return Le coefficient demandé.
+         */
+        Scalar at(int row, int col) const { return m[row * 4 + col]; }
+
+        /**
+         * @brief Enchaîne une autre transformation après celle-ci.
+         * @param next La transformation à appliquer ensuite.
+         * @return La transformation composée (`next * *this`).
+         */
+        BasicTransform3D then(const BasicTransform3D& next) const { return next * *this; }
+
+        /**
+         * @brief Applique la transformation à un point.
+         * @param p Le point à transformer.
+         * @return Le point transformé.
+         */
+        Point apply(const Point& p) const {
+            Scalar x = p.getX(), y = p.getY(), z = p.getZ();
+            return Point(m[0] * x + m[1] * y + m[2] * z + m[3],
+                           m[4] * x + m[5] * y + m[6] * z + m[7],
+                           m[8] * x + m[9] * y + m[10] * z + m[11]);
+        }
+
+        /**
+         * @brief Applique uniquement la partie linéaire (sans translation) à un vecteur.
+         * @param v Le vecteur à transformer.
+         * @return Le vecteur transformé.
+         */
+        Point applyToVector(const Point& v) const {
+            Scalar x = v.getX(), y = v.getY(), z = v.getZ();
+            return Point(m[0] * x + m[1] * y + m[2] * z,
+                           m[4] * x + m[5] * y + m[6] * z,
+                           m[8] * x + m[9] * y + m[10] * z);
+        }
+
+        /**
+         * @brief Applique la transformation à tous les sommets d'un conteneur SoA en une passe.
+         *
+         * Les sommets d'un VertexBuffer3D sont en float : les coefficients sont d'abord arrondis en float.
+         *
+         * @param buffer Le conteneur de sommets.
+         */
+        void apply(VertexBuffer3D& buffer) const;
+
+        /**
+         * @brief Exprime la transformation par rapport à la caméra, en float, pour le rendu.
+         *
+         * La translation est diminuée de la position de l'œil dans le type d'origine avant
+         * l'arrondi : les objets d'un grand monde proches de la caméra ne tremblent pas.
+         *
+         * @param eye La position de la caméra.
+         * @return La transformation qui donne directement les coordonnées relatives à l'œil.
+         */
+        BasicTransform3D<float> cameraRelative(const Point& eye) const;
+};
+
+/**
+ * @brief Composition : `(a * b)` applique d'abord `b`, puis `a`.
+ * @param a La transformation appliquée en second.
+ * @param b La transformation appliquée en premier.
+ * @return La transformation composée.
+ */
+template <typename Scalar>
+BasicTransform3D<Scalar> operator*(const BasicTransform3D<Scalar>& a, const BasicTransform3D<Scalar>& b);
+
+/**
+ * @brief Surcharge de l'opérateur d'insertion pour afficher la matrice.
+ * @param os Le flux de sortie.
+ * @param t La transformation à afficher.
+ * @return Le flux de sortie modifié.
+ */
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& os, const BasicTransform3D<Scalar>& t);
+
+/**
+ * @brief Transformation du chemin de rendu, en float.
+ */
+using Transform3D = BasicTransform3D<float>;
+
+/**
+ * @brief Transformation de grand monde, en double.
+ */
+using Transform3Dd = BasicTransform3D<double>;
+
+// Instanciées dans transform3d.cpp
+extern template class BasicTransform3D<float>;
+extern template class BasicTransform3D<double>;
+extern template Transform3D operator*(const Transform3D&, const Transform3D&);
+extern template Transform3Dd operator*(const Transform3Dd&, const Transform3Dd&);
+extern template std::ostream& operator<<(std::ostream&, const Transform3D&);
+extern template std::ostream& operator<<(std::ostream&, const Transform3Dd&);
+
+#endif // TRANSFORM3D_H
@@ -1,38 +1,54 @@
 /**
  * @file Triangle3D.h
- * @brief Déclaration de la classe Triangle3D pour représenter un triangle dans l'espace 3D.
+ * @brief Déclaration de la classe BasicTriangle3D pour représenter un triangle dans l'espace 3D.
  *
- * Cette classe représente un triangle dans l'espace tridimensionnel, défini par trois points.
+ * Cette classe représente un triangle dans l'espace tridimensionnel, défini par trois points,
+ * paramétrée par le type des coordonnées : Triangle3D (float) pour le rendu, Triangle3Dd
+ * (double) pour les grands mondes.
  */
 #ifndef TRIANGLE3D_H
 #define TRIANGLE3D_H
 
 #include "point3d.h"
+#include "geometry_utils.h"
 #include "../couleur.h"
 #include <iostream>
 #include <cmath>
 #include <stdexcept>
 
+template <typename Scalar>
+class BasicTransform3D;
+
 /**
- * @class Triangle3D
- * @brief Classe représentant un triangle dans l'espace 3D.
+ * @class BasicTriangle3D
+ * @brief Classe représentant un triangle dans l'espace 3D, de coordonnées de type Scalar.
  *
- * La classe Triangle3D permet de manipuler les triangles en trois dimensions.
+ * La classe BasicTriangle3D permet de manipuler les triangles en trois dimensions.
  */
-class Triangle3D {
+template <typename Scalar>
+class BasicTriangle3D {
 
     private:
-        Point3D p1; // Premier sommet du triangle.
-        Point3D p2; // Deuxième sommet du triangle.
-        Point3D p3; // Troisième sommet du triangle.
+        using Point = BasicPoint3D<Scalar>;
+
+        Point p1; // Premier sommet du triangle.
+        Point p2; // Deuxième sommet du triangle.
+        Point p3; // Troisième sommet du triangle.
         Couleur color; //couleur du triangle
+        Point normal;   // Normale unitaire (nulle si le triangle est dégénéré), tenue à jour à chaque modification.
+        Point centroid; // Centroïde, tenu à jour à chaque modification.
+
+        /**
+         * @brief Recalcule la normale unitaire et le centroïde à partir des sommets.
+         */
+        void updateDerived();
         
     public:
 
         /**
-        * @brief Constructeur par défaut de la classe Triangle3D.
+        * @brief Constructeur par défaut de la classe BasicTriangle3D.
         */
-        Triangle3D();
+        BasicTriangle3D();
 
         /**
          * @brief Constructeur initialisant le triangle avec trois points donnés et une couleur spécifique.
@@ -44,7 +60,7 @@ class Triangle3D {
          * @param bleu La composante bleue de la couleur du triangle.
          * @pre Les trois sommets ne doivent pas être alignés.
          */
-        Triangle3D(const Point3D& p1, const Point3D& p2, const Point3D& p3, int rouge =255, int vert=255, int bleu =255);
+        BasicTriangle3D(const Point& p1, const Point& p2, const Point& p3, int rouge =255, int vert=255, int bleu =255);
 
         /**
          * @brief Constructeur initialisant le triangle avec des valeurs spécifiques pour les trois sommets dans l'ordre
@@ -55,54 +71,136 @@ class Triangle3D {
          * @param color La couleur du triangle.
          * @pre Les trois sommets ne doivent pas être alignés.
          */
-        Triangle3D(const Point3D& p1, const Point3D& p2, const Point3D& p3, const Couleur& color);
+        BasicTriangle3D(const Point& p1, const Point& p2, const Point& p3, const Couleur& color);
+
+        /**
+         * @brief Constructeur sans validation, pour les sommets produits par un générateur.
+         * @param p1 Premier sommet du triangle.
+         * @param p2 Deuxième sommet du triangle.
+         * @param p3 Troisième sommet du triangle.
+         * @param color La couleur du triangle.
+         * @pre Les trois sommets ne sont pas alignés (non vérifié).
+         */
+        BasicTriangle3D(Unchecked, const Point& p1, const Point& p2, const Point& p3, const Couleur& color)
+            : p1(p1), p2(p2), p3(p3), color(color) {
+            updateDerived();
+        }
+
+        /**
+         * @brief Vérifie, sans exception, que trois sommets forment un triangle valide.
+         * @return GeometryError::None si les sommets ne sont pas alignés, GeometryError::CollinearPoints sinon.
+         */
+        static GeometryError validate(const Point& p1, const Point& p2, const Point& p3) noexcept;
+
+        /**
+         * @brief Fabrique validante sans exception, pour les données fournies par l'utilisateur.
+         * @param p1 Premier sommet du triangle.
+         * @param p2 Deuxième sommet du triangle.
+         * @param p3 Troisième sommet du triangle.
+         * @param color La couleur du triangle.
+         * @param out Reçoit le triangle construit si les sommets sont valides (inchangé sinon).
+         * @return Le code d'erreur (GeometryError::None en cas de succès).
+         */
+        static GeometryError tryCreate(const Point& p1, const Point& p2, const Point& p3, const Couleur& color, BasicTriangle3D& out) noexcept;
+
+        /**
+         * @brief Fabrique validante sans exception, à partir de composantes RVB brutes.
+         * @param p1 Premier sommet du triangle.
+         * @param p2 Deuxième sommet du triangle.
+         * @param p3 Troisième sommet du triangle.
+         * @param rouge La composante rouge.
+         * @param vert La composante verte.
+         * @param bleu La composante bleue.
+         * @param out Reçoit le triangle construit si les sommets et la couleur sont valides (inchangé sinon).
+         * @return GeometryError::InvalidColor si une composante sort de [0, 255], sinon le code de tryCreate.
+         */
+        static GeometryError tryCreate(const Point& p1, const Point& p2, const Point& p3, int rouge, int vert, int bleu,
+                                       BasicTriangle3D& out) noexcept;
+
+        /**
+         * @brief Constructeur par copie de la classe BasicTriangle3D.
+         * @param other Le triangle à copier.
+         */
+        BasicTriangle3D(const BasicTriangle3D& other);
 
         /**
-         * @brief Constructeur par copie de la classe Triangle3D.
+         * @brief Opérateur d'affectation par copie.
          * @param other Le triangle à copier.
+         * @return Une référence à ce triangle.
          */
-        Triangle3D(const Triangle3D& other);
+        BasicTriangle3D& operator=(const BasicTriangle3D& other) = default;
 
         /**
-         * @brief Destructeur de la classe Triangle3D.
+         * @brief Destructeur de la classe BasicTriangle3D.
          */
-        ~Triangle3D(){}
+        ~BasicTriangle3D(){}
 
         /**
          * @brief Accesseur pour le premier sommet.
          * @return Le premier sommet du triangle.
          */
-        const Point3D& getP1() const;
+        const Point& getP1() const;
 
         /**
          * @brief Accesseur pour le deuxième sommet.
          * @return Le deuxième sommet du triangle.
          */
-        const Point3D& getP2() const;
+        const Point& getP2() const;
 
         /**
          * @brief Accesseur pour le troisième sommet.
          * @return Le troisième sommet du triangle.
          */
-        const Point3D& getP3() const;
+        const Point& getP3() const;
 
         /**
          * @brief Setteur pour le premier sommet.
          * @return Le premier sommet du triangle.
          */
-        void setP1(Point3D newP1) { p1 = newP1; }
+        void setP1(Point newP1) { p1 = newP1; updateDerived(); }
 
         /**
          * @brief Setteur pour le deuxième sommet.
          * @return Le deuxième sommet du triangle.
          */
-        void setP2(Point3D newP2) { p2 = newP2; }
+        void setP2(Point newP2) { p2 = newP2; updateDerived(); }
 
         /**
          * @brief Setteur pour le troisième sommet.
          * @return Le troisième sommet du triangle.
          */
-        void setP3(Point3D newP3) { p3 = newP3; }
+        void setP3(Point newP3) { p3 = newP3; updateDerived(); }
+
+        /**
+         * @brief Modifie les trois sommets à la fois (une seule mise à jour de la normale et du centroïde).
+         * @param newP1 Le nouveau premier sommet.
+         * @param newP2 Le nouveau deuxième sommet.
+         * @param newP3 Le nouveau troisième sommet.
+         */
+        void setVertices(const Point& newP1, const Point& newP2, const Point& newP3) {
+            p1 = newP1;
+            p2 = newP2;
+            p3 = newP3;
+            updateDerived();
+        }
+
+        /**
+         * @brief Modifie les trois sommets avec une normale et un centroïde déjà calculés (par lots).
+         * @param newP1 Le nouveau premier sommet.
+         * @param newP2 Le nouveau deuxième sommet.
+         * @param newP3 Le nouveau troisième sommet.
+         * @param newNormal La normale unitaire des nouveaux sommets.
+         * @param newCentroid Le centroïde des nouveaux sommets.
+         * @pre La normale et le centroïde correspondent aux sommets (non vérifié).
+         */
+        void setVertices(Unchecked, const Point& newP1, const Point& newP2, const Point& newP3,
+                         const Point& newNormal, const Point& newCentroid) {
+            p1 = newP1;
+            p2 = newP2;
+            p3 = newP3;
+            normal = newNormal;
+            centroid = newCentroid;
+        }
 
         /**
          * @brief Accesseur pour la couleur du triangle.
@@ -153,32 +251,32 @@ class Triangle3D {
          * @brief Méthode pour orienter les sommets dans le sens trigonométrique.
          * @return void
          */
-        void orient(const Point3D& pointOfView);
+        void orient(const Point& pointOfView);
         
         /**
          * @brief Calcule la profondeur moyenne du triangle basée sur ses sommets.
          * @return La profondeur moyenne.
          */
-        float averageDepth() const;
+        Scalar averageDepth() const;
 
         /**
          * @brief Calcul du périmètre du triangle.
          * @return Le périmètre du triangle.
          */
-        float perimeter() const;
+        Scalar perimeter() const;
 
         /**
          * @brief Calcule l'aire du triangle en utilisant la formule de Héron.
          * @return L'aire du triangle.
          */
-        float area() const;
+        Scalar area() const;
 
         /**
          * @brief vérifie si un point fait partie des sommets du triangle
          * @param p le point à vérifier
          * @return true si le point est un sommet du triangle, false sinon
          */
-        bool isVertex(const Point3D& p) const;
+        bool isVertex(const Point& p) const;
 
         /**
          * @brief Détermine si le triangle est dégénéré (aire nulle).
@@ -191,7 +289,7 @@ class Triangle3D {
          * @param other L'autre triangle à comparer.
          * @return true si les deux triangles ont un côté en commun, false sinon.
          */
-        bool hasCommonSide(const Triangle3D& other) const;
+        bool hasCommonSide(const BasicTriangle3D& other) const;
 
         /**
          * @brief Vérifie si deux triangles ont un côté en commun.
@@ -199,22 +297,30 @@ class Triangle3D {
          * @param t2 Le deuxième triangle.
          * @return true si les deux triangles ont un côté en commun, false sinon.
          */
-        static bool hasCommonSide(const Triangle3D& t1, const Triangle3D& t2);
+        static bool hasCommonSide(const BasicTriangle3D& t1, const BasicTriangle3D& t2);
 
             /**
          * @brief Compare deux triangles pour l'égalité.
          * @param other L'autre triangle avec lequel comparer.
          * @return true si les deux triangles sont égaux, false sinon.
          */
-        bool equals(const Triangle3D& other) const;
+        bool equals(const BasicTriangle3D& other) const;
+
+        /**
+         * @brief Calcule et retourne la normale du triangle (produit vectoriel, de norme le double de l'aire).
+         *
+         * Pour un triangle dégénéré, la normale est nulle. Le rendu et l'élimination des faces
+         * utilisent plutôt getUnitNormal(), déjà calculée.
+         *
+         * @return Point La normale du triangle.
+         */
+        Point getNormale() const;
 
         /**
-         * @brief Calcule et retourne la normale du triangle.
-         * 
-         * @return Point3D La normale du triangle.
-         * @throw std::runtime_error Si le triangle est dégénéré (aire nulle).
+         * @brief Retourne la normale unitaire du triangle, tenue à jour à chaque modification.
+         * @return La normale unitaire (nulle si le triangle est dégénéré).
          */
-        Point3D getNormale() const;
+        const Point& getUnitNormal() const { return normal; }
 
         /**
          * @brief Echange deux sommets du triangle.
@@ -225,33 +331,26 @@ class Triangle3D {
         void swapVertices(int i, int j);
 
         /**
-         * @brief Calcule et retourne le centroïde (centre de gravité) du triangle.
-         * @return Le centroïde du triangle en tant que Point3D.
+         * @brief Retourne le centroïde (centre de gravité) du triangle, tenu à jour à chaque modification.
+         * @return Le centroïde du triangle en tant que Point.
          */
-        Point3D getCentroid() const;
+        const Point& getCentroid() const { return centroid; }
 
         /**
          * @brief Vérifie si le triangle est valide.
          * @return true si le triangle est valide, false sinon.
          */
-        bool isValid() const { return !Point3D::areCollinear(p1, p2, p3); }
-
-        /**
-         * @brief Affiche les informations du triangle dans un flux de sortie.
-         * @param os Le flux dans lequel écrire.
-         * @param triangle Le triangle à afficher.
-         * @return Une référence au flux modifié.
-         */
-        friend std::ostream& operator<<(std::ostream& os, const Triangle3D& triangle);
+        bool isValid() const { return !Point::areCollinear(p1, p2, p3); }
 
         /**
          * @brief Effectue une translation du triangle dans l'espace 3D.
          * @param offset Le vecteur de translation à appliquer.
          */
-        void translate(const Point3D& offset) { 
+        void translate(const Point& offset) { 
             p1 = p1 + offset;
             p2 = p2 + offset;
             p3 = p3 + offset;
+            centroid = centroid + offset;
         }
 
         /**
@@ -260,18 +359,57 @@ class Triangle3D {
          * @param axis Axe autour duquel effectuer la rotation ('x', 'y', ou 'z').
          * @param center Point autour duquel effectuer la rotation (par défaut : origine).
          */
-        void rotate(float angle, char axis, const Point3D& center);
+        void rotate(float angle, char axis, const Point& center);
+
+        /**
+         * @brief Applique une transformation affine aux trois sommets du triangle.
+         * @param transform La transformation à appliquer.
+         */
+        void transform(const BasicTransform3D<Scalar>& transform);
+
+        /**
+         * @brief Exprime le triangle par rapport à la caméra, en float, pour le rendu.
+         * @param eye La position de la caméra.
+         * @return Le triangle relatif à la caméra, de même couleur (sans nouvelle validation).
+         */
+        BasicTriangle3D<float> cameraRelative(const Point& eye) const;
 
         /**
          * @brief Applique une translation sur l'axe Z aux sommets du triangle.
          * @param translationZ Le décalage à appliquer à la coordonnée Z des sommets du triangle.
          */
-        void applyTranslationZ(float translationZ) {
+        void applyTranslationZ(Scalar translationZ) {
             p1.setZ(p1.getZ() + translationZ);
             p2.setZ(p2.getZ() + translationZ);
             p3.setZ(p3.getZ() + translationZ);
+            centroid.setZ(centroid.getZ() + translationZ);
         }
-};  
+};
+
+/**
+ * @brief Affiche les informations du triangle dans un flux de sortie.
+ * @param os Le flux dans lequel écrire.
+ * @param triangle Le triangle à afficher.
+ * @return Une référence au flux modifié.
+ */
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& os, const BasicTriangle3D<Scalar>& triangle);
+
+/**
+ * @brief Triangle du chemin de rendu, en float.
+ */
+using Triangle3D = BasicTriangle3D<float>;
+
+/**
+ * @brief Triangle de grand monde, en double.
+ */
+using Triangle3Dd = BasicTriangle3D<double>;
+
+// Instanciés dans triangle3d.cpp
+extern template class BasicTriangle3D<float>;
+extern template class BasicTriangle3D<double>;
+extern template std::ostream& operator<<(std::ostream&, const Triangle3D&);
+extern template std::ostream& operator<<(std::ostream&, const Triangle3Dd&);
 
 #endif
 
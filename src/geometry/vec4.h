@@ -0,0 +1,208 @@
+/**
+ * @file vec4.h
+ * @brief Déclaration de la classe Vec4, vecteur de quatre flottants alignés sur 16 octets.
+ *
+ * Vec4 est le socle de calcul de Point3D : les opérations utilisent SSE lorsque le compilateur
+ * le permet (toujours le cas en x86-64) et une boucle scalaire sinon.
+ */
+#ifndef VEC4_H
+#define VEC4_H
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64)
+#define VEC4_SSE 1
+#include <xmmintrin.h>
+#endif
+
+/**
+ * @class Vec4
+ * @brief Vecteur (x, y, z, w) aligné sur 16 octets.
+ *
+ * Pour un vecteur 3D, w vaut 0 : toutes les opérations conservent cette valeur, ce qui permet
+ * de calculer les produits scalaires sur les quatre composantes sans masque.
+ */
+class alignas(16) Vec4 {
+    private:
+        float v[4];
+
+#if defined(VEC4_SSE)
+        explicit Vec4(__m128 m) { _mm_store_ps(v, m); }
+        __m128 load() const { return _mm_load_ps(v); }
+
+        // Somme horizontale des quatre composantes, résultat dans la première
+        static __m128 horizontalSum(__m128 m) {
+            __m128 shuffled = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)); // (y, x, w, z)
+            __m128 sums = _mm_add_ps(m, shuffled);                             // (x+y, x+y, z+w, z+w)
+            shuffled = _mm_movehl_ps(shuffled, sums);                          // (z+w, z+w, ...)
+            return _mm_add_ss(sums, shuffled);
+        }
+#endif
+
+    public:
+        /**
+         * @brief Constructeur (par défaut : vecteur nul).
+         */
+        Vec4(float x = 0, float y = 0, float z = 0, float w = 0) : v{x, y, z, w} {}
+
+        float x() const { return v[0]; }
+        float y() const { return v[1]; }
+        float z() const { return v[2]; }
+        float w() const { return v[3]; }
+
+        void setX(float value) { v[0] = value; }
+        void setY(float value) { v[1] = value; }
+        void setZ(float value) { v[2] = value; }
+
+        /**
+         * @brief Accès direct aux quatre composantes alignées.
+         * @return Un pointeur vers les composantes (x, y, z, w).
+         */
+        const float* data() const { return v; }
+
+        friend Vec4 operator+(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            return Vec4(_mm_add_ps(a.load(), b.load()));
+#else
+            return Vec4(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]);
+#endif
+        }
+
+        friend Vec4 operator-(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            return Vec4(_mm_sub_ps(a.load(), b.load()));
+#else
+            return Vec4(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]);
+#endif
+        }
+
+        friend Vec4 operator*(const Vec4& a, float scalar) {
+#if defined(VEC4_SSE)
+            return Vec4(_mm_mul_ps(a.load(), _mm_set1_ps(scalar)));
+#else
+            return Vec4(a.v[0] * scalar, a.v[1] * scalar, a.v[2] * scalar, a.v[3] * scalar);
+#endif
+        }
+
+        /**
+         * @brief Produit scalaire sur les quatre composantes (produit 3D lorsque w vaut 0).
+         * @param a Le premier vecteur.
+         * @param b Le deuxième vecteur.
+         * @return Le produit scalaire.
+         */
+        static float dot(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            return _mm_cvtss_f32(horizontalSum(_mm_mul_ps(a.load(), b.load())));
+#else
+            return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+#endif
+        }
+
+        /**
+         * @brief Produit vectoriel des parties 3D (w du résultat vaut 0).
+         * @param a Le premier vecteur.
+         * @param b Le deuxième vecteur.
+         * @return Le produit vectoriel a x b.
+         */
+        static Vec4 cross(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            // a x b = a.yzx * b.zxy - a.zxy * b.yzx, évalué avec deux mélanges par opérande
+            __m128 ma = a.load();
+            __m128 mb = b.load();
+            __m128 aYzx = _mm_shuffle_ps(ma, ma, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 bYzx = _mm_shuffle_ps(mb, mb, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 c = _mm_sub_ps(_mm_mul_ps(ma, bYzx), _mm_mul_ps(aYzx, mb)); // (a x b).zxy
+            return Vec4(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+            return Vec4(a.v[1] * b.v[2] - a.v[2] * b.v[1],
+                        a.v[2] * b.v[0] - a.v[0] * b.v[2],
+                        a.v[0] * b.v[1] - a.v[1] * b.v[0]);
+#endif
+        }
+
+        /**
+         * @brief Produit mixte (a x b) . c, sans passer par un vecteur intermédiaire stocké.
+         * @param a Le premier vecteur.
+         * @param b Le deuxième vecteur.
+         * @param c Le troisième vecteur.
+         * @return Le produit mixte.
+         */
+        static float crossDot(const Vec4& a, const Vec4& b, const Vec4& c) {
+#if defined(VEC4_SSE)
+            // (a * b.yzx - a.yzx * b) vaut (a x b).zxy : on le multiplie par c.zxy
+            __m128 ma = a.load();
+            __m128 mb = b.load();
+            __m128 mc = c.load();
+            __m128 aYzx = _mm_shuffle_ps(ma, ma, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 bYzx = _mm_shuffle_ps(mb, mb, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 cZxy = _mm_shuffle_ps(mc, mc, _MM_SHUFFLE(3, 1, 0, 2));
+            __m128 zxy = _mm_sub_ps(_mm_mul_ps(ma, bYzx), _mm_mul_ps(aYzx, mb));
+            return _mm_cvtss_f32(horizontalSum(_mm_mul_ps(zxy, cZxy)));
+#else
+            return dot(cross(a, b), c);
+#endif
+        }
+
+        /**
+         * @brief Norme euclidienne.
+         * @return La norme du vecteur.
+         */
+        float length() const {
+            return std::sqrt(dot(*this, *this));
+        }
+
+        /**
+         * @brief Vecteur unitaire de même direction.
+         * @return Le vecteur normalisé, ou le vecteur nul si la norme est nulle.
+         */
+        Vec4 normalized() const {
+            float squared = dot(*this, *this);
+            if (squared <= 0.0f) {
+                return Vec4();
+            }
+            return *this * (1.0f / std::sqrt(squared));
+        }
+
+        /**
+         * @brief Minimum composante par composante.
+         */
+        static Vec4 min(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            return Vec4(_mm_min_ps(a.load(), b.load()));
+#else
+            return Vec4(std::fmin(a.v[0], b.v[0]), std::fmin(a.v[1], b.v[1]), std::fmin(a.v[2], b.v[2]), std::fmin(a.v[3], b.v[3]));
+#endif
+        }
+
+        /**
+         * @brief Maximum composante par composante.
+         */
+        static Vec4 max(const Vec4& a, const Vec4& b) {
+#if defined(VEC4_SSE)
+            return Vec4(_mm_max_ps(a.load(), b.load()));
+#else
+            return Vec4(std::fmax(a.v[0], b.v[0]), std::fmax(a.v[1], b.v[1]), std::fmax(a.v[2], b.v[2]), std::fmax(a.v[3], b.v[3]));
+#endif
+        }
+
+        /**
+         * @brief Vérifie que chaque composante diffère de moins de tolerance.
+         * @param a Le premier vecteur.
+         * @param b Le deuxième vecteur.
+         * @param tolerance L'écart maximal (exclu).
+         * @return true si les quatre composantes sont proches.
+         */
+        static bool nearlyEqual(const Vec4& a, const Vec4& b, float tolerance) {
+#if defined(VEC4_SSE)
+            __m128 diff = _mm_sub_ps(a.load(), b.load());
+            __m128 absDiff = _mm_andnot_ps(_mm_set1_ps(-0.0f), diff);
+            return _mm_movemask_ps(_mm_cmplt_ps(absDiff, _mm_set1_ps(tolerance))) == 0xF;
+#else
+            return std::fabs(a.v[0] - b.v[0]) < tolerance && std::fabs(a.v[1] - b.v[1]) < tolerance &&
+                   std::fabs(a.v[2] - b.v[2]) < tolerance && std::fabs(a.v[3] - b.v[3]) < tolerance;
+#endif
+        }
+};
+
+#endif // VEC4_H
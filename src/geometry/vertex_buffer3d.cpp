@@ -0,0 +1,182 @@
+#include "vertex_buffer3d.h"
+#include "transform3d.h"
+#include "thread_pool.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+VertexBuffer3D::VertexBuffer3D(std::size_t count) : xs_(count, 0.0f), ys_(count, 0.0f), zs_(count, 0.0f) {}
+
+void VertexBuffer3D::reserve(std::size_t count) {
+    xs_.reserve(count);
+    ys_.reserve(count);
+    zs_.reserve(count);
+}
+
+void VertexBuffer3D::resize(std::size_t count) {
+    xs_.resize(count, 0.0f);
+    ys_.resize(count, 0.0f);
+    zs_.resize(count, 0.0f);
+}
+
+void VertexBuffer3D::clear() {
+    xs_.clear();
+    ys_.clear();
+    zs_.clear();
+}
+
+void VertexBuffer3D::push_back(const Point3D& point) {
+    xs_.push_back(point.getX());
+    ys_.push_back(point.getY());
+    zs_.push_back(point.getZ());
+}
+
+// Translation : une addition par coordonnée
+void VertexBuffer3D::translate(const Point3D& offset) {
+    float* px = xs_.data();
+    float* py = ys_.data();
+    float* pz = zs_.data();
+    const float ox = offset.getX(), oy = offset.getY(), oz = offset.getZ();
+    parallelChunks(size(), [=](std::size_t begin, std::size_t end) {
+        std::size_t i = begin;
+
+#if defined(__AVX__)
+        const __m256 vox = _mm256_set1_ps(ox);
+        const __m256 voy = _mm256_set1_ps(oy);
+        const __m256 voz = _mm256_set1_ps(oz);
+        for (; i + LANES <= end; i += LANES) {
+            _mm256_store_ps(px + i, _mm256_add_ps(_mm256_load_ps(px + i), vox));
+            _mm256_store_ps(py + i, _mm256_add_ps(_mm256_load_ps(py + i), voy));
+            _mm256_store_ps(pz + i, _mm256_add_ps(_mm256_load_ps(pz + i), voz));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            px[i] += ox;
+            py[i] += oy;
+            pz[i] += oz;
+        }
+    });
+}
+
+// Mise à l'échelle : p' = c + (p - c) * k, soit p * k + c * (1 - k)
+void VertexBuffer3D::scale(float factor, const Point3D& center) {
+    const float m[12] = {
+        factor, 0.0f, 0.0f, center.getX() * (1.0f - factor),
+        0.0f, factor, 0.0f, center.getY() * (1.0f - factor),
+        0.0f, 0.0f, factor, center.getZ() * (1.0f - factor)
+    };
+
+    float* px = xs_.data();
+    float* py = ys_.data();
+    float* pz = zs_.data();
+    parallelChunks(size(), [=](std::size_t begin, std::size_t end) {
+        std::size_t i = begin;
+
+#if defined(__AVX__)
+        const __m256 vk = _mm256_set1_ps(factor);
+        const __m256 vtx = _mm256_set1_ps(m[3]);
+        const __m256 vty = _mm256_set1_ps(m[7]);
+        const __m256 vtz = _mm256_set1_ps(m[11]);
+        for (; i + LANES <= end; i += LANES) {
+            _mm256_store_ps(px + i, _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(px + i), vk), vtx));
+            _mm256_store_ps(py + i, _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(py + i), vk), vty));
+            _mm256_store_ps(pz + i, _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(pz + i), vk), vtz));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            px[i] = px[i] * factor + m[3];
+            py[i] = py[i] * factor + m[7];
+            pz[i] = pz[i] * factor + m[11];
+        }
+    });
+}
+
+// Rotation : sinus et cosinus calculés une seule fois, puis application de la matrice 3x4
+void VertexBuffer3D::rotate(float angle, char axis, const Point3D& center) {
+    Transform3D::rotation(angle, axis, center).apply(*this);
+}
+
+void VertexBuffer3D::transform(const float m[12]) {
+    float* px = xs_.data();
+    float* py = ys_.data();
+    float* pz = zs_.data();
+    parallelChunks(size(), [=](std::size_t begin, std::size_t end) {
+        std::size_t i = begin;
+
+#if defined(__AVX__)
+        const __m256 m0 = _mm256_set1_ps(m[0]), m1 = _mm256_set1_ps(m[1]), m2 = _mm256_set1_ps(m[2]), m3 = _mm256_set1_ps(m[3]);
+        const __m256 m4 = _mm256_set1_ps(m[4]), m5 = _mm256_set1_ps(m[5]), m6 = _mm256_set1_ps(m[6]), m7 = _mm256_set1_ps(m[7]);
+        const __m256 m8 = _mm256_set1_ps(m[8]), m9 = _mm256_set1_ps(m[9]), m10 = _mm256_set1_ps(m[10]), m11 = _mm256_set1_ps(m[11]);
+        for (; i + LANES <= end; i += LANES) {
+            const __m256 x = _mm256_load_ps(px + i);
+            const __m256 y = _mm256_load_ps(py + i);
+            const __m256 z = _mm256_load_ps(pz + i);
+
+            __m256 nx = _mm256_add_ps(_mm256_mul_ps(m0, x), m3);
+            nx = _mm256_add_ps(nx, _mm256_mul_ps(m1, y));
+            nx = _mm256_add_ps(nx, _mm256_mul_ps(m2, z));
+
+            __m256 ny = _mm256_add_ps(_mm256_mul_ps(m4, x), m7);
+            ny = _mm256_add_ps(ny, _mm256_mul_ps(m5, y));
+            ny = _mm256_add_ps(ny, _mm256_mul_ps(m6, z));
+
+            __m256 nz = _mm256_add_ps(_mm256_mul_ps(m8, x), m11);
+            nz = _mm256_add_ps(nz, _mm256_mul_ps(m9, y));
+            nz = _mm256_add_ps(nz, _mm256_mul_ps(m10, z));
+
+            _mm256_store_ps(px + i, nx);
+            _mm256_store_ps(py + i, ny);
+            _mm256_store_ps(pz + i, nz);
+        }
+#endif
+
+        for (; i < end; ++i) {
+            const float x = px[i], y = py[i], z = pz[i];
+            px[i] = m[0] * x + m[1] * y + m[2] * z + m[3];
+            py[i] = m[4] * x + m[5] * y + m[6] * z + m[7];
+            pz[i] = m[8] * x + m[9] * y + m[10] * z + m[11];
+        }
+    });
+}
+
+// Une passe sur les tableaux SoA : produit vectoriel, normalisation et moyenne des trois sommets
+void VertexBuffer3D::computeTriangleData(VertexBuffer3D& normals, VertexBuffer3D& centroids) const {
+    const std::size_t count = size() / 3;
+    normals.resize(count);
+    centroids.resize(count);
+
+    const float* px = xs_.data();
+    const float* py = ys_.data();
+    const float* pz = zs_.data();
+    float* nx = normals.x();
+    float* ny = normals.y();
+    float* nz = normals.z();
+    float* cx = centroids.x();
+    float* cy = centroids.y();
+    float* cz = centroids.z();
+    const float third = 1.0f / 3.0f;
+
+    parallelChunks(count, [=](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t a = 3 * t, b = a + 1, c = a + 2;
+            const float ux = px[b] - px[a], uy = py[b] - py[a], uz = pz[b] - pz[a];
+            const float vx = px[c] - px[a], vy = py[c] - py[a], vz = pz[c] - pz[a];
+
+            const float x = uy * vz - uz * vy;
+            const float y = uz * vx - ux * vz;
+            const float z = ux * vy - uy * vx;
+            const float length = std::sqrt(x * x + y * y + z * z);
+            const float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+
+            nx[t] = x * inverse;
+            ny[t] = y * inverse;
+            nz[t] = z * inverse;
+            cx[t] = (px[a] + px[b] + px[c]) * third;
+            cy[t] = (py[a] + py[b] + py[c]) * third;
+            cz[t] = (pz[a] + pz[b] + pz[c]) * third;
+        }
+    });
+}
@@ -0,0 +1,196 @@
+/**
+ * @file vertex_buffer3d.h
+ * @brief Déclaration de la classe VertexBuffer3D, un conteneur de sommets en structure de tableaux (SoA).
+ *
+ * Les coordonnées x, y et z sont stockées dans trois tableaux séparés alignés sur 32 octets,
+ * ce qui permet de transformer 8 sommets par instruction AVX.
+ */
+#ifndef VERTEX_BUFFER3D_H
+#define VERTEX_BUFFER3D_H
+
+#include "point3d.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @class AlignedAllocator
+ * @brief Allocateur garantissant l'alignement des blocs alloués.
+ * @tparam T Type des éléments alloués.
+ * @tparam Alignment Alignement en octets (puissance de deux).
+ */
+template <typename T, std::size_t Alignment>
+class AlignedAllocator {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        AlignedAllocator() noexcept {}
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+        template <typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+/**
+ * @class VertexBuffer3D
+ * @brief Conteneur de sommets 3D en structure de tableaux (SoA).
+ *
+ * Les noyaux de transformation (translation, rotation, mise à l'échelle et matrice 3x4)
+ * traitent les sommets par blocs de 8 avec AVX lorsque le code est compilé avec `-mavx`,
+ * et retombent sur une boucle scalaire sinon. Au-delà de PARALLEL_THRESHOLD sommets, ils sont
+ * répartis par blocs sur la réserve de threads partagée (résultat indépendant du nombre de threads).
+ */
+class VertexBuffer3D {
+    public:
+        static constexpr std::size_t ALIGNMENT = 32; ///< Alignement des tableaux en octets.
+        static constexpr std::size_t LANES = 8;      ///< Nombre de sommets traités par instruction AVX.
+
+        using FloatArray = std::vector<float, AlignedAllocator<float, ALIGNMENT>>;
+
+    private:
+        FloatArray xs_; // Coordonnées x des sommets.
+        FloatArray ys_; // Coordonnées y des sommets.
+        FloatArray zs_; // Coordonnées z des sommets.
+
+    public:
+        /**
+         * @brief Constructeur par défaut (conteneur vide).
+         */
+        VertexBuffer3D() = default;
+
+        /**
+         * @brief Constructeur initialisant le conteneur avec un nombre donné de sommets à l'origine.
+         * @param count Le nombre de sommets.
+         */
+        explicit VertexBuffer3D(std::size_t count);
+
+        /**
+         * @brief Retourne le nombre de sommets.
+         * @return Le nombre de sommets du conteneur.
+         */
+        std::size_t size() const { return xs_.size(); }
+
+        /**
+         * @brief Indique si le conteneur est vide.
+         * @return true si le conteneur ne contient aucun sommet, false sinon.
+         */
+        bool empty() const { return xs_.empty(); }
+
+        /**
+         * @brief Réserve la place pour un nombre donné de sommets.
+         * @param count Le nombre de sommets à réserver.
+         */
+        void reserve(std::size_t count);
+
+        /**
+         * @brief Redimensionne le conteneur.
+         * @param count Le nouveau nombre de sommets.
+         */
+        void resize(std::size_t count);
+
+        /**
+         * @brief Vide le conteneur.
+         */
+        void clear();
+
+        /**
+         * @brief Ajoute un sommet à la fin du conteneur.
+         * @param point Le sommet à ajouter.
+         */
+        void push_back(const Point3D& point);
+
+        /**
+         * @brief Accesseur pour un sommet.
+         * @param index L'indice du sommet.
+         * @return Le sommet à l'indice donné.
+         */
+        Point3D get(std::size_t index) const { return Point3D(xs_[index], ys_[index], zs_[index]); }
+
+        /**
+         * @brief Modifie un sommet.
+         * @param index L'indice du sommet.
+         * @param point La nouvelle valeur du sommet.
+         */
+        void set(std::size_t index, const Point3D& point) {
+            xs_[index] = point.getX();
+            ys_[index] = point.getY();
+            zs_[index] = point.getZ();
+        }
+
+        /**
+         * @brief Accès direct aux tableaux de coordonnées (alignés sur 32 octets).
+         * @return Un pointeur vers le premier élément du tableau.
+         */
+        float* x() { return xs_.data(); }
+        float* y() { return ys_.data(); }
+        float* z() { return zs_.data(); }
+        const float* x() const { return xs_.data(); }
+        const float* y() const { return ys_.data(); }
+        const float* z() const { return zs_.data(); }
+
+        /**
+         * @brief Translate tous les sommets.
+         * @param offset Le vecteur de translation.
+         */
+        void translate(const Point3D& offset);
+
+        /**
+         * @brief Met à l'échelle tous les sommets par rapport à un centre.
+         * @param factor Le facteur d'échelle.
+         * @param center Le centre de la mise à l'échelle.
+         */
+        void scale(float factor, const Point3D& center = Point3D());
+
+        /**
+         * @brief Effectue une rotation de tous les sommets autour d'un axe et d'un centre donnés.
+         *
+         * Le sinus et le cosinus sont calculés une seule fois (voir Transform3D::rotation),
+         * puis la rotation est appliquée sous forme de matrice 3x4.
+         *
+         * @param angle L'angle de rotation en radians.
+         * @param axis L'axe de rotation ('x', 'y' ou 'z').
+         * @param center Le centre de rotation.
+         * @throw std::invalid_argument Si l'axe est invalide.
+         */
+        void rotate(float angle, char axis, const Point3D& center);
+
+        /**
+         * @brief Applique une matrice affine 3x4 à tous les sommets.
+         *
+         * La matrice est stockée ligne par ligne : `x' = m[0]*x + m[1]*y + m[2]*z + m[3]`,
+         * `y' = m[4]*x + ... + m[7]`, `z' = m[8]*x + ... + m[11]`.
+         *
+         * @param matrix Les 12 coefficients de la matrice.
+         */
+        void transform(const float matrix[12]);
+
+        /**
+         * @brief Calcule par lots la normale unitaire et le centroïde de chaque triangle.
+         *
+         * Les sommets sont lus trois par trois, chaque triplet consécutif formant un triangle
+         * (disposition produite par Quad3D::appendVertices). Les derniers sommets qui ne forment
+         * pas un triangle complet sont ignorés.
+         *
+         * @param normals Reçoit une normale unitaire par triangle (nulle si le triangle est dégénéré).
+         * @param centroids Reçoit un centroïde par triangle.
+         */
+        void computeTriangleData(VertexBuffer3D& normals, VertexBuffer3D& centroids) const;
+};
+
+#endif // VERTEX_BUFFER3D_H
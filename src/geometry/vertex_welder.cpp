@@ -0,0 +1,134 @@
+#include "vertex_welder.h"
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Indices fusionnés des triangles d'une soupe ; les triangles dégénérés sont écartés
+    template <typename TriangleAt>
+    Mesh3D weldSoup(size_t triangleCount, TriangleAt triangleAt, WeldReport& report, float tolerance) {
+        VertexWelder welder(tolerance);
+        std::vector<std::array<uint32_t, 3>> faces;
+        std::vector<Couleur> colors;
+        faces.reserve(triangleCount);
+        colors.reserve(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            const Triangle3D& triangle = triangleAt(t);
+            std::array<uint32_t, 3> face = {welder.insert(triangle.getP1()), welder.insert(triangle.getP2()), welder.insert(triangle.getP3())};
+            if (face[0] == face[1] || face[1] == face[2] || face[0] == face[2]) {
+                ++report.degenerateTriangles;
+                continue;
+            }
+            faces.push_back(face);
+            colors.push_back(triangle.getColor());
+        }
+
+        Mesh3D mesh;
+        mesh.reserve(welder.getPositions().size(), faces.size());
+        for (const Point3D& position : welder.getPositions()) {
+            mesh.addVertex(position);
+        }
+        for (size_t f = 0; f < faces.size(); ++f) {
+            mesh.addTriangle(faces[f][0], faces[f][1], faces[f][2], colors[f]);
+        }
+        report.inputVertices = 3 * triangleCount;
+        report.outputVertices = mesh.getVertexCount();
+        report.bytesBefore = 3 * triangleCount * sizeof(Point3D);
+        report.bytesAfter = mesh.getVertexCount() * sizeof(Point3D) + mesh.getIndices().size() * sizeof(uint32_t);
+        return mesh;
+    }
+}
+
+VertexWelder::VertexWelder(float tolerance) : tolerance(tolerance) {
+    if (!(tolerance > 0.0f)) {
+        throw std::invalid_argument("La tolérance de fusion doit être strictement positive.");
+    }
+}
+
+void VertexWelder::reserve(size_t count) {
+    positions.reserve(count);
+    cells.reserve(count);
+}
+
+int64_t VertexWelder::cellCoordinate(float value) const {
+    return static_cast<int64_t>(std::floor(value / tolerance));
+}
+
+uint64_t VertexWelder::cellKey(int64_t x, int64_t y, int64_t z) {
+    return static_cast<uint64_t>(x) * 73856093u ^ static_cast<uint64_t>(y) * 19349663u ^ static_cast<uint64_t>(z) * 83492791u;
+}
+
+uint32_t VertexWelder::insert(const Point3D& position) {
+    const int64_t x = cellCoordinate(position.getX());
+    const int64_t y = cellCoordinate(position.getY());
+    const int64_t z = cellCoordinate(position.getZ());
+    const float squaredTolerance = tolerance * tolerance;
+
+    // Un sommet à moins de la tolérance est dans l'une des 27 cellules voisines
+    uint32_t best = UINT32_MAX;
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                auto range = cells.equal_range(cellKey(x + dx, y + dy, z + dz));
+                for (auto it = range.first; it != range.second; ++it) {
+                    Point3D offset = positions[it->second] - position;
+                    if (it->second < best && offset.dotProduct(offset) <= squaredTolerance) {
+                        best = it->second;
+                    }
+                }
+            }
+        }
+    }
+    if (best != UINT32_MAX) {
+        return best;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(positions.size());
+    positions.push_back(position);
+    cells.emplace(cellKey(x, y, z), index);
+    return index;
+}
+
+Mesh3D VertexWelder::weld(const Mesh3D& mesh, WeldReport& report, float tolerance) {
+    report = WeldReport();
+    VertexWelder welder(tolerance);
+    welder.reserve(mesh.getVertexCount());
+    std::vector<uint32_t> remap(mesh.getVertexCount());
+    for (size_t i = 0; i < mesh.getVertexCount(); ++i) {
+        remap[i] = welder.insert(mesh.getPositions()[i]);
+    }
+
+    Mesh3D welded;
+    welded.reserve(welder.getPositions().size(), mesh.getTriangleCount());
+    for (const Point3D& position : welder.getPositions()) {
+        welded.addVertex(position);
+    }
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    for (size_t t = 0; t < mesh.getTriangleCount(); ++t) {
+        uint32_t a = remap[indices[3 * t]], b = remap[indices[3 * t + 1]], c = remap[indices[3 * t + 2]];
+        if (a == b || b == c || a == c) {
+            ++report.degenerateTriangles;
+            continue;
+        }
+        welded.addTriangle(a, b, c, mesh.getFaceColor(t));
+    }
+
+    report.inputVertices = mesh.getVertexCount();
+    report.outputVertices = welded.getVertexCount();
+    report.bytesBefore = mesh.getVertexCount() * sizeof(Point3D) + indices.size() * sizeof(uint32_t);
+    report.bytesAfter = welded.getVertexCount() * sizeof(Point3D) + welded.getIndices().size() * sizeof(uint32_t);
+    return welded;
+}
+
+Mesh3D VertexWelder::weld(const std::vector<Triangle3D>& triangles, WeldReport& report, float tolerance) {
+    report = WeldReport();
+    return weldSoup(triangles.size(), [&triangles](size_t t) -> const Triangle3D& { return triangles[t]; }, report, tolerance);
+}
+
+Mesh3D VertexWelder::weld(const std::vector<Quad3D>& quads, WeldReport& report, float tolerance) {
+    report = WeldReport();
+    return weldSoup(2 * quads.size(), [&quads](size_t t) -> const Triangle3D& {
+        const Quad3D& quad = quads[t / 2];
+        return t % 2 == 0 ? quad.getFirstTriangle() : quad.getSecondTriangle();
+    }, report, tolerance);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file vertex_welder.h
+ * @brief Déclaration de la classe VertexWelder : fusion des sommets proches par hachage spatial.
+ *
+ * Les soupes de triangles (listes de Triangle3D ou de Quad3D, maillages importés) répètent
+ * chaque sommet autant de fois qu'il a de faces. La fusion les transforme en maillages indexés
+ * à sommets partagés en O(n), au lieu des comparaisons deux à deux de Point3D::equals.
+ */
+#ifndef VERTEX_WELDER_H
+#define VERTEX_WELDER_H
+
+#include "mesh3d.h"
+#include "point3d.h"
+#include "quad3d.h"
+#include "triangle3d.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Tolérance de fusion par défaut : deux sommets plus proches sont confondus.
+ */
+constexpr float DEFAULT_WELD_TOLERANCE = 1e-5f;
+
+/**
+ * @struct WeldReport
+ * @brief Bilan d'une fusion : sommets et mémoire (positions et indices) avant et après.
+ */
+struct WeldReport {
+    size_t inputVertices = 0;        ///< Sommets en entrée.
+    size_t outputVertices = 0;       ///< Sommets distincts après fusion.
+    size_t degenerateTriangles = 0;  ///< Triangles supprimés car deux de leurs sommets ont été fusionnés.
+    size_t bytesBefore = 0;          ///< Mémoire des positions et indices en entrée.
+    size_t bytesAfter = 0;           ///< Mémoire des positions et indices du maillage indexé.
+
+    size_t verticesSaved() const { return inputVertices - outputVertices; }
+    size_t bytesSaved() const { return bytesBefore > bytesAfter ? bytesBefore - bytesAfter : 0; }
+};
+
+/**
+ * @class VertexWelder
+ * @brief Ensemble de sommets distincts à une tolérance près, indexé par une grille de hachage.
+ *
+ * L'espace est découpé en cellules cubiques de côté égal à la tolérance : un sommet proche
+ * ne peut se trouver que dans l'une des 27 cellules voisines. Un sommet inséré à moins de la
+ * tolérance d'un sommet existant reçoit l'indice du plus ancien d'entre eux.
+ */
+class VertexWelder {
+    private:
+        float tolerance;
+        std::vector<Point3D> positions;
+        std::unordered_multimap<uint64_t, uint32_t> cells; // Clé de cellule -> indices des sommets qu'elle contient.
+
+        /**
+         * @brief Coordonnée entière de cellule selon un axe.
+         */
+        int64_t cellCoordinate(float value) const;
+
+        /**
+         * @brief Clé de hachage d'une cellule (les collisions sont tolérées : les distances sont vérifiées).
+         */
+        static uint64_t cellKey(int64_t x, int64_t y, int64_t z);
+
+    public:
+        /**
+         * @brief Constructeur.
+         * @param tolerance La distance en dessous de laquelle deux sommets sont confondus.
+         * @throw std::invalid_argument Si la tolérance n'est pas strictement positive.
+         */
+        explicit VertexWelder(float tolerance = DEFAULT_WELD_TOLERANCE);
+
+        /**
+         * @brief Réserve la place pour un nombre de sommets distincts.
+         * @param count Le nombre de sommets prévu.
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Ajoute un sommet, ou retrouve un sommet existant à moins de la tolérance.
+         * @param position La position du sommet.
+         * @return L'indice du sommet distinct.
+         */
+        uint32_t insert(const Point3D& position);
+
+        /**
+         * @brief Retourne les sommets distincts, dans l'ordre de leur première insertion.
+         */
+        const std::vector<Point3D>& getPositions() const { return positions; }
+
+        /**
+         * @brief Retourne la tolérance de fusion.
+         */
+        float getTolerance() const { return tolerance; }
+
+        /**
+         * @brief Fusionne les sommets d'un maillage indexé.
+         * @param mesh Le maillage.
+         * @param report Le bilan de la fusion.
+         * @param tolerance La tolérance de fusion.
+         * @return Le maillage à sommets partagés, sans triangle dégénéré.
+         * @throw std::invalid_argument Si la tolérance n'est pas strictement positive.
+         */
+        static Mesh3D weld(const Mesh3D& mesh, WeldReport& report, float tolerance = DEFAULT_WELD_TOLERANCE);
+
+        /**
+         * @brief Construit un maillage indexé à partir d'une soupe de triangles.
+         * @param triangles Les triangles ; chacun garde sa couleur.
+         * @param report Le bilan de la fusion.
+         * @param tolerance La tolérance de fusion.
+         * @return Le maillage à sommets partagés, sans triangle dégénéré.
+         * @throw std::invalid_argument Si la tolérance n'est pas strictement positive.
+         */
+        static Mesh3D weld(const std::vector<Triangle3D>& triangles, WeldReport& report, float tolerance = DEFAULT_WELD_TOLERANCE);
+
+        /**
+         * @brief Construit un maillage indexé à partir d'une liste de quadrilatères.
+         * @param quads Les quadrilatères (deux triangles chacun, qui gardent leur couleur).
+         * @param report Le bilan de la fusion.
+         * @param tolerance La tolérance de fusion.
+         * @return Le maillage à sommets partagés, sans triangle dégénéré.
+         * @throw std::invalid_argument Si la tolérance n'est pas strictement positive.
+         */
+        static Mesh3D weld(const std::vector<Quad3D>& quads, WeldReport& report, float tolerance = DEFAULT_WELD_TOLERANCE);
+};
+
+#endif // VERTEX_WELDER_H
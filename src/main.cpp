@@ -5,7 +5,6 @@
 #include "geometry/point3d.h"
 #include <SDL2/SDL.h>
 #include <iostream>
-#include <memory> // Pour std::make_shared
 #include <cmath>  // Pour M_PI
 
 // Dimensions de l'écran
@@ -31,36 +30,49 @@ int main() {
         );
 
         // Ajout d'un pavé à la scène
-        auto cube = std::make_shared<Pave3D>(
+        CubeHandle cubeHandle = scene.addCube(Pave3D(
             Point3D(-25, -25, 50), // Origine du pavé
             200, 200, 200,         // Dimensions : longueur, largeur, hauteur
             Couleur(255, 0, 0)     // Couleur rouge
-        );
-        scene.addCube(cube);
+        ));
 
         // Ajout d'une sphère à la scène
-        auto sphere = std::make_shared<Sphere3D>(
+        SphereHandle sphereHandle = scene.addSphere(Sphere3D(
             Point3D(-150, -50, 50),  // Centre
             100,                    // Rayon
             40                     // Subdivisions
-        );
-        scene.addSphere(sphere);
+        ));
 
-        // Variables de translation spécifiques
-        Point2D cubeTranslation(0, 0);
-        Point2D sphereTranslation(0, 0);
-        float cubeTranslationZ = 0;
-        float sphereTranslationZ = 0;
+        // Chaque objet est déplacé par son nœud du graphe de scène
+        NodeHandle cubeNode = scene.attachCube(cubeHandle);
+        NodeHandle sphereNode = scene.attachSphere(sphereHandle);
         Point2D cameraTranslation(0, 0);
 
         // Variable pour gérer la sélection d'objet
         int selectedObject = 0; // 0 = cube, 1 = sphère
 
+        // Translation de l'objet sélectionné, dans le repère de son parent
+        auto translateSelected = [&](const Point3D& offset) {
+            scene.getGraph().translate(selectedObject == 0 ? cubeNode : sphereNode, offset);
+        };
+
+        // Rotation de l'objet sélectionné autour de son centre (les nœuds sont des racines : repère du monde)
+        auto rotateSelected = [&](float angle, char axis) {
+            scene.updateTransforms();
+            NodeHandle node = selectedObject == 0 ? cubeNode : sphereNode;
+            Point3D center = selectedObject == 0 ? scene.getCube(cubeHandle).center() : scene.getSphere(sphereHandle).getCenter();
+            ModelTransform local = scene.getGraph().getLocal(node);
+            local.rotate(angle, axis, center);
+            scene.getGraph().setLocal(node, local);
+        };
+
+        // Tampon d'occlusion : le cube masque la sphère lorsqu'il la cache entièrement
+        OcclusionBuffer3D occlusion;
+
         bool running = true;
         SDL_Event event;
 
         while (running) {
-
             while (SDL_PollEvent(&event)) {
                 if (event.type == SDL_QUIT) {
                     running = false;
@@ -74,106 +86,46 @@ int main() {
 
                         // Translation en X, Y et Z
                         case SDLK_UP:
-                            if (selectedObject == 0) {
-                                cubeTranslation = cubeTranslation + Point2D(0, -MOVE_STEP);
-                            } else {
-                                sphereTranslation = sphereTranslation + Point2D(0, -MOVE_STEP);
-                            }
+                            translateSelected(Point3D(0, -MOVE_STEP, 0));
                             break;
                         case SDLK_DOWN:
-                            if (selectedObject == 0) {
-                                cubeTranslation = cubeTranslation + Point2D(0, MOVE_STEP);
-                            } else {
-                                sphereTranslation = sphereTranslation + Point2D(0, MOVE_STEP);
-                            }
+                            translateSelected(Point3D(0, MOVE_STEP, 0));
                             break;
                         case SDLK_LEFT:
-                            if (selectedObject == 0) {
-                                cubeTranslation = cubeTranslation + Point2D(-MOVE_STEP, 0);
-                            } else {
-                                sphereTranslation = sphereTranslation + Point2D(-MOVE_STEP, 0);
-                            }
+                            translateSelected(Point3D(-MOVE_STEP, 0, 0));
                             break;
                         case SDLK_RIGHT:
-                            if (selectedObject == 0) {
-                                cubeTranslation = cubeTranslation + Point2D(MOVE_STEP, 0);
-                            } else {
-                                sphereTranslation = sphereTranslation + Point2D(MOVE_STEP, 0);
-                            }
+                            translateSelected(Point3D(MOVE_STEP, 0, 0));
                             break;
                         case SDLK_KP_1:
-                            if (selectedObject == 0) {
-                                cubeTranslationZ += MOVE_STEP;
-                            } else {
-                                sphereTranslationZ += MOVE_STEP;
-                            }
+                            translateSelected(Point3D(0, 0, MOVE_STEP));
                             break;
                         case SDLK_KP_2:
-                            if (selectedObject == 0) {
-                                cubeTranslationZ -= MOVE_STEP;
-                            } else {
-                                sphereTranslationZ -= MOVE_STEP;
-                            }
+                            translateSelected(Point3D(0, 0, -MOVE_STEP));
                             break;
 
                         // Rotation en X de l'objet
                         case SDLK_a:
-                            if (selectedObject == 0) {
-                                cube->rotate(ROTATE_STEP, 'x', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(ROTATE_STEP, 'x', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(ROTATE_STEP, 'x');
                             break;
                         case SDLK_z:
-                            if (selectedObject == 0) {
-                                cube->rotate(-ROTATE_STEP, 'x', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(-ROTATE_STEP, 'x', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(-ROTATE_STEP, 'x');
                             break;
 
                         // Rotation en Y de l'objet
                         case SDLK_e:
-                            if (selectedObject == 0) {
-                                cube->rotate(ROTATE_STEP, 'y', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(ROTATE_STEP, 'y', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(ROTATE_STEP, 'y');
                             break;
                         case SDLK_r:
-                            if (selectedObject == 0) {
-                                cube->rotate(-ROTATE_STEP, 'y', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(-ROTATE_STEP, 'y', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(-ROTATE_STEP, 'y');
                             break;
 
                         // Rotation en Z de l'objet
                         case SDLK_t:
-                            if (selectedObject == 0) {
-                                cube->rotate(ROTATE_STEP, 'z', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(ROTATE_STEP, 'z', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(ROTATE_STEP, 'z');
                             break;
                         case SDLK_y:
-                            if (selectedObject == 0) {
-                                cube->rotate(-ROTATE_STEP, 'z', cube->center());
-                            } else {
-                                for (auto& quad : sphere->getQuads()) {
-                                    quad.rotate(-ROTATE_STEP, 'z', sphere->getCenter());
-                                }
-                            }
+                            rotateSelected(-ROTATE_STEP, 'z');
                             break;
 
                         // Translation de la caméra
@@ -200,6 +152,16 @@ int main() {
                             cameraTranslation = cameraTranslation + Point2D(MOVE_STEP, 0);
                             break;
                         
+                        // Bilan de l'élimination des objets masqués, pour la dernière image
+                        case SDLK_o: {
+                            const OcclusionStats& stats = occlusion.getStats();
+                            std::cout << "Occlusion : " << stats.occluded << "/" << stats.tested << " objets masqués ("
+                                      << stats.occluders << " occulteurs, " << stats.occluderTriangles << " triangles)\n";
+                            std::cout << "Liste de dessin : " << renderer.getFrame().getDrawList().size() << " triangles, "
+                                      << renderer.getFrame().countColorChanges() << " changements de couleur\n";
+                            break;
+                        }
+
                         // Quitter le programme
                         case SDLK_ESCAPE:
                             running = false;
@@ -208,14 +170,15 @@ int main() {
                 }
             }
 
+            // Placer les objets selon leurs nœuds
+            scene.updateTransforms();
+
             // Effacer l'écran
             renderer.clear({0, 0, 0, 255}); // Fond noir
 
-            // Rendre le cube
-            renderer.renderCube(cube, cubeTranslation + cameraTranslation, cubeTranslationZ, scene);
-
-            // Rendre la sphère
-            renderer.renderSphere(sphere, sphereTranslation + cameraTranslation, sphereTranslationZ, scene);
+            // Rendre tous les objets en une seule liste de dessin, triée une fois : le tampon d'occlusion
+            // est rempli avec les pavés, puis les objets masqués sont omis
+            renderer.renderFrame(scene, cameraTranslation, 0.0f, &occlusion);
 
             // Mettre à jour l'affichage
             renderer.present();
@@ -0,0 +1,204 @@
+#include "frame_builder.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+FrameBuilder::FrameBuilder(float width, float height) : width_(width), height_(height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Les dimensions de l'écran doivent être strictement positives.");
+    }
+}
+
+// Projection perspective du rendu (voir Frustum3D::fromProjection)
+Point2D FrameBuilder::projectPoint(const Point3D& point, const Point3D& eye, float projectionPlaneDistance) const {
+    float dx = point.getX() - eye.getX();
+    float dy = point.getY() - eye.getY();
+    float dz = point.getZ() - eye.getZ();
+    if (dz <= 0) {
+        throw std::runtime_error("Projection impossible : le point est derrière l'œil.\n");
+    }
+    float scale = projectionPlaneDistance / (projectionPlaneDistance + dz);
+    return Point2D(dx * scale + width_ / 2, dy * scale + height_ / 2);
+}
+
+// Placement dans le monde et projection des sommets d'un objet, directement dans les sommets de l'image
+uint32_t FrameBuilder::projectVertices(const std::vector<Point3D>& positions, const ModelTransform& model, const Point2D& translation,
+                                       const Point3D& offsetZ, const Scene3D& scene) {
+    const Transform3D toWorld = model.toTransform3D();
+    const Point3D& eye = scene.getEye();
+    const float projectionPlaneDistance = scene.getProjectionPlaneDistance();
+    const uint32_t base = static_cast<uint32_t>(screenPositions_.size());
+    worldPositions_.clear();
+    for (const Point3D& position : positions) {
+        worldPositions_.push_back(toWorld.apply(position));
+        screenPositions_.push_back(projectPoint(worldPositions_.back() + offsetZ, eye, projectionPlaneDistance) + translation);
+    }
+    return base;
+}
+
+Couleur FrameBuilder::positionColor(const Point3D& centroid) {
+    float xyExcentricity = std::sqrt(centroid.getX() * centroid.getX() + centroid.getY() * centroid.getY());
+    float zClarity = std::abs(centroid.getZ());
+    float yHeight = std::abs(centroid.getY());
+
+    float maxXY = 100.0f;
+    float maxY = 100.0f;
+    float maxZ = 100.0f;
+
+    float xyFactor = std::clamp((xyExcentricity / maxXY), 0.0f, 1.0f);
+    float yFactor = std::clamp(1.0f - (yHeight / maxY), 0.0f, 1.0f);
+    float zFactor = std::clamp((zClarity / maxZ), 0.0f, 1.0f);
+
+    int redIntensity = static_cast<int>(0 * yFactor);
+    int greenIntensity = static_cast<int>(255 * (yFactor + xyFactor + zFactor) / 3.0f);
+    int blueIntensity = static_cast<int>(0 * zFactor);
+
+    return Couleur(redIntensity, greenIntensity, blueIntensity);
+}
+
+// Couleur d'un triangle selon le mode de rendu
+Couleur FrameBuilder::shadeTriangle(MeshShading shading, const Couleur& faceColor, const Couleur& uniformColor, uint32_t a, uint32_t b,
+                                    uint32_t c, float depth, float maxDepth, const Point3D& offsetZ) const {
+    switch (shading) {
+        case MeshShading::FaceColor:
+            return faceColor;
+        case MeshShading::Uniform:
+            return uniformColor;
+        case MeshShading::Depth: {
+            float normalizedDepth = maxDepth > 0.0f ? std::clamp(depth / maxDepth, 0.0f, 1.0f) : 0.0f;
+            return Couleur(UNCHECKED, static_cast<int>(255 * (1 - normalizedDepth)), 0, 0);
+        }
+        case MeshShading::Position: {
+            const auto& world = worldPositions_;
+            Point3D centroid = (world[a] + world[b] + world[c]) * (1.0f / 3.0f);
+            return positionColor(centroid + offsetZ);
+        }
+    }
+    return uniformColor;
+}
+
+// Soumission d'un maillage. En MeshShading::Depth, une première passe cherche la plus grande profondeur
+// de face, comme le rendu d'origine des pavés : profondeur moyenne de la face dans le monde (sans offsetZ),
+// divisée par la plus grande d'entre elles, si bien que la face la plus lointaine est la plus sombre.
+// Le numéro d'objet de la clé ne fait que départager des triangles de même profondeur et de même matériau :
+// il revient à 0 après 65 536 objets sans conséquence, les indices croissants gardant l'ordre de soumission.
+void FrameBuilder::submitMesh(const Mesh3D& mesh, const ModelTransform& model, MeshShading shading, const Point2D& translation,
+                              const Point3D& offsetZ, const Scene3D& scene, const Couleur& uniformColor) {
+    const uint32_t base = projectVertices(mesh.getPositions(), model, translation, offsetZ, scene);
+    const auto& world = worldPositions_;
+    const uint16_t object = nextObject_++;
+    const uint16_t material = static_cast<uint16_t>(shading);
+
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    const uint32_t triangleCount = static_cast<uint32_t>(mesh.getTriangleCount());
+    auto triangleDepth = [&](uint32_t t) {
+        const uint32_t* face = &indices[3 * t];
+        return (world[face[0]].getZ() + world[face[1]].getZ() + world[face[2]].getZ()) / 3.0f;
+    };
+    // Les deux triangles d'un quadrilatère (2q et 2q + 1, voir Mesh3D::appendQuads) forment une face,
+    // de profondeur moyenne celle de ses triangles, comme Quad3D::averageDepth
+    auto faceDepth = [&](uint32_t first, float firstDepth) {
+        return first + 1 < triangleCount ? (firstDepth + triangleDepth(first + 1)) / 2.0f : firstDepth;
+    };
+    const bool perFace = shading == MeshShading::Depth;
+    float maxDepth = 0.0f;
+    if (perFace) {
+        for (uint32_t t = 0; t < triangleCount; t += 2) {
+            maxDepth = std::max(maxDepth, faceDepth(t, triangleDepth(t)));
+        }
+    }
+    float colorDepth = 0.0f;
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        const float depth = triangleDepth(t);
+        if (!perFace) {
+            colorDepth = depth;
+        } else if (t % 2 == 0) {
+            colorDepth = faceDepth(t, depth);
+        }
+        const uint32_t* face = &indices[3 * t];
+        Couleur color = shadeTriangle(shading, mesh.getFaceColor(t), uniformColor, face[0], face[1], face[2], colorDepth, maxDepth, offsetZ);
+        drawList_.add(depth, material, object, static_cast<uint32_t>(triangles_.size()));
+        triangles_.push_back(FrameTriangle{base + face[0], base + face[1], base + face[2], color});
+    }
+}
+
+// Soumission en bandes : chaque triangle devient un élément, trié avec ceux des autres objets. Le tri global
+// par profondeur sépare les triangles d'une même bande : les bandes n'épargnent ici que la lecture des indices
+// et les sommets soudés, projetés une seule fois, pas le remplissage
+void FrameBuilder::submitStrips(const StripMesh3D& strips, const ModelTransform& model, MeshShading shading, const Point2D& translation,
+                                const Point3D& offsetZ, const Scene3D& scene) {
+    const uint32_t base = projectVertices(strips.getPositions(), model, translation, offsetZ, scene);
+    const auto& world = worldPositions_;
+    const uint16_t object = nextObject_++;
+    const uint16_t material = static_cast<uint16_t>(shading);
+
+    const std::vector<Couleur>& faceColors = strips.getFaceColors();
+    for (const TrianglePrimitive& primitive : strips.getPrimitives()) {
+        for (uint32_t k = 0; k + 2 < primitive.count; ++k) {
+            // Sommets dans l'ordre d'origine : les deux premiers sont échangés pour k impair dans une bande
+            const std::array<uint32_t, 3> v = strips.triangleAt(primitive, k);
+            float depth = (world[v[0]].getZ() + world[v[1]].getZ() + world[v[2]].getZ()) / 3.0f;
+            Couleur color = shadeTriangle(shading, faceColors[primitive.firstFace + k], Couleur(), v[0], v[1], v[2], depth, 0.0f, offsetZ);
+            drawList_.add(depth, material, object, static_cast<uint32_t>(triangles_.size()));
+            triangles_.push_back(FrameTriangle{base + v[0], base + v[1], base + v[2], color});
+        }
+    }
+}
+
+// Préparation d'une image : soumission de tous les objets, puis un seul tri
+void FrameBuilder::build(Scene3D& scene, const Point2D& translation, float translationZ, OcclusionBuffer3D* occlusion) {
+    drawList_.clear();
+    screenPositions_.clear();
+    triangles_.clear();
+    nextObject_ = 0;
+    if (occlusion) {
+        scene.buildOcclusion(*occlusion, width_, height_, DEFAULT_OCCLUDER_COUNT, translation, translationZ);
+    }
+    const Point3D offsetZ(0, 0, translationZ);
+
+    for (const Pave3D& cube : scene.getCubes()) {
+        if (occlusion && occlusion->isOccluded(cube.boundingBox())) {
+            continue;
+        }
+        cube.exportMesh(meshScratch_);
+        submitMesh(meshScratch_, cube.getModelTransform(), MeshShading::Depth, translation, offsetZ, scene);
+    }
+    // La translation en z du rendu équivaut à reculer l'œil d'autant
+    const Point3D lodEye = scene.getEye() - offsetZ;
+    for (Sphere3D& sphere : scene.getSpheres()) {
+        if (occlusion && occlusion->isOccluded(sphere.boundingBox())) {
+            continue;
+        }
+        int lod = sphere.selectLod(lodEye, scene.getProjectionPlaneDistance(), scene.getLodPixelError());
+        submitStrips(sphere.getLodStrips(lod), sphere.getModelTransform(), MeshShading::Position, translation, offsetZ, scene);
+    }
+    // Le maillage partagé est exporté une fois, puis placé dans le monde à la volée pour chaque instance
+    for (const auto& instances : scene.getInstancedMeshes()) {
+        meshScratch_.clear();
+        meshScratch_.appendQuads(instances->getMesh());
+        for (size_t i = 0; i < instances->getInstanceCount(); ++i) {
+            if (occlusion && occlusion->isOccluded(instances->getInstanceBounds(i).boundingBox())) {
+                continue;
+            }
+            submitMesh(meshScratch_, instances->getTransform(i), MeshShading::Uniform, translation, offsetZ, scene,
+                       instances->getColor(i));
+        }
+    }
+
+    drawList_.sort();
+}
+
+// Même règle que la boucle de dessin de Renderer::renderFrame
+size_t FrameBuilder::countColorChanges() const {
+    size_t changes = 0;
+    const Couleur* current = nullptr;
+    for (const DrawItem& item : drawList_) {
+        const Couleur& color = triangles_[item.index].color;
+        if (!current || color != *current) {
+            ++changes;
+            current = &color;
+        }
+    }
+    return changes;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file frame_builder.h
+ * @brief Déclaration de la classe FrameBuilder : préparation d'une image complète, sans dépendance à SDL.
+ *
+ * Tous les pavés, sphères et instances d'une scène soumettent leurs triangles (sommets placés dans le
+ * monde et projetés une seule fois, couleur calculée) à une seule liste de dessin, triée une seule
+ * fois du plus lointain au plus proche. Le rendu n'a plus qu'à parcourir la liste et remplir les
+ * triangles ; la préparation, elle, peut être testée et mesurée sans fenêtre.
+ */
+#ifndef FRAME_BUILDER_H
+#define FRAME_BUILDER_H
+
+#include "scene3d.h"
+#include "../geometry/draw_list3d.h"
+#include "../geometry/mesh3d.h"
+#include "../geometry/strip_mesh3d.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Choix de la couleur des faces lors de la soumission d'un maillage.
+ */
+enum class MeshShading {
+    FaceColor, ///< Couleur stockée dans le maillage pour chaque face.
+    Uniform,   ///< Une seule couleur pour tout le maillage (instances).
+    Depth,     ///< Rouge d'autant plus sombre que la face est lointaine (pavés) : une couleur par quadrilatère,
+               ///< profondeur moyenne de la face dans le monde divisée par la plus grande de l'objet.
+    Position   ///< Vert selon la position du centroïde dans le monde (sphères).
+};
+
+/**
+ * @struct FrameTriangle
+ * @brief Triangle d'une image : indices de ses sommets dans FrameBuilder::getScreenPositions et couleur déjà calculée.
+ */
+struct FrameTriangle {
+    uint32_t a, b, c; ///< Sommets du triangle.
+    Couleur color;    ///< Couleur du triangle.
+};
+
+/**
+ * @class FrameBuilder
+ * @brief Liste de dessin d'une image complète, prête à être dessinée.
+ *
+ * Les tampons sont conservés d'une image à l'autre : une fois dimensionnés, build n'alloue plus rien.
+ */
+class FrameBuilder {
+private:
+    float width_;                                // Largeur de l'écran.
+    float height_;                               // Hauteur de l'écran.
+    Mesh3D meshScratch_;                         // Maillage exporté par les pavés et les instances.
+    std::vector<Point3D> worldPositions_;        // Sommets de l'objet courant placés dans le monde.
+    std::vector<Point2D> screenPositions_;       // Sommets projetés de tous les objets de l'image.
+    std::vector<FrameTriangle> triangles_;       // Triangles de tous les objets de l'image.
+    DrawList3D drawList_;                        // Liste de dessin de l'image, tous objets confondus.
+    uint16_t nextObject_ = 0;                    // Numéro du prochain objet soumis (départage seulement, voir submitMesh).
+
+    /**
+     * @brief Projette un point du monde à l'écran.
+     * @throw std::runtime_error Si le point est derrière l'œil.
+     */
+    Point2D projectPoint(const Point3D& point, const Point3D& eye, float projectionPlaneDistance) const;
+
+    /**
+     * @brief Place des sommets dans le monde et les ajoute, projetés, aux sommets de l'image.
+     *
+     * Les sommets placés dans le monde sont rangés dans worldPositions_.
+     *
+     * @param positions Les sommets en espace objet.
+     * @param model La transformation de modèle.
+     * @param translation La translation en 2D à appliquer.
+     * @param offsetZ La translation en profondeur, sous forme de vecteur.
+     * @param scene La scène contenant la caméra.
+     * @return L'indice du premier sommet ajouté.
+     */
+    uint32_t projectVertices(const std::vector<Point3D>& positions, const ModelTransform& model, const Point2D& translation,
+                             const Point3D& offsetZ, const Scene3D& scene);
+
+    /**
+     * @brief Calcule la couleur d'un triangle dont les sommets sont dans worldPositions_.
+     * @param shading Le choix de la couleur.
+     * @param faceColor La couleur stockée pour la face.
+     * @param uniformColor La couleur utilisée avec MeshShading::Uniform.
+     * @param a Le premier sommet.
+     * @param b Le deuxième sommet.
+     * @param c Le troisième sommet.
+     * @param depth La profondeur servant à la couleur.
+     * @param maxDepth La plus grande profondeur de face de l'objet (MeshShading::Depth).
+     * @param offsetZ La translation en profondeur, sous forme de vecteur.
+     * @return La couleur.
+     */
+    Couleur shadeTriangle(MeshShading shading, const Couleur& faceColor, const Couleur& uniformColor, uint32_t a, uint32_t b,
+                          uint32_t c, float depth, float maxDepth, const Point3D& offsetZ) const;
+
+    /**
+     * @brief Soumet les triangles d'un maillage à la liste de dessin.
+     * @param mesh Le maillage en espace objet.
+     * @param model La transformation de modèle.
+     * @param shading Le choix de la couleur des faces, qui sert aussi de matériau.
+     * @param translation La translation en 2D à appliquer.
+     * @param offsetZ La translation en profondeur, sous forme de vecteur.
+     * @param scene La scène contenant la caméra.
+     * @param uniformColor La couleur utilisée avec MeshShading::Uniform.
+     */
+    void submitMesh(const Mesh3D& mesh, const ModelTransform& model, MeshShading shading, const Point2D& translation,
+                    const Point3D& offsetZ, const Scene3D& scene, const Couleur& uniformColor = Couleur());
+
+    /**
+     * @brief Soumet les triangles d'un maillage en bandes à la liste de dessin, un élément par triangle.
+     * @param strips Le maillage en bandes, en espace objet.
+     * @param model La transformation de modèle.
+     * @param shading Le choix de la couleur des faces, qui sert aussi de matériau : MeshShading::FaceColor
+     *        ou MeshShading::Position (les bandes n'ont ni couleur uniforme ni faces quadrilatères).
+     * @param translation La translation en 2D à appliquer.
+     * @param offsetZ La translation en profondeur, sous forme de vecteur.
+     * @param scene La scène contenant la caméra.
+     */
+    void submitStrips(const StripMesh3D& strips, const ModelTransform& model, MeshShading shading, const Point2D& translation,
+                      const Point3D& offsetZ, const Scene3D& scene);
+
+public:
+    /**
+     * @brief Constructeur.
+     * @param width La largeur de l'écran.
+     * @param height La hauteur de l'écran.
+     * @throw std::invalid_argument Si une dimension n'est pas strictement positive.
+     */
+    FrameBuilder(float width, float height);
+
+    /**
+     * @brief Prépare une image complète.
+     *
+     * Les pavés (MeshShading::Depth), les sphères (bandes du niveau de détail choisi,
+     * MeshShading::Position) et chaque instance des maillages instanciés (MeshShading::Uniform)
+     * soumettent leurs triangles, puis la liste de dessin est triée une seule fois.
+     *
+     * @param scene La scène à préparer (le niveau de détail des sphères y est mis à jour).
+     * @param translation La translation en 2D à appliquer (déplacement sur l'écran).
+     * @param translationZ La translation en profondeur (axe Z) à appliquer.
+     * @param occlusion Le tampon d'occlusion : s'il est fourni, il est rempli par les plus grands pavés
+     *        (Scene3D::buildOcclusion, avec les mêmes translations que les triangles) et les pavés, sphères
+     *        et instances masqués ne sont pas soumis.
+     * @throw std::runtime_error Si un sommet soumis est derrière l'œil.
+     */
+    void build(Scene3D& scene, const Point2D& translation, float translationZ = 0.0f, OcclusionBuffer3D* occlusion = nullptr);
+
+    /**
+     * @brief Compte les changements de couleur de dessin nécessaires pour parcourir la liste de dessin.
+     *
+     * Le premier triangle en compte un ; chaque triangle d'une autre couleur que le précédent en ajoute un.
+     */
+    size_t countColorChanges() const;
+
+    /**
+     * @brief Calcule la couleur d'une face à partir de la position de son centroïde (MeshShading::Position).
+     * @param centroid Le centroïde de la face dans le monde.
+     * @return La couleur.
+     */
+    static Couleur positionColor(const Point3D& centroid);
+
+    const DrawList3D& getDrawList() const { return drawList_; }
+    const std::vector<FrameTriangle>& getTriangles() const { return triangles_; }
+    const std::vector<Point2D>& getScreenPositions() const { return screenPositions_; }
+};
+
+#endif // FRAME_BUILDER_H
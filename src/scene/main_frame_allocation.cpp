@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+#include "frame_builder.h"
+#include "../geometry/vertex_buffer3d.h"
+
+// Compteur d'allocations : remplace l'opérateur new global pour tout le programme de test
+static std::size_t allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// Formes alignées, appelées par AlignedAllocator (VertexBuffer3D). Elles ne sont pas inlinées :
+// sinon GCC rapproche free de l'opérateur new appelant et signale à tort un appariement incorrect.
+[[gnu::noinline]] void* operator new(std::size_t size, std::align_val_t alignment) {
+    ++allocationCount;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    // aligned_alloc demande une taille multiple de l'alignement
+    const std::size_t rounded = ((size ? size : 1) + align - 1) / align * align;
+    if (void* p = std::aligned_alloc(align, rounded)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { operator delete(p, alignment); }
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { operator delete(p, alignment); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { operator delete(p, alignment); }
+
+void testFrameAllocation() {
+    // Une image du programme principal : pavés, sphères, instances et élimination des objets masqués
+    Scene3D scene(Point3D(0, 0, -100), Point3D(0, 0, 0), 500.0f);
+    CubeHandle cube = scene.addCube(Pave3D(Point3D(-50, -50, 200), 100, 100, 100, Couleur(255, 0, 0)));
+    scene.addCube(Pave3D(Point3D(-400, -300, 600), 800, 600, 20, Couleur(0, 0, 255)));
+    SphereHandle sphere = scene.addSphere(Sphere3D(Point3D(100, 0, 300), 80.0f, 64));
+    scene.addSphere(Sphere3D(Point3D(0, 50, 900), 40.0f, 16)); // Derrière le mur
+    auto instances = std::make_shared<InstancedMesh3D>(InstancedMesh3D::fromPave(Pave3D(Point3D(0, 0, 0), 10, 10, 10, Couleur(255, 255, 255))));
+    for (int i = 0; i < 20; ++i) {
+        instances->addInstance(ModelTransform(Point3D(-200.0f + 20 * i, -120, 400.0f + 30 * i)), Couleur(0, 255, 0));
+    }
+    scene.addInstancedMesh(instances);
+    Point3D eye = scene.getEye();
+    OcclusionBuffer3D occlusion;
+    FrameBuilder frame(800.0f, 600.0f);
+
+    // Première image : construit les caches et dimensionne les tampons
+    frame.build(scene, Point2D(0, 0), 0.0f, &occlusion);
+    assert(allocationCount > 0 && occlusion.getStats().occluded > 0);
+    std::cout << "check1 (warm-up frame)" << std::endl;
+
+    // Images suivantes : aucune allocation, sur le chemin de Renderer::renderFrame
+    std::size_t before = allocationCount;
+    std::size_t triangles = 0, colorChanges = 0;
+    for (int frameIndex = 0; frameIndex < 10; ++frameIndex) {
+        // Animation : seule la transformation de modèle change
+        scene.getCube(cube).rotate(0.01f, 'y', scene.getCube(cube).center());
+        scene.getSphere(sphere).rotate(0.01f, 'x', scene.getSphere(sphere).getCenter());
+        frame.build(scene, Point2D(0, 0), 0.0f, &occlusion);
+        triangles += frame.getDrawList().size();
+        colorChanges += frame.countColorChanges();
+    }
+    std::size_t allocations = allocationCount - before;
+    assert(allocations == 0);
+    std::cout << "check2 (steady-state frames allocate nothing, " << triangles << " triangles, " << colorChanges << " colour changes)" << std::endl;
+
+    Pave3D& cubeRef = scene.getCube(cube);
+    // Les formes non allouantes donnent les mêmes faces que les formes historiques
+    std::vector<Quad3D> faces = cubeRef.getVisibleFaces(eye);
+    std::array<const Quad3D*, 6> visible;
+    size_t count = cubeRef.getVisibleFaces(eye, visible);
+    assert(count == faces.size());
+    for (size_t i = 0; i < count; ++i) {
+        assert(*visible[i] == faces[i]);
+    }
+    std::vector<Point3D> vertices = faces[0].getVertices();
+    std::array<Point3D, 4> corners = faces[0].getCorners();
+    assert(std::equal(vertices.begin(), vertices.end(), corners.begin()));
+    std::cout << "check3 (array and visitor forms match)" << std::endl;
+
+    // Les allocations alignées sont comptées elles aussi
+    before = allocationCount;
+    {
+        std::vector<float, AlignedAllocator<float, 32>> aligned(100);
+        assert(reinterpret_cast<std::uintptr_t>(aligned.data()) % 32 == 0);
+    }
+    assert(allocationCount == before + 1);
+    std::cout << "check4 (aligned allocations are counted)" << std::endl;
+
+    std::cout << "All frame allocation tests passed!" << std::endl;
+}
+
+int main() {
+    testFrameAllocation();
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "frame_builder.h"
+
+namespace {
+
+// Un ensemble d'instances d'un petit pavé, centré sur chaque position
+std::shared_ptr<InstancedMesh3D> makeInstances(const std::vector<Point3D>& positions, const std::vector<Couleur>& colors) {
+    auto instances = std::make_shared<InstancedMesh3D>(InstancedMesh3D::fromPave(Pave3D(Point3D(0, 0, 0), 10, 10, 10, Couleur(255, 255, 255))));
+    for (size_t i = 0; i < positions.size(); ++i) {
+        instances->addInstance(ModelTransform(positions[i]), colors[i]);
+    }
+    return instances;
+}
+
+} // namespace
+
+void testBuild() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    CubeHandle cubeHandle = scene.addCube(Pave3D(Point3D(-50, -50, 100), 100, 100, 100, Couleur(255, 0, 0)));
+    scene.addSphere(Sphere3D(Point3D(30, 0, 150), 60.0f, 16));
+    FrameBuilder frame(800.0f, 600.0f);
+    frame.build(scene, Point2D(0, 0));
+
+    // Tous les triangles des deux objets sont dans la liste, triés du plus lointain au plus proche
+    const DrawList3D& list = frame.getDrawList();
+    const std::vector<FrameTriangle>& triangles = frame.getTriangles();
+    assert(list.size() == triangles.size() && triangles.size() > 12);
+    for (size_t i = 1; i < list.size(); ++i) {
+        assert(DrawList3D::keyDepth(list[i - 1].key) >= DrawList3D::keyDepth(list[i].key));
+    }
+    const size_t vertexCount = frame.getScreenPositions().size();
+    for (const FrameTriangle& triangle : triangles) {
+        assert(triangle.a < vertexCount && triangle.b < vertexCount && triangle.c < vertexCount);
+    }
+    std::cout << "check1 (" << triangles.size() << " triangles of a cube and a sphere in one sorted list)" << std::endl;
+
+    // Les pavés sont soumis en premier : une couleur par face, comme le rendu d'origine des pavés,
+    // rouge 255 * (1 - profondeur moyenne de la face / plus grande profondeur de face)
+    const Pave3D& cube = scene.getCube(cubeHandle);
+    float maxFaceDepth = 0.0f;
+    for (size_t q = 0; q < 6; ++q) {
+        maxFaceDepth = std::max(maxFaceDepth, cube.getFace(q).averageDepth());
+    }
+    size_t darkest = 0;
+    for (size_t q = 0; q < 6; ++q) {
+        assert(triangles[2 * q].color == triangles[2 * q + 1].color);
+        const int expected = static_cast<int>(255 * (1 - cube.getFace(q).averageDepth() / maxFaceDepth));
+        assert(std::abs(triangles[2 * q].color.getRouge() - expected) <= 1);
+        assert(triangles[2 * q].color.getVert() == 0 && triangles[2 * q].color.getBleu() == 0);
+        darkest += triangles[2 * q].color.getRouge() == 0 ? 1 : 0;
+    }
+    // Le pavé va de z = 100 à 200 : la face arrière est noire, la face avant à mi-rampe
+    assert(darkest == 1);
+    assert(std::abs(triangles[0].color.getRouge() - static_cast<int>(255 * (1 - 100.0f / 200.0f))) <= 1);
+    std::cout << "check2 (one depth colour per cube face, normalised by the farthest face)" << std::endl;
+
+    // Reconstruire l'image donne la même liste
+    const size_t previous = triangles.size();
+    frame.build(scene, Point2D(0, 0));
+    assert(frame.getTriangles().size() == previous && frame.getScreenPositions().size() == vertexCount);
+    try {
+        FrameBuilder invalid(0.0f, 600.0f);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check3 (rebuild and invalid dimensions)" << std::endl;
+}
+
+void testStripWinding() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    SphereHandle handle = scene.addSphere(Sphere3D(Point3D(0, 0, 150), 60.0f, 16));
+    FrameBuilder frame(800.0f, 600.0f);
+    frame.build(scene, Point2D(0, 0));
+
+    // Les triangles des bandes gardent le sens du maillage d'origine, k impair compris
+    const Sphere3D& sphere = scene.getSphere(handle);
+    const Mesh3D mesh = sphere.getLodStrips(sphere.getCurrentLod()).toMesh();
+    const std::vector<FrameTriangle>& triangles = frame.getTriangles();
+    assert(triangles.size() == mesh.getTriangleCount());
+    const std::vector<uint32_t>& indices = mesh.getIndices();
+    for (size_t t = 0; t < triangles.size(); ++t) {
+        assert(triangles[t].a == indices[3 * t] && triangles[t].b == indices[3 * t + 1] && triangles[t].c == indices[3 * t + 2]);
+    }
+    std::cout << "check4 (" << triangles.size() << " strip triangles keep their original winding)" << std::endl;
+}
+
+void testColorChanges() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    const Couleur red(255, 0, 0), blue(0, 0, 255);
+    // Dessinées de la plus lointaine à la plus proche : rouge, rouge, bleu -> deux changements de couleur
+    scene.addInstancedMesh(makeInstances({Point3D(0, 0, 100), Point3D(0, 0, 300), Point3D(0, 0, 200)}, {blue, red, red}));
+    FrameBuilder frame(800.0f, 600.0f);
+    frame.build(scene, Point2D(0, 0));
+    assert(frame.getDrawList().size() == 36);
+    assert(frame.countColorChanges() == 2);
+    std::cout << "check5 (colour changes of the draw loop, not shading modes)" << std::endl;
+}
+
+void testInstanceOcclusion() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    scene.addCube(Pave3D(Point3D(-300, -300, 0), 600, 600, 20, Couleur(255, 0, 0)));
+    std::vector<Point3D> positions;
+    std::vector<Couleur> colors;
+    for (int i = 0; i < 10; ++i) {
+        positions.push_back(Point3D(-100.0f + 20 * i, 20, 300)); // Derrière le mur
+        colors.push_back(Couleur(0, 0, 255));
+    }
+    positions.push_back(Point3D(0, 0, -50)); // Devant le mur
+    colors.push_back(Couleur(0, 255, 0));
+    scene.addInstancedMesh(makeInstances(positions, colors));
+
+    OcclusionBuffer3D buffer;
+    FrameBuilder frame(1200.0f, 900.0f);
+    frame.build(scene, Point2D(0, 0), 0.0f, &buffer);
+    const OcclusionStats& stats = buffer.getStats();
+    // Le mur et chaque instance sont testés ; seules les instances cachées sont omises
+    assert(stats.tested == 12 && stats.occluded == 10);
+    assert(frame.getTriangles().size() == 2 * 12);
+    std::cout << "check6 (" << stats.occluded << " instances hidden behind the wall are not submitted)" << std::endl;
+}
+
+void testTranslatedOcclusion() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    // Sans translation, le mur couvre la moitié gauche de l'écran et la sphère déborde à gauche de l'écran
+    scene.addCube(Pave3D(Point3D(-1500, -1200, 0), 1500, 2400, 20, Couleur(255, 0, 0)));
+    scene.addSphere(Sphere3D(Point3D(-2000, 0, 200), 100.0f, 8));
+    OcclusionBuffer3D buffer;
+    FrameBuilder frame(800.0f, 600.0f);
+    frame.build(scene, Point2D(0, 0), 0.0f, &buffer);
+    // La partie visible à l'écran est derrière le mur : la sphère est omise
+    assert(buffer.getStats().occluded == 1 && frame.getTriangles().size() == 12);
+
+    // Décalé de 500 pixels, le bord gauche de la sphère dépasse du mur : le tampon suit la translation du rendu
+    frame.build(scene, Point2D(500, 0), 0.0f, &buffer);
+    assert(buffer.getStats().occluded == 0 && frame.getTriangles().size() > 12);
+    std::cout << "check7 (occlusion uses the translation of the drawn triangles)" << std::endl;
+}
+
+int main() {
+    testBuild();
+    testStripWinding();
+    testColorChanges();
+    testInstanceOcclusion();
+    testTranslatedOcclusion();
+    std::cout << "All frame builder tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "scene3d.h"
+#include "scene_graph.h"
+
+namespace {
+
+bool near(const Point3D& a, const Point3D& b, float tolerance = 1e-3f) {
+    return a.distance(b) < tolerance;
+}
+
+} // namespace
+
+void testHierarchy() {
+    SceneGraph graph;
+    NodeHandle root = graph.createNode(ModelTransform(Point3D(100, 0, 0)));
+    NodeHandle arm = graph.createNode(ModelTransform(Point3D(0, 10, 0), Quaternion::fromAxisAngle('z', M_PI / 2), 2.0f), root);
+    NodeHandle hand = graph.createNode(ModelTransform(Point3D(5, 0, 0)), arm);
+    graph.update();
+    assert(graph.getUpdatedCount() == 3);
+    assert(near(graph.getWorld(arm).getPosition(), Point3D(100, 10, 0)));
+    // La main est à 5 unités de l'avant-bras, mis à l'échelle 2 et tourné d'un quart de tour autour de z
+    assert(near(graph.getWorld(hand).getPosition(), Point3D(100, 20, 0)));
+    assert(std::fabs(graph.getWorld(hand).getScale() - 2.0f) < 1e-6f);
+    assert(graph.getParent(hand) == arm && graph.getParent(arm) == root && !graph.getParent(root).isValid());
+    std::cout << "check1 (world = parent * local)" << std::endl;
+
+    // Seuls le nœud modifié et ses descendants sont recalculés
+    graph.translate(arm, Point3D(0, 0, 7));
+    graph.update();
+    assert(graph.getUpdatedCount() == 2 && !graph.worldChanged(root) && graph.worldChanged(arm) && graph.worldChanged(hand));
+    assert(near(graph.getWorld(hand).getPosition(), Point3D(100, 20, 7)));
+    graph.update();
+    assert(graph.getUpdatedCount() == 0 && !graph.worldChanged(hand));
+    std::cout << "check2 (dirty flags limit the update to modified subtrees)" << std::endl;
+}
+
+void testDepthFirstOrder() {
+    SceneGraph graph;
+    NodeHandle a = graph.createNode();
+    NodeHandle b = graph.createNode();
+    NodeHandle a1 = graph.createNode(ModelTransform(Point3D(1, 0, 0)), a);
+    NodeHandle b1 = graph.createNode(ModelTransform(Point3D(0, 1, 0)), b);
+    NodeHandle a2 = graph.createNode(ModelTransform(Point3D(2, 0, 0)), a);
+    NodeHandle a11 = graph.createNode(ModelTransform(Point3D(0, 0, 1)), a1);
+
+    // Ordre en profondeur d'abord : a, a1, a11, a2, b, b1
+    const NodeHandle expected[] = {a, a1, a11, a2, b, b1};
+    assert(graph.size() == 6);
+    for (size_t i = 0; i < graph.size(); ++i) {
+        assert(graph.handleAt(i) == expected[i]);
+    }
+    assert(graph.getSubtreeSize(a) == 4 && graph.getSubtreeSize(a1) == 2 && graph.getSubtreeSize(b) == 2);
+    graph.setLocal(b, ModelTransform(Point3D(50, 0, 0)));
+    graph.update();
+    assert(near(graph.getWorld(b1).getPosition(), Point3D(50, 1, 0)) && near(graph.getWorld(a11).getPosition(), Point3D(1, 0, 1)));
+    std::cout << "check3 (nodes stored depth first)" << std::endl;
+
+    // Retrait d'un sous-arbre : ses identifiants sont périmés, les autres restent valables
+    graph.removeNode(a1);
+    assert(graph.size() == 4 && !graph.contains(a1) && !graph.contains(a11));
+    assert(graph.getSubtreeSize(a) == 2 && graph.getParent(a2) == a && graph.getParent(b1) == b);
+    try {
+        graph.getWorld(a11);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    NodeHandle c = graph.createNode(ModelTransform(Point3D(0, 0, 3)), b1);
+    assert(c.index == a1.index || c.index == a11.index);
+    assert(!graph.contains(a1) && !graph.contains(a11) && graph.getParent(c) == b1);
+    graph.update();
+    assert(graph.getUpdatedCount() == 1 && near(graph.getWorld(c).getPosition(), Point3D(50, 1, 3)));
+    try {
+        graph.createNode(ModelTransform(), a11);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    graph.clear();
+    assert(graph.empty() && !graph.contains(a) && !graph.contains(c));
+    std::cout << "check4 (remove subtree and stale handles)" << std::endl;
+}
+
+void testManyChildren() {
+    SceneGraph graph;
+    const size_t count = 10000;
+    NodeHandle parent = graph.createNode();
+    std::vector<NodeHandle> children;
+    for (size_t i = 0; i < count; ++i) {
+        children.push_back(graph.createNode(ModelTransform(Point3D(static_cast<float>(i), 0, 0)), parent));
+    }
+    NodeHandle other = graph.createNode();
+    graph.update();
+    assert(graph.getUpdatedCount() == count + 2);
+
+    // Déplacer le parent : une composition par enfant, le nœud voisin n'est pas touché
+    graph.translate(parent, Point3D(0, 0, 10));
+    graph.update();
+    assert(graph.getUpdatedCount() == count + 1 && !graph.worldChanged(other));
+    assert(near(graph.getWorld(children[1234]).getPosition(), Point3D(1234, 0, 10)));
+
+    // Modifier un seul enfant : un seul recalcul
+    graph.translate(children[42], Point3D(0, 1, 0));
+    graph.update();
+    assert(graph.getUpdatedCount() == 1 && graph.worldChanged(children[42]));
+    std::cout << "check5 (moving a parent of " << count << " children)" << std::endl;
+}
+
+void testSceneAttachments() {
+    Scene3D scene(Point3D(0, 0, -100), Point3D(0, 0, 0), 50.0f);
+    CubeHandle cube = scene.addCube(Pave3D(Point3D(0, 0, 0), 2, 2, 2, Couleur(0, 0, 255)));
+    SphereHandle sphere = scene.addSphere(Sphere3D(Point3D(10, 0, 0), 3.0f, 4));
+    CubeHandle loose = scene.addCube(Pave3D(Point3D(40, 0, 0), 2, 2, 2, Couleur(0, 0, 255)));
+    const Point3D cubeCenter = scene.getCube(cube).center();
+    const Point3D looseCenter = scene.getCube(loose).center();
+
+    NodeHandle group = scene.getGraph().createNode();
+    NodeHandle cubeNode = scene.attachCube(cube, group);
+    NodeHandle sphereNode = scene.attachSphere(sphere, cubeNode);
+    assert(scene.getCubeNode(cube) == cubeNode && scene.getSphereNode(sphere) == sphereNode);
+    assert(!scene.getCubeNode(loose).isValid());
+    try {
+        scene.attachCube(cube);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    // Rattacher ne déplace rien ; déplacer le groupe déplace ses objets, pas les autres
+    scene.updateTransforms();
+    assert(near(scene.getCube(cube).center(), cubeCenter) && near(scene.getSphere(sphere).getCenter(), Point3D(10, 0, 0)));
+    scene.getGraph().translate(group, Point3D(0, 20, 5));
+    scene.updateTransforms();
+    assert(near(scene.getCube(cube).center(), cubeCenter + Point3D(0, 20, 5)));
+    assert(near(scene.getSphere(sphere).getCenter(), Point3D(10, 20, 5)));
+    assert(std::fabs(scene.getSphere(sphere).getRadius() - 3.0f) < 1e-5f);
+    assert(near(scene.getCube(loose).center(), looseCenter));
+    assert(scene.getSphere(sphere).boundingBox().contains(Point3D(10, 22, 5)));
+    std::cout << "check6 (attached objects follow their nodes)" << std::endl;
+
+    // Retirer un objet retire son nœud et son sous-arbre ; la sphère n'est plus attachée
+    scene.removeCube(cube);
+    assert(!scene.getGraph().contains(cubeNode) && !scene.getGraph().contains(sphereNode));
+    scene.getGraph().translate(group, Point3D(0, 20, 0));
+    scene.updateTransforms();
+    assert(near(scene.getSphere(sphere).getCenter(), Point3D(10, 20, 5)));
+    NodeHandle again = scene.attachSphere(sphere, group);
+    scene.getGraph().translate(group, Point3D(1, 0, 0));
+    scene.updateTransforms();
+    assert(scene.getSphereNode(sphere) == again && near(scene.getSphere(sphere).getCenter(), Point3D(11, 20, 5)));
+    scene.clear();
+    assert(scene.getGraph().empty());
+    std::cout << "check7 (remove and clear detach objects)" << std::endl;
+}
+
+int main() {
+    testHierarchy();
+    testDepthFirstOrder();
+    testManyChildren();
+    testSceneAttachments();
+    std::cout << "All scene graph tests passed!" << std::endl;
+    return 0;
+}
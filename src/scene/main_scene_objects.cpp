@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "scene3d.h"
+#include "slot_map.h"
+#include "../geometry/bvh3d.h"
+
+void testSlotMap() {
+    // Ajout et accès par identifiant
+    SlotMap<std::string> names;
+    ObjectHandle<std::string> a = names.insert("a");
+    ObjectHandle<std::string> b = names.insert("b");
+    ObjectHandle<std::string> c = names.insert("c");
+    assert(names.size() == 3 && a != b && b != c);
+    assert(names.get(a) == "a" && names.get(b) == "b" && names.get(c) == "c");
+    assert(!ObjectHandle<std::string>().isValid() && !names.contains(ObjectHandle<std::string>()));
+    std::cout << "check1 (insert and get)" << std::endl;
+
+    // Suppression : le dernier objet comble le trou, les autres identifiants restent valables
+    names.remove(a);
+    assert(names.size() == 2 && !names.contains(a));
+    assert(names.objects()[0] == "c" && names.get(c) == "c" && names.get(b) == "b");
+    assert(names.handleAt(0) == c);
+    try {
+        names.get(a);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    try {
+        names.remove(a);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    std::cout << "check2 (remove keeps other handles valid)" << std::endl;
+
+    // Case réutilisée : nouvelle génération, l'ancien identifiant reste périmé
+    ObjectHandle<std::string> d = names.insert("d");
+    assert(d.index == a.index && d.generation != a.generation);
+    assert(!names.contains(a) && names.get(d) == "d");
+    ObjectHandle<std::string> forged{d.index, d.generation + 1};
+    assert(!names.contains(forged));
+    names.clear();
+    assert(names.empty() && !names.contains(b) && !names.contains(c) && !names.contains(d));
+    assert(names.get(names.insert("e")) == "e");
+    std::cout << "check3 (stale handles rejected)" << std::endl;
+}
+
+void testSceneObjects() {
+    static_assert(!std::is_convertible<CubeHandle, SphereHandle>::value, "identifiants de types différents");
+    Scene3D scene(Point3D(0, 0, -100), Point3D(0, 0, 0), 50.0f);
+
+    // Plusieurs milliers d'objets, rangés de façon contiguë
+    const int count = 2000;
+    std::vector<CubeHandle> cubes;
+    std::vector<SphereHandle> spheres;
+    for (int i = 0; i < count; ++i) {
+        cubes.push_back(scene.addCube(Pave3D(Point3D(i * 3.0f, 0, 10), 1, 1, 1, Couleur(0, 0, 255))));
+        spheres.push_back(scene.addSphere(Sphere3D(Point3D(i * 3.0f, 5, 10), 1.0f + i, 4)));
+    }
+    assert(scene.getCubes().size() == count && scene.getSpheres().size() == count);
+    assert(&scene.getCubes().objects()[count - 1] == &scene.getCubes().objects()[0] + (count - 1));
+    assert(scene.getSphere(spheres[1234]).getRadius() == 1235.0f);
+    assert(scene.getCube(cubes[7]).getFace(0).getColor().getRouge() == 255);
+    std::cout << "check4 (" << count << " cubes and " << count << " spheres)" << std::endl;
+
+    // Suppression de la moitié des objets : les autres restent accessibles par leur identifiant
+    for (int i = 0; i < count; i += 2) {
+        scene.removeCube(cubes[i]);
+        scene.removeSphere(spheres[i]);
+    }
+    assert(scene.getCubes().size() == count / 2 && scene.getSpheres().size() == count / 2);
+    for (int i = 0; i < count; ++i) {
+        assert(scene.contains(cubes[i]) == (i % 2 == 1));
+        assert(scene.contains(spheres[i]) == (i % 2 == 1));
+    }
+    assert(scene.getSphere(spheres[1235]).getRadius() == 1236.0f);
+    try {
+        scene.getSphere(spheres[1234]);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    std::cout << "check5 (remove keeps remaining handles valid)" << std::endl;
+
+    // Hiérarchie de boîtes sur les sphères restantes : l'objet i est désigné par getSpheres().handleAt(i)
+    std::vector<BoundingBox3D> bounds;
+    scene.getSphereBounds(bounds);
+    Bvh3D bvh;
+    bvh.build(bounds);
+    Ray3D ray(Point3D(3.0f * 1235, 5, -10000), Point3D(0, 0, 1));
+    BvhRayHit hit;
+    assert(bvh.raycast(ray, hit));
+    float closest = std::numeric_limits<float>::max(), t;
+    for (const Sphere3D& sphere : scene.getSpheres()) {
+        if (ray.intersects(sphere.boundingBox(), t)) {
+            closest = std::min(closest, t);
+        }
+    }
+    const Sphere3D& touched = scene.getSphere(scene.getSpheres().handleAt(hit.item));
+    assert(ray.intersects(touched.boundingBox(), t) && t == closest && hit.distance == closest);
+    std::cout << "check6 (bounds for a bounding volume hierarchy)" << std::endl;
+
+    // Parcours linéaire : faces visibles de tous les pavés, déplacement de l'œil
+    size_t visible = 0;
+    scene.forEachVisibleFace([&visible](const Quad3D&) { ++visible; });
+    assert(visible >= scene.getCubes().size() && visible == scene.getVisibleFaces().size());
+    scene.setEye(Point3D(0, 0, -200));
+    for (Sphere3D& sphere : scene.getSpheres()) {
+        assert(sphere.getRadius() > 1.0f);
+    }
+    scene.clear();
+    assert(!scene.hasCube() && !scene.hasSphere() && !scene.contains(cubes[1]) && !scene.contains(spheres[1]));
+    std::cout << "check7 (linear iteration and clear)" << std::endl;
+}
+
+void testOcclusion() {
+    Scene3D scene(Point3D(0, 0, -200), Point3D(0, 0, 0), 100.0f);
+    // Un grand mur et de petits pavés : seul le mur est retenu comme occulteur
+    CubeHandle wall = scene.addCube(Pave3D(Point3D(-300, -300, 0), 600, 600, 20, Couleur(255, 0, 0)));
+    for (int i = 0; i < 5; ++i) {
+        scene.addCube(Pave3D(Point3D(1000.0f + 50 * i, 0, 500), 5, 5, 5, Couleur(255, 0, 0)));
+    }
+    std::vector<SphereHandle> hidden, visible;
+    for (int i = 0; i < 20; ++i) {
+        hidden.push_back(scene.addSphere(Sphere3D(Point3D(-100.0f + 10 * i, 20, 300), 8.0f, 4)));
+    }
+    visible.push_back(scene.addSphere(Sphere3D(Point3D(0, 0, -50), 8.0f, 4)));    // Devant le mur
+    visible.push_back(scene.addSphere(Sphere3D(Point3D(2000, 0, 300), 8.0f, 4))); // Hors de la silhouette du mur
+
+    OcclusionBuffer3D buffer;
+    scene.buildOcclusion(buffer, 1200.0f, 900.0f, 1);
+    assert(buffer.getStats().occluders == 1);
+    for (SphereHandle handle : hidden) {
+        assert(buffer.isOccluded(scene.getSphere(handle).boundingBox()));
+    }
+    for (SphereHandle handle : visible) {
+        assert(!buffer.isOccluded(scene.getSphere(handle).boundingBox()));
+    }
+    assert(!buffer.isOccluded(scene.getCube(wall).boundingBox()));
+    const OcclusionStats stats = buffer.getStats();
+    assert(stats.tested == 23 && stats.occluded == 20);
+
+    // Le mur derrière l'œil n'est plus un occulteur
+    scene.setEye(Point3D(0, 0, 100));
+    scene.buildOcclusion(buffer, 1200.0f, 900.0f);
+    assert(buffer.getStats().occluders == 5 && !buffer.isOccluded(scene.getSphere(hidden[0]).boundingBox()));
+    std::cout << "check8 (" << stats.occluded << " spheres hidden behind the largest cube)" << std::endl;
+}
+
+int main() {
+    testSlotMap();
+    testSceneObjects();
+    testOcclusion();
+    std::cout << "All scene object tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "scene3d.h"
+#include "../geometry/hash_grid3d.h"
+
+namespace {
+
+// Générateur pseudo-aléatoire déterministe
+uint32_t nextRandom(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+float randomFloat(uint32_t& state, float low, float high) {
+    return low + (high - low) * (nextRandom(state) % 100000) / 100000.0f;
+}
+
+BoundingBox3D randomBox(uint32_t& state) {
+    Point3D center(randomFloat(state, -200, 200), randomFloat(state, -200, 200), randomFloat(state, -200, 200));
+    Point3D half(randomFloat(state, 0.5f, 8), randomFloat(state, 0.5f, 8), randomFloat(state, 0.5f, 8));
+    return BoundingBox3D(center - half, center + half);
+}
+
+bool within(const BoundingBox3D& box, const Point3D& point, float radius) {
+    Point3D d = point - Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+    return d.dotProduct(d) <= radius * radius;
+}
+
+template <typename Handle>
+bool sameHandles(std::vector<Handle> a, std::vector<Handle> b) {
+    auto less = [](const Handle& x, const Handle& y) { return x.index < y.index; };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+    return a == b;
+}
+
+} // namespace
+
+void testHashGrid() {
+    uint32_t state = 12345;
+    const uint32_t count = 1000;
+    HashGrid3D grid(10.0f);
+    std::vector<BoundingBox3D> boxes;
+    for (uint32_t id = 0; id < count; ++id) {
+        boxes.push_back(randomBox(state));
+        grid.insert(id, boxes.back());
+    }
+    assert(grid.size() == count && grid.getCellCount() > 100 && grid.getCellCount() <= count);
+    try {
+        grid.insert(3, boxes[3]);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        HashGrid3D invalid(0.0f);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "check1 (insert " << count << " boxes in " << grid.getCellCount() << " cells)" << std::endl;
+
+    // Déplacement et retrait : la grille suit les boîtes courantes
+    for (uint32_t id = 0; id < count; id += 3) {
+        boxes[id] = randomBox(state);
+        grid.update(id, boxes[id]);
+    }
+    for (uint32_t id = 1; id < count; id += 5) {
+        grid.remove(id);
+    }
+    assert(!grid.contains(1) && grid.contains(2) && !grid.contains(count));
+    try {
+        grid.update(1, boxes[1]);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    try {
+        grid.remove(count + 10);
+        assert(false);
+    } catch (const std::out_of_range&) {
+    }
+    std::cout << "check2 (update and remove)" << std::endl;
+
+    // Requêtes par région, par distance et par volume de vision : mêmes résultats qu'un parcours complet
+    const BoundingBox3D regions[] = {
+        BoundingBox3D(Point3D(-20, -20, -20), Point3D(20, 20, 20)),
+        BoundingBox3D(Point3D(-500, -500, -500), Point3D(500, 500, 500)),
+        BoundingBox3D(Point3D(150, -10, 0), Point3D(160, 10, 1)),
+    };
+    for (const BoundingBox3D& region : regions) {
+        std::vector<uint32_t> found, expected;
+        grid.queryBox(region, found);
+        for (uint32_t id = 0; id < count; ++id) {
+            if (grid.contains(id) && boxes[id].intersects(region)) {
+                expected.push_back(id);
+            }
+        }
+        std::sort(found.begin(), found.end());
+        assert(found == expected);
+    }
+    std::vector<uint32_t> found, expected;
+    grid.forEachWithin(Point3D(10, 20, 30), 40.0f, [&found](uint32_t id) { found.push_back(id); });
+    for (uint32_t id = 0; id < count; ++id) {
+        if (grid.contains(id) && within(boxes[id], Point3D(10, 20, 30), 40.0f)) {
+            expected.push_back(id);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    assert(!expected.empty() && found == expected);
+
+    Frustum3D frustum = Frustum3D::fromProjection(Point3D(0, 0, -300), 50.0f, 200.0f, 150.0f, 400.0f);
+    found.clear();
+    expected.clear();
+    grid.forEachInFrustum(frustum, [&found](uint32_t id) { found.push_back(id); });
+    for (uint32_t id = 0; id < count; ++id) {
+        if (grid.contains(id) && frustum.intersects(boxes[id])) {
+            expected.push_back(id);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    assert(!expected.empty() && expected.size() < grid.size() && found == expected);
+    std::cout << "check3 (box, distance and frustum queries match a brute-force scan)" << std::endl;
+
+    // Grands objets : rangés à part, ils n'élargissent pas la marge, et le retrait d'un objet la réduit
+    const Point3D smallMargin = grid.getMargin();
+    assert(grid.getOversizedCount() == 0 && smallMargin.getX() <= 8 && smallMargin.getY() <= 8 && smallMargin.getZ() <= 8);
+    boxes.push_back(BoundingBox3D(Point3D(-400, -1, -1), Point3D(400, 1, 1)));
+    grid.insert(count, boxes[count]);
+    boxes.push_back(BoundingBox3D(Point3D(80, 80, 80), Point3D(99, 99, 99)));
+    grid.insert(count + 1, boxes[count + 1]);
+    assert(grid.getOversizedCount() == 1 && grid.getMargin().getX() == 9.5f && grid.getMargin().getZ() == 9.5f);
+    for (const BoundingBox3D& region : regions) {
+        found.clear();
+        expected.clear();
+        grid.queryBox(region, found);
+        for (uint32_t id = 0; id < boxes.size(); ++id) {
+            if (grid.contains(id) && boxes[id].intersects(region)) {
+                expected.push_back(id);
+            }
+        }
+        std::sort(found.begin(), found.end());
+        assert(found == expected);
+    }
+    assert(std::count(found.begin(), found.end(), count) == 1);
+    found.clear();
+    grid.forEachInFrustum(frustum, [&found](uint32_t id) { found.push_back(id); });
+    assert(std::count(found.begin(), found.end(), count) == (frustum.intersects(boxes[count]) ? 1 : 0));
+    grid.remove(count + 1);
+    assert(grid.getMargin().getX() == smallMargin.getX() && grid.getMargin().getY() == smallMargin.getY() && grid.getMargin().getZ() == smallMargin.getZ());
+    // Un objet qui grandit passe dans la liste des grands objets, puis revient dans les cellules
+    boxes[count] = BoundingBox3D(Point3D(0, 0, 0), Point3D(1, 1, 1));
+    grid.update(count, boxes[count]);
+    assert(grid.getOversizedCount() == 0 && grid.contains(count));
+    boxes[0] = BoundingBox3D(Point3D(-50, -50, -50), Point3D(50, 50, 50));
+    grid.update(0, boxes[0]);
+    assert(grid.getOversizedCount() == 1);
+    found.clear();
+    grid.queryBox(BoundingBox3D(Point3D(45, 45, 45), Point3D(46, 46, 46)), found);
+    assert(std::count(found.begin(), found.end(), 0u) == 1);
+    grid.remove(count);
+    grid.remove(0);
+    assert(grid.getOversizedCount() == 0 && !grid.contains(0));
+    std::cout << "check4 (oversized objects stay out of the cells and the margin shrinks on remove)" << std::endl;
+
+    grid.clear();
+    assert(grid.size() == 0 && grid.getCellCount() == 0 && !grid.contains(0));
+    grid.insert(0, boxes[0]);
+    assert(grid.size() == 1);
+    std::cout << "check5 (clear)" << std::endl;
+}
+
+void testSceneIndex() {
+    Scene3D scene(Point3D(0, 0, -100), Point3D(0, 0, 0), 50.0f);
+    assert(scene.getSpatialIndexType() == SpatialIndexType::Linear);
+    uint32_t state = 777;
+    std::vector<CubeHandle> cubes;
+    std::vector<SphereHandle> spheres;
+    for (int i = 0; i < 300; ++i) {
+        Point3D position(randomFloat(state, -300, 300), randomFloat(state, -300, 300), randomFloat(state, 0, 600));
+        cubes.push_back(scene.addCube(Pave3D(position, 4, 4, 4, Couleur(0, 0, 255))));
+        spheres.push_back(scene.addSphere(Sphere3D(position + Point3D(0, 10, 0), randomFloat(state, 1, 6), 4)));
+    }
+    for (int i = 0; i < 300; i += 4) {
+        scene.removeCube(cubes[i]);
+        scene.removeSphere(spheres[i]);
+    }
+
+    const Frustum3D frustum = scene.getFrustum(800.0f, 600.0f, 500.0f);
+    const Point3D probe(20, -30, 200);
+    auto collect = [&](std::vector<CubeHandle>& visibleCubes, std::vector<SphereHandle>& visibleSpheres,
+                       std::vector<CubeHandle>& nearCubes, std::vector<SphereHandle>& nearSpheres) {
+        visibleCubes.clear();
+        visibleSpheres.clear();
+        nearCubes.clear();
+        nearSpheres.clear();
+        scene.forEachCubeInFrustum(frustum, [&](CubeHandle h) { visibleCubes.push_back(h); });
+        scene.forEachSphereInFrustum(frustum, [&](SphereHandle h) { visibleSpheres.push_back(h); });
+        scene.forEachCubeWithin(probe, 120.0f, [&](CubeHandle h) { nearCubes.push_back(h); });
+        scene.forEachSphereWithin(probe, 120.0f, [&](SphereHandle h) { nearSpheres.push_back(h); });
+    };
+
+    // Référence : index Linear
+    std::vector<CubeHandle> linearCubes, visibleCubes, linearNearCubes, nearCubes;
+    std::vector<SphereHandle> linearSpheres, visibleSpheres, linearNearSpheres, nearSpheres;
+    collect(linearCubes, linearSpheres, linearNearCubes, linearNearSpheres);
+    assert(!linearCubes.empty() && linearCubes.size() < scene.getCubes().size());
+    assert(!linearNearSpheres.empty() && linearNearSpheres.size() < scene.getSpheres().size());
+
+    for (SpatialIndexType type : {SpatialIndexType::Bvh, SpatialIndexType::HashGrid}) {
+        scene.setSpatialIndex(type, 20.0f);
+        assert(scene.getSpatialIndexType() == type);
+        collect(visibleCubes, visibleSpheres, nearCubes, nearSpheres);
+        assert(sameHandles(visibleCubes, linearCubes) && sameHandles(visibleSpheres, linearSpheres));
+        assert(sameHandles(nearCubes, linearNearCubes) && sameHandles(nearSpheres, linearNearSpheres));
+    }
+    std::cout << "check6 (bvh and hash grid agree with a linear scan)" << std::endl;
+
+    // Objets déplacés, ajoutés et retirés entre deux images
+    for (SpatialIndexType type : {SpatialIndexType::Linear, SpatialIndexType::Bvh, SpatialIndexType::HashGrid}) {
+        scene.setSpatialIndex(type, 20.0f);
+        for (Pave3D& cube : scene.getCubes()) {
+            cube.translate(Point3D(randomFloat(state, -30, 30), randomFloat(state, -30, 30), randomFloat(state, -30, 30)));
+        }
+        for (Sphere3D& sphere : scene.getSpheres()) {
+            sphere.setCenter(sphere.getCenter() + Point3D(randomFloat(state, -30, 30), 0, randomFloat(state, -30, 30)));
+        }
+        scene.removeCube(cubes[1]);
+        cubes[1] = scene.addCube(Pave3D(Point3D(0, 0, 100), 4, 4, 4, Couleur(0, 0, 255)));
+        scene.removeSphere(spheres[2]);
+        spheres[2] = scene.addSphere(Sphere3D(Point3D(10, -20, 180), 3.0f, 4));
+        scene.refreshSpatialIndex();
+
+        const SpatialIndexType current = scene.getSpatialIndexType();
+        scene.setSpatialIndex(SpatialIndexType::Linear);
+        collect(linearCubes, linearSpheres, linearNearCubes, linearNearSpheres);
+        scene.setSpatialIndex(current, 20.0f);
+        scene.refreshSpatialIndex();
+        collect(visibleCubes, visibleSpheres, nearCubes, nearSpheres);
+        assert(std::find(visibleCubes.begin(), visibleCubes.end(), cubes[1]) != visibleCubes.end());
+        assert(std::find(nearSpheres.begin(), nearSpheres.end(), spheres[2]) != nearSpheres.end());
+        assert(sameHandles(visibleCubes, linearCubes) && sameHandles(visibleSpheres, linearSpheres));
+        assert(sameHandles(nearCubes, linearNearCubes) && sameHandles(nearSpheres, linearNearSpheres));
+    }
+    std::cout << "check7 (moved, added and removed objects after refresh)" << std::endl;
+
+    scene.clear();
+    size_t visited = 0;
+    scene.forEachCubeInFrustum(frustum, [&visited](CubeHandle) { ++visited; });
+    scene.forEachSphereWithin(probe, 1000.0f, [&visited](SphereHandle) { ++visited; });
+    assert(visited == 0);
+    scene.addSphere(Sphere3D(probe, 2.0f, 4));
+    scene.forEachSphereWithin(probe, 1.0f, [&visited](SphereHandle) { ++visited; });
+    assert(visited == 1);
+    std::cout << "check8 (clear)" << std::endl;
+}
+
+int main() {
+    testHashGrid();
+    testSceneIndex();
+    std::cout << "All spatial index tests passed!" << std::endl;
+    return 0;
+}
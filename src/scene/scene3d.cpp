@@ -7,8 +7,7 @@
 #include <memory>
 
 Scene3D::Scene3D(const Point3D& eye, const Point3D& look_at, float projection_plane_distance)
-    : cube_(nullptr), sphere_(nullptr), hasCube_(false), hasSphere_(false),
-      eye_(eye), look_at_(look_at), projection_plane_distance_(projection_plane_distance) {
+    : eye_(eye), look_at_(look_at), projection_plane_distance_(projection_plane_distance), lod_pixel_error_(1.0f) {
     if (projection_plane_distance_ <= TOLERANCE) {
         throw std::invalid_argument("La distance du plan de projection doit être strictement positive.");
     }
@@ -20,32 +19,170 @@ Scene3D::Scene3D(const Point3D& eye, const Point3D& look_at, float projection_pl
 }
 
 bool Scene3D::isFaceVisible(const Quad3D& quad, const Point3D& eye) const {
-    Point3D normal = quad.getNormal();
+    const Point3D& normal = quad.getUnitNormal();
     Point3D toEye = eye - quad.getCentroid();
     return normal.dotProduct(toEye) > -TOLERANCE;
 }
 
-void Scene3D::addCube(const std::shared_ptr<Pave3D>& cube) {
-    cube_ = cube;
-    hasCube_ = true;
+CubeHandle Scene3D::addCube(const Pave3D& cube) {
+    CubeHandle handle = cubes_.insert(cube);
+    Pave3D& added = cubes_.get(handle);
 
     for (size_t i = 0; i < 6; ++i) {
-        cube_->setFaceColor(i, Couleur(255, 0, 0));
+        added.setFaceColor(i, Couleur(255, 0, 0));
     }
 
-    for (size_t i = 0; i < 6; ++i) {
-        cube_->getFace(i).orient(eye_);
+    added.orient(eye_);
+    cubeIndex_.inserted(cubes_, handle);
+    return handle;
+}
+
+SphereHandle Scene3D::addSphere(const Sphere3D& sphere) {
+    SphereHandle handle = spheres_.insert(sphere);
+    Sphere3D& added = spheres_.get(handle);
+
+    added.orient(eye_);
+    sphereIndex_.inserted(spheres_, handle);
+    return handle;
+}
+
+namespace {
+
+// Nœud attaché à une case d'objet, retiré du graphe avec son sous-arbre
+void detachNode(SceneGraph& graph, std::vector<NodeHandle>& nodes, uint32_t slot) {
+    if (slot < nodes.size()) {
+        if (graph.contains(nodes[slot])) {
+            graph.removeNode(nodes[slot]);
+        }
+        nodes[slot] = NodeHandle();
     }
 }
 
-void Scene3D::addSphere(const std::shared_ptr<Sphere3D>& sphere) {
-    sphere_ = sphere;
-    hasSphere_ = true;
-    std::cout << "Sphère définie avec rayon : " << sphere->getRadius() << "\n";
+template <typename T>
+NodeHandle attachNode(SceneGraph& graph, const SlotMap<T>& objects, std::vector<NodeHandle>& nodes, ObjectHandle<T> handle,
+                      NodeHandle parent) {
+    const T& object = objects.get(handle);
+    if (handle.index < nodes.size() && graph.contains(nodes[handle.index])) {
+        throw std::invalid_argument("Cet objet est déjà attaché à un nœud.");
+    }
+    // L'objet garde sa place dans le monde : sa transformation locale est relative au parent
+    ModelTransform local = object.getModelTransform();
+    if (parent.isValid()) {
+        local = graph.computeWorld(parent).inverse() * local;
+    }
+    NodeHandle node = graph.createNode(local, parent);
+    if (handle.index >= nodes.size()) {
+        nodes.resize(static_cast<size_t>(handle.index) + 1);
+    }
+    nodes[handle.index] = node;
+    return node;
+}
 
-    for (auto& quad : sphere_->getQuads()) {
-        quad.orient(eye_);
+// Les objets dont le nœud a été recalculé prennent sa transformation monde
+template <typename T>
+void syncAttached(const SceneGraph& graph, SlotMap<T>& objects, const std::vector<NodeHandle>& nodes) {
+    if (nodes.empty() || graph.getUpdatedCount() == 0) {
+        return;
     }
+    for (size_t i = 0; i < objects.size(); ++i) {
+        const uint32_t slot = objects.handleAt(i).index;
+        if (slot < nodes.size() && graph.contains(nodes[slot]) && graph.worldChanged(nodes[slot])) {
+            objects.begin()[i].setModelTransform(graph.getWorld(nodes[slot]));
+        }
+    }
+}
+
+} // namespace
+
+void Scene3D::removeCube(CubeHandle handle) {
+    cubes_.remove(handle);
+    cubeIndex_.removed(handle);
+    detachNode(graph_, cubeNodes_, handle.index);
+}
+
+void Scene3D::removeSphere(SphereHandle handle) {
+    spheres_.remove(handle);
+    sphereIndex_.removed(handle);
+    detachNode(graph_, sphereNodes_, handle.index);
+}
+
+NodeHandle Scene3D::attachCube(CubeHandle handle, NodeHandle parent) {
+    return attachNode(graph_, cubes_, cubeNodes_, handle, parent);
+}
+
+NodeHandle Scene3D::attachSphere(SphereHandle handle, NodeHandle parent) {
+    return attachNode(graph_, spheres_, sphereNodes_, handle, parent);
+}
+
+NodeHandle Scene3D::getCubeNode(CubeHandle handle) const {
+    cubes_.get(handle); // Vérifie l'identifiant
+    return handle.index < cubeNodes_.size() ? cubeNodes_[handle.index] : NodeHandle();
+}
+
+NodeHandle Scene3D::getSphereNode(SphereHandle handle) const {
+    spheres_.get(handle); // Vérifie l'identifiant
+    return handle.index < sphereNodes_.size() ? sphereNodes_[handle.index] : NodeHandle();
+}
+
+void Scene3D::updateTransforms() {
+    graph_.update();
+    syncAttached(graph_, cubes_, cubeNodes_);
+    syncAttached(graph_, spheres_, sphereNodes_);
+}
+
+void Scene3D::setSpatialIndex(SpatialIndexType type, float cellSize) {
+    cubeIndex_.reset(cubes_, type, cellSize);
+    sphereIndex_.reset(spheres_, type, cellSize);
+}
+
+void Scene3D::refreshSpatialIndex() {
+    cubeIndex_.refresh(cubes_);
+    sphereIndex_.refresh(spheres_);
+}
+
+void Scene3D::buildOcclusion(OcclusionBuffer3D& buffer, float screenWidth, float screenHeight, size_t maxOccluders,
+                             const Point2D& translation, float translationZ) {
+    // Même espace que le rendu : points décalés de translationZ, c'est-à-dire œil reculé d'autant
+    const Point3D eye = eye_ - Point3D(0, 0, translationZ);
+    buffer.begin(eye, projection_plane_distance_, screenWidth, screenHeight, translation);
+
+    // Taille apparente : diagonale de la boîte sur sa profondeur w = d + dz (pavés devant l'œil seulement)
+    occluderCandidates_.clear();
+    for (size_t i = 0; i < cubes_.size(); ++i) {
+        const BoundingBox3D box = cubes_.objects()[i].boundingBox();
+        const float depth = box.center().getZ() - eye.getZ();
+        if (depth > 0) {
+            const float diagonal = box.getMax().distance(box.getMin());
+            occluderCandidates_.emplace_back(diagonal / (projection_plane_distance_ + depth), static_cast<uint32_t>(i));
+        }
+    }
+    const size_t count = std::min(maxOccluders, occluderCandidates_.size());
+    std::partial_sort(occluderCandidates_.begin(), occluderCandidates_.begin() + count, occluderCandidates_.end(),
+                      [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = 0; i < count; ++i) {
+        buffer.addOccluder(cubes_.objects()[occluderCandidates_[i].second]);
+    }
+}
+
+void Scene3D::getCubeBounds(std::vector<BoundingBox3D>& out) const {
+    out.clear();
+    for (const Pave3D& cube : cubes_) {
+        out.push_back(cube.boundingBox());
+    }
+}
+
+void Scene3D::getSphereBounds(std::vector<BoundingBox3D>& out) const {
+    out.clear();
+    for (const Sphere3D& sphere : spheres_) {
+        out.push_back(sphere.boundingBox());
+    }
+}
+
+void Scene3D::addInstancedMesh(const std::shared_ptr<InstancedMesh3D>& instances) {
+    if (!instances) {
+        throw std::invalid_argument("L'ensemble d'instances ne peut pas être nul.");
+    }
+    instancedMeshes_.push_back(instances);
 }
 
 void Scene3D::setEye(const Point3D& eye) {
@@ -55,15 +192,11 @@ void Scene3D::setEye(const Point3D& eye) {
     eye_ = eye;
     std::cout << "Position de l'œil mise à jour : " << eye_ << "\n";
 
-    if (hasCube_) {
-        for (size_t i = 0; i < 6; ++i) {
-            cube_->getFace(i).orient(eye_);
-        }
+    for (Pave3D& cube : cubes_) {
+        cube.orient(eye_);
     }
-    if (hasSphere_) {
-        for (auto& quad : sphere_->getQuads()) {
-            quad.orient(eye_);
-        }
+    for (Sphere3D& sphere : spheres_) {
+        sphere.orient(eye_);
     }
 }
 
@@ -80,39 +213,27 @@ void Scene3D::setProjectionPlaneDistance(float distance) {
     std::cout << "Distance du plan de projection mise à jour : " << projection_plane_distance_ << "\n";
 }
 
-void Scene3D::clear() {
-    cube_ = nullptr;
-    sphere_ = nullptr;
-    hasCube_ = false;
-    hasSphere_ = false;
-    std::cout << "Scène vidée.\n";
-}
-
-Pave3D& Scene3D::getCube() const {
-    if (!hasCube_) {
-        throw std::logic_error("Aucun cube n'est défini dans la scène.");
+void Scene3D::setLodPixelError(float pixels) {
+    if (pixels <= 0) {
+        throw std::invalid_argument("L'erreur maximale à l'écran doit être strictement positive.");
     }
-    return *cube_;
+    lod_pixel_error_ = pixels;
 }
 
-Sphere3D& Scene3D::getSphere() const {
-    if (!hasSphere_) {
-        throw std::logic_error("Aucune sphère n'est définie dans la scène.");
-    }
-    return *sphere_;
+void Scene3D::clear() {
+    cubes_.clear();
+    spheres_.clear();
+    cubeIndex_.cleared();
+    sphereIndex_.cleared();
+    graph_.clear();
+    cubeNodes_.clear();
+    sphereNodes_.clear();
+    instancedMeshes_.clear();
+    std::cout << "Scène vidée.\n";
 }
 
 std::vector<Quad3D> Scene3D::getVisibleFaces() const {
-    if (!hasCube_) {
-        throw std::logic_error("Aucun cube n'est défini dans la scène.");
-    }
-
     std::vector<Quad3D> visibleFaces;
-    for (size_t i = 0; i < 6; ++i) {
-        const Quad3D& face = cube_->getFace(i);
-        if (isFaceVisible(face, eye_)) {
-            visibleFaces.push_back(face);
-        }
-    }
+    forEachVisibleFace([&visibleFaces](const Quad3D& face) { visibleFaces.push_back(face); });
     return visibleFaces;
 }
\ No newline at end of file
@@ -3,27 +3,57 @@
 
 #include "../geometry/pave3d.h"
 #include "../geometry/sphere3d.h"
+#include "../geometry/instanced_mesh3d.h"
 #include "../geometry/triangle2d.h"
 #include "../geometry/triangle3d.h"
 #include "../geometry/point3d.h"
 #include "../geometry/point2d.h"
 #include "../geometry/geometry_utils.h"
+#include "slot_map.h"
+#include "spatial_index.h"
+#include "scene_graph.h"
+#include "../geometry/frustum3d.h"
+#include "../geometry/occlusion_buffer3d.h"
 #include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Identifiants des objets d'une scène.
+ */
+using CubeHandle = ObjectHandle<Pave3D>;
+using SphereHandle = ObjectHandle<Sphere3D>;
+
+/**
+ * @brief Nombre par défaut de pavés rastérisés comme occulteurs à chaque image.
+ */
+constexpr size_t DEFAULT_OCCLUDER_COUNT = 8;
 
 /**
  * @class Scene3D
  * @brief Classe pour représenter une scène en 3D.
+ *
+ * Les pavés et les sphères sont stockés par valeur dans un tableau contigu par type et désignés
+ * par des identifiants générationnels : ajout, accès et suppression en O(1), parcours linéaire.
+ * Les références obtenues par getCube et getSphere sont invalidées par tout ajout ou suppression
+ * d'un objet du même type ; les identifiants, eux, restent valables.
  */
 class Scene3D {
 private:
-    std::shared_ptr<Pave3D> cube_;;
-    std::shared_ptr<Sphere3D> sphere_;
-    bool hasCube_;                      // Indique si un cube est défini.
-    bool hasSphere_;                    // Indique si une sphère est définie.
+    SlotMap<Pave3D> cubes_;             // Pavés de la scène, contigus.
+    SlotMap<Sphere3D> spheres_;         // Sphères de la scène, contiguës.
+    SpatialIndex<Pave3D> cubeIndex_;     // Index spatial des pavés.
+    SpatialIndex<Sphere3D> sphereIndex_; // Index spatial des sphères.
+    SceneGraph graph_;                   // Hiérarchie de transformations.
+    std::vector<NodeHandle> cubeNodes_;   // Nœud de chaque pavé attaché, par case de cubes_.
+    std::vector<NodeHandle> sphereNodes_; // Nœud de chaque sphère attachée, par case de spheres_.
+    std::vector<std::pair<float, uint32_t>> occluderCandidates_; // Taille apparente et position des pavés, réutilisé.
+    std::vector<std::shared_ptr<InstancedMesh3D>> instancedMeshes_; // Maillages partagés et leurs instances.
 
     Point3D eye_;                       // Position de l'œil dans l'espace 3D.
     Point3D look_at_;                   // Direction de visée (point cible).
     float projection_plane_distance_;   // Distance du plan de projection à l'œil.
+    float lod_pixel_error_;             // Erreur maximale tolérée à l'écran (en pixels) pour le choix du niveau de détail.
 
 public:
     /**
@@ -35,42 +65,253 @@ public:
     Scene3D(const Point3D& eye, const Point3D& look_at, float projection_plane_distance);
     
     /**
-     * @brief Définit un cube unique dans la scène.
-     * @param cube Le cube à ajouter.
+     * @brief Ajoute un pavé à la scène ; ses faces sont colorées en rouge et orientées vers l'œil.
+     * @param cube Le pavé à ajouter (copié dans la scène).
+     * @return L'identifiant du pavé.
      */
-    void addCube(const std::shared_ptr<Pave3D>& cube);
+    CubeHandle addCube(const Pave3D& cube);
 
     /**
-     * @brief Définit une sphère unique dans la scène.
-     * @param sphere La sphère à ajouter.
+     * @brief Ajoute une sphère à la scène ; ses faces sont orientées vers l'œil.
+     * @param sphere La sphère à ajouter (copiée dans la scène, le maillage reste partagé).
+     * @return L'identifiant de la sphère.
      */
-    void addSphere(const std::shared_ptr<Sphere3D>& sphere);
+    SphereHandle addSphere(const Sphere3D& sphere);
 
     /**
-     * @brief Récupère le cube de la scène.
-     * @return Une référence constante vers le cube.
-     * @throw std::logic_error Si aucun cube n'est défini.
+     * @brief Retire un pavé de la scène, ainsi que son nœud et le sous-arbre de ce nœud.
+     * @param handle L'identifiant du pavé.
+     * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
      */
-    Pave3D& getCube() const;
+    void removeCube(CubeHandle handle);
 
     /**
-     * @brief Récupère la sphère de la scène.
-     * @return Une référence constante vers la sphère.
-     * @throw std::logic_error Si aucune sphère n'est définie.
+     * @brief Retire une sphère de la scène, ainsi que son nœud et le sous-arbre de ce nœud.
+     * @param handle L'identifiant de la sphère.
+     * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
      */
-    Sphere3D& getSphere() const;
-    
+    void removeSphere(SphereHandle handle);
+
+    /**
+     * @brief Attache un pavé à un nouveau nœud du graphe de scène.
+     *
+     * Le pavé garde sa place dans le monde : la transformation locale du nœud est sa transformation
+     * de modèle exprimée dans le repère du parent. Le pavé suit ensuite son nœud (voir updateTransforms) :
+     * il se déplace par le graphe plutôt que par sa propre transformation.
+     *
+     * @param handle L'identifiant du pavé.
+     * @param parent Le nœud parent, ou un identifiant non attribué pour une racine.
+     * @return Le nœud du pavé.
+     * @throw std::out_of_range Si l'identifiant du pavé ou du parent est invalide ou périmé.
+     * @throw std::invalid_argument Si le pavé est déjà attaché.
+     */
+    NodeHandle attachCube(CubeHandle handle, NodeHandle parent = NodeHandle());
+
+    /**
+     * @brief Attache une sphère à un nouveau nœud du graphe de scène (voir attachCube).
+     * @param handle L'identifiant de la sphère.
+     * @param parent Le nœud parent, ou un identifiant non attribué pour une racine.
+     * @return Le nœud de la sphère.
+     * @throw std::out_of_range Si l'identifiant de la sphère ou du parent est invalide ou périmé.
+     * @throw std::invalid_argument Si la sphère est déjà attachée.
+     */
+    NodeHandle attachSphere(SphereHandle handle, NodeHandle parent = NodeHandle());
+
+    /**
+     * @brief Retourne le nœud d'un pavé (identifiant non attribué ou périmé s'il n'est pas attaché).
+     * @throw std::out_of_range Si l'identifiant du pavé est invalide ou périmé.
+     */
+    NodeHandle getCubeNode(CubeHandle handle) const;
+
+    /**
+     * @brief Retourne le nœud d'une sphère (identifiant non attribué ou périmé si elle n'est pas attachée).
+     * @throw std::out_of_range Si l'identifiant de la sphère est invalide ou périmé.
+     */
+    NodeHandle getSphereNode(SphereHandle handle) const;
+
+    /**
+     * @brief Accède au graphe de scène, pour créer des nœuds de groupement et les déplacer.
+     */
+    SceneGraph& getGraph() { return graph_; }
+    const SceneGraph& getGraph() const { return graph_; }
+
+    /**
+     * @brief Met à jour le graphe de scène et la transformation de modèle des objets attachés (une fois par image).
+     *
+     * Seuls les objets dont le nœud a été recalculé reçoivent une nouvelle transformation ; leur
+     * géométrie n'est pas réécrite. L'index spatial doit ensuite être rafraîchi (refreshSpatialIndex).
+     */
+    void updateTransforms();
+
+    /**
+     * @brief Ajoute un ensemble d'instances d'un maillage partagé.
+     * @param instances L'ensemble d'instances à ajouter.
+     * @throw std::invalid_argument Si le pointeur est nul.
+     */
+    void addInstancedMesh(const std::shared_ptr<InstancedMesh3D>& instances);
+
+    /**
+     * @brief Retourne les ensembles d'instances de la scène.
+     */
+    const std::vector<std::shared_ptr<InstancedMesh3D>>& getInstancedMeshes() const { return instancedMeshes_; }
+
+    /**
+     * @brief Récupère un pavé de la scène.
+     * @param handle L'identifiant du pavé.
+     * @return Une référence vers le pavé.
+     * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+     */
+    Pave3D& getCube(CubeHandle handle) { return cubes_.get(handle); }
+    const Pave3D& getCube(CubeHandle handle) const { return cubes_.get(handle); }
+
+    /**
+     * @brief Récupère une sphère de la scène.
+     * @param handle L'identifiant de la sphère.
+     * @return Une référence vers la sphère.
+     * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+     */
+    Sphere3D& getSphere(SphereHandle handle) { return spheres_.get(handle); }
+    const Sphere3D& getSphere(SphereHandle handle) const { return spheres_.get(handle); }
+
+    /**
+     * @brief Vérifie si un identifiant désigne un pavé présent dans la scène.
+     */
+    bool contains(CubeHandle handle) const { return cubes_.contains(handle); }
+
+    /**
+     * @brief Vérifie si un identifiant désigne une sphère présente dans la scène.
+     */
+    bool contains(SphereHandle handle) const { return spheres_.contains(handle); }
+
+    /**
+     * @brief Retourne les pavés de la scène, à parcourir linéairement.
+     */
+    SlotMap<Pave3D>& getCubes() { return cubes_; }
+    const SlotMap<Pave3D>& getCubes() const { return cubes_; }
+
+    /**
+     * @brief Retourne les sphères de la scène, à parcourir linéairement.
+     */
+    SlotMap<Sphere3D>& getSpheres() { return spheres_; }
+    const SlotMap<Sphere3D>& getSpheres() const { return spheres_; }
+
+    /**
+     * @brief Remplit out avec la boîte englobante de chaque pavé, dans l'ordre de getCubes().
+     *
+     * Destiné à Bvh3D::build et Bvh3D::refit : l'objet i de la hiérarchie est getCubes().handleAt(i).
+     *
+     * @param out Le tableau à remplir (vidé au préalable, sa capacité est réutilisée).
+     */
+    void getCubeBounds(std::vector<BoundingBox3D>& out) const;
+
+    /**
+     * @brief Remplit out avec la boîte englobante de chaque sphère, dans l'ordre de getSpheres().
+     * @param out Le tableau à remplir (vidé au préalable, sa capacité est réutilisée).
+     */
+    void getSphereBounds(std::vector<BoundingBox3D>& out) const;
+
+    /**
+     * @brief Choisit l'index spatial des pavés et des sphères, et l'initialise avec les objets existants.
+     *
+     * Linear convient aux petites scènes, Bvh aux scènes dont peu d'objets bougent, HashGrid aux
+     * scènes dont la plupart des objets bougent à chaque image.
+     *
+     * @param type Le type d'index.
+     * @param cellSize Le côté des cellules de la grille (SpatialIndexType::HashGrid).
+     * @throw std::invalid_argument Si le côté n'est pas strictement positif.
+     */
+    void setSpatialIndex(SpatialIndexType type, float cellSize = DEFAULT_HASH_GRID_CELL_SIZE);
+
+    /**
+     * @brief Retourne le type d'index spatial de la scène.
+     */
+    SpatialIndexType getSpatialIndexType() const { return sphereIndex_.getType(); }
+
     /**
-     * @brief Vérifie si un cube est défini dans la scène.
-     * @return true si un cube est défini, false sinon.
+     * @brief Met à jour l'index spatial après le déplacement des objets (une fois par image).
      */
-    bool hasCube() const { return hasCube_; }
+    void refreshSpatialIndex();
 
     /**
-     * @brief Vérifie si une sphère est définie dans la scène.
-     * @return true si une sphère est définie, false sinon.
+     * @brief Construit le volume de vision de la caméra de la scène.
+     * @param width La largeur de l'écran, en pixels.
+     * @param height La hauteur de l'écran, en pixels.
+     * @param farDistance La profondeur maximale visible devant l'œil.
+     * @return Le volume de vision (voir Frustum3D::fromProjection).
      */
-    bool hasSphere() const { return hasSphere_; }
+    Frustum3D getFrustum(float width, float height, float farDistance) const {
+        return Frustum3D::fromProjection(eye_, projection_plane_distance_, width, height, farDistance);
+    }
+
+    /**
+     * @brief Prépare le tampon d'occlusion de l'image : les pavés les plus grands à l'écran y sont rastérisés.
+     *
+     * La taille apparente d'un pavé est estimée par la diagonale de sa boîte divisée par sa profondeur.
+     * Les objets peuvent ensuite être testés avec buffer.isOccluded(objet.boundingBox()) avant d'être
+     * rendus ; un pavé ne se masque jamais lui-même.
+     *
+     * @param buffer Le tampon d'occlusion (vidé, puis rempli).
+     * @param screenWidth La largeur de l'écran, en pixels.
+     * @param screenHeight La hauteur de l'écran, en pixels.
+     * @param maxOccluders Le nombre maximal de pavés rastérisés.
+     * @param translation La translation en 2D appliquée au rendu (le tampon couvre l'écran dessiné).
+     * @param translationZ La translation en profondeur appliquée au rendu, qui équivaut à reculer l'œil d'autant.
+     * @throw std::invalid_argument Si une dimension de l'écran n'est pas strictement positive.
+     */
+    void buildOcclusion(OcclusionBuffer3D& buffer, float screenWidth, float screenHeight, size_t maxOccluders = DEFAULT_OCCLUDER_COUNT,
+                        const Point2D& translation = Point2D(0, 0), float translationZ = 0.0f);
+
+    /**
+     * @brief Appelle un visiteur pour chaque pavé dont la boîte touche le volume de vision.
+     * @param frustum Le volume de vision.
+     * @param visit Le visiteur, appelé avec l'identifiant de chaque pavé (CubeHandle).
+     */
+    template <typename Visitor>
+    void forEachCubeInFrustum(const Frustum3D& frustum, Visitor&& visit) const {
+        cubeIndex_.forEachInFrustum(cubes_, frustum, visit);
+    }
+
+    /**
+     * @brief Appelle un visiteur pour chaque sphère dont la boîte touche le volume de vision.
+     * @param frustum Le volume de vision.
+     * @param visit Le visiteur, appelé avec l'identifiant de chaque sphère (SphereHandle).
+     */
+    template <typename Visitor>
+    void forEachSphereInFrustum(const Frustum3D& frustum, Visitor&& visit) const {
+        sphereIndex_.forEachInFrustum(spheres_, frustum, visit);
+    }
+
+    /**
+     * @brief Appelle un visiteur pour chaque pavé dont la boîte est à moins d'une distance d'un point.
+     * @param point Le point.
+     * @param radius La distance maximale.
+     * @param visit Le visiteur, appelé avec l'identifiant de chaque pavé (CubeHandle).
+     */
+    template <typename Visitor>
+    void forEachCubeWithin(const Point3D& point, float radius, Visitor&& visit) const {
+        cubeIndex_.forEachWithin(cubes_, point, radius, visit);
+    }
+
+    /**
+     * @brief Appelle un visiteur pour chaque sphère dont la boîte est à moins d'une distance d'un point.
+     * @param point Le point.
+     * @param radius La distance maximale.
+     * @param visit Le visiteur, appelé avec l'identifiant de chaque sphère (SphereHandle).
+     */
+    template <typename Visitor>
+    void forEachSphereWithin(const Point3D& point, float radius, Visitor&& visit) const {
+        sphereIndex_.forEachWithin(spheres_, point, radius, visit);
+    }
+
+    /**
+     * @brief Vérifie si la scène contient au moins un pavé.
+     */
+    bool hasCube() const { return !cubes_.empty(); }
+
+    /**
+     * @brief Vérifie si la scène contient au moins une sphère.
+     */
+    bool hasSphere() const { return !spheres_.empty(); }
 
     /**
      * @brief Met à jour la position de l'œil.
@@ -107,17 +348,44 @@ public:
      */
     float getProjectionPlaneDistance() const { return projection_plane_distance_; }
 
+    /**
+     * @brief Définit l'erreur maximale tolérée à l'écran pour le choix des niveaux de détail.
+     * @param pixels L'erreur maximale en pixels.
+     * @throw std::invalid_argument Si l'erreur n'est pas strictement positive.
+     */
+    void setLodPixelError(float pixels);
+
+    /**
+     * @brief Retourne l'erreur maximale tolérée à l'écran pour le choix des niveaux de détail.
+     */
+    float getLodPixelError() const { return lod_pixel_error_; }
+
     /**
      * @brief Vide tous les objets de la scène.
      */
     void clear();
 
     /**
-     * @brief Récupère les faces visibles du cube.
+     * @brief Récupère les faces visibles des pavés.
      * @return Un vecteur contenant les faces visibles.
      */
     std::vector<Quad3D> getVisibleFaces() const;
 
+    /**
+     * @brief Appelle un visiteur pour chaque face visible des pavés, sans copie ni allocation.
+     * @param visit Le visiteur, appelé avec chaque face visible (const Quad3D&).
+     */
+    template <typename Visitor>
+    void forEachVisibleFace(Visitor&& visit) const {
+        for (const Pave3D& cube : cubes_) {
+            for (const Quad3D& face : cube.getFaces()) {
+                if (isFaceVisible(face, eye_)) {
+                    visit(face);
+                }
+            }
+        }
+    }
+
     /**
      * @brief Determines if a face is visible from the eye's perspective.
      * @param quad The face to check.
@@ -0,0 +1,162 @@
+#include "scene_graph.h"
+#include <algorithm>
+#include <stdexcept>
+
+uint32_t SceneGraph::positionOf(NodeHandle node) const {
+    if (!contains(node)) {
+        throw std::out_of_range("Identifiant de nœud invalide ou périmé.");
+    }
+    return slots[node.index].position;
+}
+
+bool SceneGraph::contains(NodeHandle node) const {
+    return node.index < slots.size() && slots[node.index].generation == node.generation &&
+           slots[node.index].position < positionToSlot.size() && positionToSlot[slots[node.index].position] == node.index;
+}
+
+void SceneGraph::reindexFrom(uint32_t position) {
+    for (uint32_t i = position; i < positionToSlot.size(); ++i) {
+        slots[positionToSlot[i]].position = i;
+    }
+}
+
+// Le nœud est inséré à la fin du sous-arbre de son parent : l'ordre en profondeur d'abord est conservé.
+// Pour une racine, ou pour le dernier sous-arbre du tableau, l'insertion est un simple ajout en fin.
+NodeHandle SceneGraph::createNode(const ModelTransform& local, NodeHandle parent) {
+    uint32_t parentPosition = NO_PARENT;
+    uint32_t position = static_cast<uint32_t>(size());
+    if (parent.isValid()) {
+        parentPosition = positionOf(parent);
+        position = parentPosition + subtreeSizes[parentPosition];
+    }
+
+    uint32_t slot = freeSlot;
+    if (slot != NO_SLOT) {
+        freeSlot = slots[slot].position;
+    } else {
+        slot = static_cast<uint32_t>(slots.size());
+        slots.push_back(Slot{0, 0});
+    }
+
+    // Les parents rangés après le point d'insertion sont décalés d'une position
+    for (uint32_t i = position; i < parents.size(); ++i) {
+        if (parents[i] != NO_PARENT && parents[i] >= position) {
+            ++parents[i];
+        }
+    }
+    for (uint32_t ancestor = parentPosition; ancestor != NO_PARENT; ancestor = parents[ancestor]) {
+        ++subtreeSizes[ancestor];
+    }
+
+    locals.insert(locals.begin() + position, local);
+    worlds.insert(worlds.begin() + position, local);
+    parents.insert(parents.begin() + position, parentPosition);
+    subtreeSizes.insert(subtreeSizes.begin() + position, 1);
+    dirty.insert(dirty.begin() + position, 1);
+    changed.insert(changed.begin() + position, 0);
+    positionToSlot.insert(positionToSlot.begin() + position, slot);
+    reindexFrom(position);
+
+    anyDirty = true;
+    return NodeHandle{slot, slots[slot].generation};
+}
+
+// Le sous-arbre occupe les positions [first, first + count) : il est retiré d'un bloc
+void SceneGraph::removeNode(NodeHandle node) {
+    const uint32_t first = positionOf(node);
+    const uint32_t count = subtreeSizes[first];
+    const uint32_t end = first + count;
+
+    for (uint32_t ancestor = parents[first]; ancestor != NO_PARENT; ancestor = parents[ancestor]) {
+        subtreeSizes[ancestor] -= count;
+    }
+    for (uint32_t i = first; i < end; ++i) {
+        Slot& slot = slots[positionToSlot[i]];
+        ++slot.generation;
+        slot.position = freeSlot;
+        freeSlot = positionToSlot[i];
+    }
+    for (uint32_t i = end; i < parents.size(); ++i) {
+        if (parents[i] != NO_PARENT && parents[i] >= end) {
+            parents[i] -= count;
+        }
+    }
+
+    locals.erase(locals.begin() + first, locals.begin() + end);
+    worlds.erase(worlds.begin() + first, worlds.begin() + end);
+    parents.erase(parents.begin() + first, parents.begin() + end);
+    subtreeSizes.erase(subtreeSizes.begin() + first, subtreeSizes.begin() + end);
+    dirty.erase(dirty.begin() + first, dirty.begin() + end);
+    changed.erase(changed.begin() + first, changed.begin() + end);
+    positionToSlot.erase(positionToSlot.begin() + first, positionToSlot.begin() + end);
+    reindexFrom(first);
+}
+
+void SceneGraph::clear() {
+    for (uint32_t slot : positionToSlot) {
+        ++slots[slot].generation;
+        slots[slot].position = freeSlot;
+        freeSlot = slot;
+    }
+    locals.clear();
+    worlds.clear();
+    parents.clear();
+    subtreeSizes.clear();
+    dirty.clear();
+    changed.clear();
+    positionToSlot.clear();
+    anyDirty = false;
+    updatedCount = 0;
+}
+
+void SceneGraph::setLocal(NodeHandle node, const ModelTransform& local) {
+    const uint32_t position = positionOf(node);
+    locals[position] = local;
+    dirty[position] = 1;
+    anyDirty = true;
+}
+
+void SceneGraph::translate(NodeHandle node, const Point3D& offset) {
+    const uint32_t position = positionOf(node);
+    locals[position].translate(offset);
+    dirty[position] = 1;
+    anyDirty = true;
+}
+
+ModelTransform SceneGraph::computeWorld(NodeHandle node) const {
+    uint32_t position = positionOf(node);
+    ModelTransform world = locals[position];
+    for (position = parents[position]; position != NO_PARENT; position = parents[position]) {
+        world = locals[position] * world;
+    }
+    return world;
+}
+
+NodeHandle SceneGraph::getParent(NodeHandle node) const {
+    const uint32_t parent = parents[positionOf(node)];
+    return parent == NO_PARENT ? NodeHandle() : handleAt(parent);
+}
+
+// Un nœud est recalculé s'il est marqué ou si son parent vient de l'être
+void SceneGraph::update() {
+    if (!anyDirty) {
+        if (updatedCount != 0) {
+            std::fill(changed.begin(), changed.end(), 0);
+            updatedCount = 0;
+        }
+        return;
+    }
+
+    updatedCount = 0;
+    for (size_t i = 0; i < locals.size(); ++i) {
+        const uint32_t parent = parents[i];
+        const bool recompute = dirty[i] || (parent != NO_PARENT && changed[parent]);
+        changed[i] = recompute;
+        dirty[i] = 0;
+        if (recompute) {
+            worlds[i] = parent == NO_PARENT ? locals[i] : worlds[parent] * locals[i];
+            ++updatedCount;
+        }
+    }
+    anyDirty = false;
+}
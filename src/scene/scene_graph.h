@@ -0,0 +1,171 @@
+/**
+ * @file scene_graph.h
+ * @brief Déclaration de la classe SceneGraph : hiérarchie de transformations avec indicateurs de modification.
+ *
+ * Chaque nœud porte une transformation locale, relative à son parent, et une transformation monde
+ * (parent * local). Les nœuds sont rangés en profondeur d'abord dans des tableaux contigus : un parent
+ * précède toujours ses descendants, qui le suivent de façon contiguë. La mise à jour est donc un seul
+ * parcours linéaire, qui ne recalcule que les nœuds modifiés et leurs descendants.
+ */
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include "slot_map.h"
+#include "../geometry/model_transform.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SceneGraph;
+
+/**
+ * @brief Identifiant d'un nœud du graphe de scène.
+ */
+using NodeHandle = ObjectHandle<SceneGraph>;
+
+/**
+ * @class SceneGraph
+ * @brief Nœuds de transformation parent/enfant, rangés en profondeur d'abord.
+ *
+ * Modifier la transformation locale d'un nœud ne fait que le marquer ; update recalcule ensuite,
+ * en un parcours, la transformation monde des nœuds marqués et de leurs descendants (une composition
+ * par nœud). Ajouter un nœud ou retirer un sous-arbre décale les nœuds suivants (O(n)) ; les
+ * identifiants restent valables, comme dans une SlotMap.
+ */
+class SceneGraph {
+    private:
+        static constexpr uint32_t NO_PARENT = UINT32_MAX;
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+        struct Slot {
+            uint32_t position;   // Position du nœud dans les tableaux, ou case libre suivante
+            uint32_t generation; // Incrémentée à chaque suppression
+        };
+
+        // Nœuds en profondeur d'abord, un tableau par attribut
+        std::vector<ModelTransform> locals;      // Transformation relative au parent.
+        std::vector<ModelTransform> worlds;      // Transformation monde, valable après update.
+        std::vector<uint32_t> parents;           // Position du parent, ou NO_PARENT pour une racine.
+        std::vector<uint32_t> subtreeSizes;      // Nombre de nœuds du sous-arbre, nœud compris.
+        std::vector<uint8_t> dirty;              // Transformation locale modifiée depuis update.
+        std::vector<uint8_t> changed;            // Transformation monde recalculée par le dernier update.
+        std::vector<uint32_t> positionToSlot;    // Case de chaque nœud.
+
+        std::vector<Slot> slots;                 // Table d'indirection des identifiants.
+        uint32_t freeSlot = NO_SLOT;             // Tête de la liste des cases libres.
+        bool anyDirty = false;                   // Au moins un nœud marqué.
+        size_t updatedCount = 0;                 // Nœuds recalculés par le dernier update.
+
+        // Position du nœud désigné, ou exception si l'identifiant est invalide ou périmé
+        uint32_t positionOf(NodeHandle node) const;
+
+        // Met à jour la case des nœuds à partir d'une position, après un décalage
+        void reindexFrom(uint32_t position);
+
+    public:
+        /**
+         * @brief Ajoute un nœud, en dernier enfant de son parent.
+         * @param local La transformation du nœud, relative à son parent.
+         * @param parent Le parent, ou un identifiant non attribué pour une racine.
+         * @return L'identifiant du nœud.
+         * @throw std::out_of_range Si le parent est périmé.
+         */
+        NodeHandle createNode(const ModelTransform& local = ModelTransform(), NodeHandle parent = NodeHandle());
+
+        /**
+         * @brief Retire un nœud et tout son sous-arbre.
+         * @param node Le nœud.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        void removeNode(NodeHandle node);
+
+        /**
+         * @brief Vérifie si un identifiant désigne un nœud présent.
+         */
+        bool contains(NodeHandle node) const;
+
+        /**
+         * @brief Retire tous les nœuds ; tous les identifiants existants deviennent périmés.
+         */
+        void clear();
+
+        /**
+         * @brief Accède à la transformation locale d'un nœud.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        const ModelTransform& getLocal(NodeHandle node) const { return locals[positionOf(node)]; }
+
+        /**
+         * @brief Modifie la transformation locale d'un nœud et le marque (O(1)).
+         * @param node Le nœud.
+         * @param local La nouvelle transformation, relative au parent.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        void setLocal(NodeHandle node, const ModelTransform& local);
+
+        /**
+         * @brief Translate un nœud dans le repère de son parent et le marque (O(1)).
+         * @param node Le nœud.
+         * @param offset Le vecteur de translation.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        void translate(NodeHandle node, const Point3D& offset);
+
+        /**
+         * @brief Accède à la transformation monde d'un nœud, telle que calculée par le dernier update.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        const ModelTransform& getWorld(NodeHandle node) const { return worlds[positionOf(node)]; }
+
+        /**
+         * @brief Calcule la transformation monde d'un nœud à partir des transformations locales de ses
+         * ancêtres, sans attendre update (O(profondeur)).
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        ModelTransform computeWorld(NodeHandle node) const;
+
+        /**
+         * @brief Retourne le parent d'un nœud (identifiant non attribué pour une racine).
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        NodeHandle getParent(NodeHandle node) const;
+
+        /**
+         * @brief Retourne le nombre de nœuds du sous-arbre d'un nœud, nœud compris.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        size_t getSubtreeSize(NodeHandle node) const { return subtreeSizes[positionOf(node)]; }
+
+        /**
+         * @brief Vérifie si le dernier update a recalculé la transformation monde d'un nœud.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        bool worldChanged(NodeHandle node) const { return changed[positionOf(node)] != 0; }
+
+        /**
+         * @brief Recalcule la transformation monde des nœuds marqués et de leurs descendants.
+         *
+         * Un seul parcours des tableaux : un parent étant toujours rangé avant ses descendants, sa
+         * transformation monde est à jour lorsqu'ils sont atteints. Sans nœud marqué, rien n'est recalculé.
+         */
+        void update();
+
+        /**
+         * @brief Retourne le nombre de transformations monde recalculées par le dernier update.
+         */
+        size_t getUpdatedCount() const { return updatedCount; }
+
+        size_t size() const { return locals.size(); }
+        bool empty() const { return locals.empty(); }
+
+        /**
+         * @brief Retourne l'identifiant du nœud rangé à une position (ordre en profondeur d'abord).
+         * @throw std::out_of_range Si la position dépasse le nombre de nœuds.
+         */
+        NodeHandle handleAt(size_t position) const {
+            const uint32_t slot = positionToSlot.at(position);
+            return NodeHandle{slot, slots[slot].generation};
+        }
+};
+
+#endif // SCENE_GRAPH_H
@@ -0,0 +1,187 @@
+/**
+ * @file slot_map.h
+ * @brief Déclaration du conteneur SlotMap : objets contigus désignés par des identifiants générationnels.
+ *
+ * Les objets d'un même type sont rangés dans un tableau dense, parcouru linéairement. Un identifiant
+ * (ObjectHandle) désigne une case d'une table d'indirection, qui donne la position courante de l'objet
+ * dans le tableau dense ; la suppression déplace le dernier objet dans le trou et met à jour sa case.
+ * Chaque case porte une génération, incrémentée à la suppression : un identifiant conservé après la
+ * suppression de son objet est reconnu comme périmé au lieu de désigner l'objet qui réutilise la case.
+ */
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct ObjectHandle
+ * @brief Identifiant d'un objet de type T dans une SlotMap : indice de case et génération.
+ *
+ * Le paramètre de type empêche d'utiliser l'identifiant d'un pavé pour désigner une sphère.
+ */
+template <typename T>
+struct ObjectHandle {
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    uint32_t index = INVALID_INDEX; ///< Case de la table d'indirection.
+    uint32_t generation = 0;        ///< Génération de la case à la création de l'objet.
+
+    /**
+     * @brief Vérifie si l'identifiant a été attribué (il peut être périmé, voir SlotMap::contains).
+     */
+    bool isValid() const { return index != INVALID_INDEX; }
+
+    friend bool operator==(const ObjectHandle& a, const ObjectHandle& b) { return a.index == b.index && a.generation == b.generation; }
+    friend bool operator!=(const ObjectHandle& a, const ObjectHandle& b) { return !(a == b); }
+};
+
+/**
+ * @class SlotMap
+ * @brief Tableau dense d'objets avec insertion, accès et suppression en O(1) par identifiant.
+ *
+ * Les références et pointeurs vers les objets sont invalidés par insert, remove et clear ;
+ * les identifiants restent valables jusqu'à la suppression de leur objet.
+ */
+template <typename T>
+class SlotMap {
+    private:
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+        struct Slot {
+            uint32_t dense;      // Position de l'objet dans objects_, ou case libre suivante
+            uint32_t generation; // Incrémentée à chaque suppression
+        };
+
+        std::vector<T> objects_;            // Objets, contigus
+        std::vector<uint32_t> denseToSlot_; // Case de chaque objet, pour mettre à jour celle de l'objet déplacé
+        std::vector<Slot> slots_;           // Table d'indirection
+        uint32_t freeSlot_ = NO_SLOT;       // Tête de la liste des cases libres
+
+        // Position de l'objet désigné, ou exception si l'identifiant est invalide ou périmé
+        uint32_t denseIndex(ObjectHandle<T> handle) const {
+            if (!contains(handle)) {
+                throw std::out_of_range("Identifiant d'objet invalide ou périmé.");
+            }
+            return slots_[handle.index].dense;
+        }
+
+    public:
+        /**
+         * @brief Ajoute un objet.
+         * @param object L'objet à ajouter.
+         * @return L'identifiant de l'objet.
+         */
+        ObjectHandle<T> insert(T object) {
+            uint32_t slot = freeSlot_;
+            if (slot != NO_SLOT) {
+                freeSlot_ = slots_[slot].dense;
+            } else {
+                slot = static_cast<uint32_t>(slots_.size());
+                slots_.push_back(Slot{0, 0});
+            }
+            slots_[slot].dense = static_cast<uint32_t>(objects_.size());
+            objects_.push_back(std::move(object));
+            denseToSlot_.push_back(slot);
+            return ObjectHandle<T>{slot, slots_[slot].generation};
+        }
+
+        /**
+         * @brief Supprime un objet ; le dernier objet prend sa place dans le tableau dense.
+         * @param handle L'identifiant de l'objet.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        void remove(ObjectHandle<T> handle) {
+            const uint32_t dense = denseIndex(handle);
+            const uint32_t last = static_cast<uint32_t>(objects_.size() - 1);
+            if (dense != last) {
+                objects_[dense] = std::move(objects_[last]);
+                denseToSlot_[dense] = denseToSlot_[last];
+                slots_[denseToSlot_[dense]].dense = dense;
+            }
+            objects_.pop_back();
+            denseToSlot_.pop_back();
+
+            Slot& slot = slots_[handle.index];
+            ++slot.generation;
+            slot.dense = freeSlot_;
+            freeSlot_ = handle.index;
+        }
+
+        /**
+         * @brief Vérifie si un identifiant désigne un objet présent.
+         */
+        bool contains(ObjectHandle<T> handle) const {
+            return handle.index < slots_.size() && slots_[handle.index].generation == handle.generation &&
+                   slots_[handle.index].dense < objects_.size() && denseToSlot_[slots_[handle.index].dense] == handle.index;
+        }
+
+        /**
+         * @brief Accède à un objet par son identifiant.
+         * @throw std::out_of_range Si l'identifiant est invalide ou périmé.
+         */
+        T& get(ObjectHandle<T> handle) { return objects_[denseIndex(handle)]; }
+        const T& get(ObjectHandle<T> handle) const { return objects_[denseIndex(handle)]; }
+
+        /**
+         * @brief Retourne l'identifiant de l'objet rangé à une position du tableau dense.
+         * @throw std::out_of_range Si la position dépasse le nombre d'objets.
+         */
+        ObjectHandle<T> handleAt(size_t denseIndex) const {
+            const uint32_t slot = denseToSlot_.at(denseIndex);
+            return ObjectHandle<T>{slot, slots_[slot].generation};
+        }
+
+        /**
+         * @brief Retourne l'identifiant de l'objet occupant une case de la table d'indirection.
+         * @param slot La case (ObjectHandle::index).
+         * @throw std::out_of_range Si la case est libre.
+         */
+        ObjectHandle<T> handleAtSlot(uint32_t slot) const {
+            ObjectHandle<T> handle{slot, slot < slots_.size() ? slots_[slot].generation : 0};
+            if (!contains(handle)) {
+                throw std::out_of_range("Aucun objet n'occupe cette case.");
+            }
+            return handle;
+        }
+
+        /**
+         * @brief Supprime tous les objets ; tous les identifiants existants deviennent périmés.
+         */
+        void clear() {
+            for (uint32_t slot : denseToSlot_) {
+                ++slots_[slot].generation;
+                slots_[slot].dense = freeSlot_;
+                freeSlot_ = slot;
+            }
+            objects_.clear();
+            denseToSlot_.clear();
+        }
+
+        /**
+         * @brief Réserve la place de count objets.
+         */
+        void reserve(size_t count) {
+            objects_.reserve(count);
+            denseToSlot_.reserve(count);
+            slots_.reserve(count);
+        }
+
+        size_t size() const { return objects_.size(); }
+        bool empty() const { return objects_.empty(); }
+
+        /**
+         * @brief Retourne les objets, contigus, dans un ordre quelconque.
+         */
+        const std::vector<T>& objects() const { return objects_; }
+
+        typename std::vector<T>::iterator begin() { return objects_.begin(); }
+        typename std::vector<T>::iterator end() { return objects_.end(); }
+        typename std::vector<T>::const_iterator begin() const { return objects_.begin(); }
+        typename std::vector<T>::const_iterator end() const { return objects_.end(); }
+};
+
+#endif // SLOT_MAP_H
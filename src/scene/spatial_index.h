@@ -0,0 +1,184 @@
+/**
+ * @file spatial_index.h
+ * @brief Déclaration de SpatialIndex : index spatial interchangeable sur les objets d'une SlotMap.
+ *
+ * Le meilleur index dépend du mouvement des objets : une hiérarchie de boîtes (Bvh3D) pour les
+ * scènes plutôt statiques, une grille hachée (HashGrid3D) lorsque la plupart des objets bougent
+ * à chaque image, et un simple parcours pour les petites scènes.
+ */
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include "slot_map.h"
+#include "../geometry/bvh3d.h"
+#include "../geometry/hash_grid3d.h"
+#include <vector>
+
+/**
+ * @brief Type d'index spatial d'une scène.
+ */
+enum class SpatialIndexType {
+    Linear,  ///< Aucun index : chaque requête parcourt tous les objets.
+    Bvh,     ///< Hiérarchie de boîtes, ajustée à chaque rafraîchissement, reconstruite après ajout ou retrait.
+    HashGrid ///< Grille hachée : ajout, déplacement et retrait en O(1).
+};
+
+/**
+ * @class SpatialIndex
+ * @brief Index spatial sur les objets d'une SlotMap, répondant aux requêtes par identifiants.
+ *
+ * Les objets doivent fournir boundingBox(). Les boîtes de l'index sont celles du dernier appel à
+ * refresh : après avoir déplacé des objets, refresh doit être appelé avant les requêtes. Tant que
+ * la hiérarchie n'a pas été reconstruite après un ajout ou un retrait, les requêtes parcourent
+ * tous les objets.
+ *
+ * @tparam T Le type des objets (Pave3D, Sphere3D).
+ */
+template <typename T>
+class SpatialIndex {
+    private:
+        SpatialIndexType type;
+        Bvh3D bvh;                          // Objets désignés par leur position dans la SlotMap.
+        HashGrid3D grid;                    // Objets désignés par leur case dans la SlotMap.
+        std::vector<BoundingBox3D> bounds;  // Boîtes passées à la hiérarchie, réutilisées.
+        bool bvhDirty = true;               // Ajout ou retrait depuis la dernière construction.
+
+        // Parcours de tous les objets : index Linear, ou hiérarchie à reconstruire
+        bool linearQueries() const { return type == SpatialIndexType::Linear || (type == SpatialIndexType::Bvh && bvhDirty); }
+
+    public:
+        /**
+         * @brief Constructeur.
+         * @param type Le type d'index.
+         * @param cellSize Le côté des cellules de la grille (SpatialIndexType::HashGrid).
+         * @throw std::invalid_argument Si le côté n'est pas strictement positif.
+         */
+        explicit SpatialIndex(SpatialIndexType type = SpatialIndexType::Linear, float cellSize = DEFAULT_HASH_GRID_CELL_SIZE)
+            : type(type), grid(cellSize) {}
+
+        SpatialIndexType getType() const { return type; }
+        const Bvh3D& getBvh() const { return bvh; }
+        const HashGrid3D& getGrid() const { return grid; }
+
+        /**
+         * @brief Change de type d'index et l'initialise avec les objets existants.
+         * @param objects Les objets.
+         * @param newType Le nouveau type d'index.
+         * @param cellSize Le côté des cellules de la grille.
+         * @throw std::invalid_argument Si le côté n'est pas strictement positif.
+         */
+        void reset(const SlotMap<T>& objects, SpatialIndexType newType, float cellSize) {
+            grid = HashGrid3D(cellSize);
+            bvh = Bvh3D(bvh.getRebuildThreshold());
+            type = newType;
+            bvhDirty = true;
+            refresh(objects);
+        }
+
+        /**
+         * @brief Signale l'ajout d'un objet (O(1) pour la grille).
+         */
+        void inserted(const SlotMap<T>& objects, ObjectHandle<T> handle) {
+            if (type == SpatialIndexType::HashGrid) {
+                grid.insert(handle.index, objects.get(handle).boundingBox());
+            }
+            bvhDirty = true;
+        }
+
+        /**
+         * @brief Signale le retrait d'un objet, avant son retrait de la SlotMap (O(1) pour la grille).
+         */
+        void removed(ObjectHandle<T> handle) {
+            if (type == SpatialIndexType::HashGrid) {
+                grid.remove(handle.index);
+            }
+            bvhDirty = true;
+        }
+
+        /**
+         * @brief Signale le retrait de tous les objets.
+         */
+        void cleared() {
+            grid.clear();
+            bvhDirty = true;
+        }
+
+        /**
+         * @brief Met à jour l'index avec les boîtes courantes des objets.
+         *
+         * Grille : chaque objet est déplacé en O(1). Hiérarchie : reconstruite après un ajout ou
+         * un retrait, ajustée sur place sinon (et reconstruite si sa qualité s'est trop dégradée).
+         *
+         * @param objects Les objets.
+         */
+        void refresh(const SlotMap<T>& objects) {
+            if (type == SpatialIndexType::HashGrid) {
+                for (size_t i = 0; i < objects.size(); ++i) {
+                    const uint32_t slot = objects.handleAt(i).index;
+                    if (grid.contains(slot)) {
+                        grid.update(slot, objects.objects()[i].boundingBox());
+                    } else {
+                        grid.insert(slot, objects.objects()[i].boundingBox());
+                    }
+                }
+            } else if (type == SpatialIndexType::Bvh) {
+                bounds.clear();
+                for (const T& object : objects) {
+                    bounds.push_back(object.boundingBox());
+                }
+                if (bvhDirty) {
+                    bvh.build(bounds);
+                    bvhDirty = false;
+                } else {
+                    bvh.refit(bounds);
+                }
+            }
+        }
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte touche le volume de vision.
+         * @param objects Les objets.
+         * @param frustum Le volume de vision.
+         * @param visit Le visiteur, appelé avec l'identifiant de chaque objet (ObjectHandle<T>).
+         */
+        template <typename Visitor>
+        void forEachInFrustum(const SlotMap<T>& objects, const Frustum3D& frustum, Visitor&& visit) const {
+            if (linearQueries()) {
+                for (size_t i = 0; i < objects.size(); ++i) {
+                    if (frustum.intersects(objects.objects()[i].boundingBox())) {
+                        visit(objects.handleAt(i));
+                    }
+                }
+            } else if (type == SpatialIndexType::Bvh) {
+                bvh.forEachInFrustum(frustum, [&](uint32_t i) { visit(objects.handleAt(i)); });
+            } else {
+                grid.forEachInFrustum(frustum, [&](uint32_t slot) { visit(objects.handleAtSlot(slot)); });
+            }
+        }
+
+        /**
+         * @brief Appelle un visiteur pour chaque objet dont la boîte est à moins d'une distance d'un point.
+         * @param objects Les objets.
+         * @param point Le point.
+         * @param radius La distance maximale entre le point et la boîte.
+         * @param visit Le visiteur, appelé avec l'identifiant de chaque objet (ObjectHandle<T>).
+         */
+        template <typename Visitor>
+        void forEachWithin(const SlotMap<T>& objects, const Point3D& point, float radius, Visitor&& visit) const {
+            if (linearQueries()) {
+                for (size_t i = 0; i < objects.size(); ++i) {
+                    const BoundingBox3D box = objects.objects()[i].boundingBox();
+                    Point3D d = point - Point3D::min(Point3D::max(point, box.getMin()), box.getMax());
+                    if (d.dotProduct(d) <= radius * radius) {
+                        visit(objects.handleAt(i));
+                    }
+                }
+            } else if (type == SpatialIndexType::Bvh) {
+                bvh.forEachWithin(point, radius, [&](uint32_t i) { visit(objects.handleAt(i)); });
+            } else {
+                grid.forEachWithin(point, radius, [&](uint32_t slot) { visit(objects.handleAtSlot(slot)); });
+            }
+        }
+};
+
+#endif // SPATIAL_INDEX_H
@@ -3,9 +3,7 @@
 
 #include <SDL2/SDL.h>
 #include <vector>
-#include <algorithm>
-#include "../geometry/triangle2d.h"
-#include "../scene/scene3d.h"
+#include "../scene/frame_builder.h"
 
 /**
  * @class Renderer
@@ -22,30 +20,12 @@ private:
     int pixelSize_;           // Taille des pixels utilisés pour le rendu.
     SDL_Window* window_;      // Pointeur vers la fenêtre SDL.
     SDL_Renderer* renderer_;  // Pointeur vers le renderer SDL.
+    FrameBuilder frame_;      // Liste de dessin de l'image, préparée sans SDL par renderFrame.
 
     /**
-     * @brief Trie les triangles projetés par profondeur.
-     * @param triangles Les triangles à trier.
+     * @brief Remplit un triangle avec la couleur de dessin courante du renderer SDL.
      */
-    void sortTrianglesByDepth(std::vector<Triangle2D>& triangles) const;
-
-    /**
-     * @brief Projette un point 3D sur le plan 2D.
-     * @param point3D Le point 3D à projeter.
-     * @param eye La position de la caméra (œil).
-     * @param projectionPlaneDistance La distance du plan de projection.
-     * @return Le point projeté en 2D.
-     */
-    Point2D projectPoint(const Point3D& point3D, const Point3D& eye, float projectionPlaneDistance) const;
-
-    /**
-     * @brief Projette un triangle 3D sur le plan 2D.
-     * @param triangle Le triangle 3D à projeter.
-     * @param eye La position de la caméra (œil).
-     * @param projectionPlaneDistance La distance du plan de projection.
-     * @return Le triangle projeté en 2D.
-     */
-    Triangle2D projectTriangle(const Triangle3D& triangle, const Point3D& eye, float projectionPlaneDistance) const;  
+    static void fillTriangle(SDL_Renderer* renderer, const Point2D& p1, const Point2D& p2, const Point2D& p3);
 
 public:
     /**
@@ -53,6 +33,7 @@ public:
      * @param width Largeur de la fenêtre.
      * @param height Hauteur de la fenêtre.
      * @param pixelSize Taille des pixels pour le rendu (par défaut : 1).
+     * @throw std::invalid_argument Si la largeur ou la hauteur n'est pas strictement positive.
      * @throw std::runtime_error Si l'initialisation de SDL ou la création de la fenêtre échoue.
      */
     Renderer(int width, int height, int pixelSize = 1);
@@ -65,11 +46,24 @@ public:
     ~Renderer();
 
     /**
-     * @brief Rendu d'une scène 3D en 2D.
-     * @param scene La scène 3D à projeter et rendre.
-     * @param translation2D La translation à appliquer aux objets projetés dans l'espace 2D.
+     * @brief Rend une image complète à partir d'une seule liste de dessin.
+     *
+     * L'image est préparée par FrameBuilder::build (tous les pavés, sphères et instances, un seul tri),
+     * puis dessinée en une seule boucle : l'ordre du plus lointain au plus proche vaut entre objets, et
+     * la couleur de dessin n'est changée que lorsqu'elle diffère de celle du triangle précédent.
+     *
+     * @param scene La scène 3D à rendre (le niveau de détail des sphères y est mis à jour).
+     * @param translation La translation en 2D à appliquer (déplacement sur l'écran).
+     * @param translationZ La translation en profondeur (axe Z) à appliquer.
+     * @param occlusion Le tampon d'occlusion : s'il est fourni, il est rempli par les plus grands pavés
+     *        (Scene3D::buildOcclusion) et les pavés, sphères et instances masqués ne sont pas soumis.
+     */
+    void renderFrame(Scene3D& scene, const Point2D& translation, float translationZ = 0.0f, OcclusionBuffer3D* occlusion = nullptr);
+
+    /**
+     * @brief Accède à la dernière image préparée par renderFrame (liste de dessin, triangles).
      */
-    void renderScene(const Scene3D& scene, const Point2D& translation2D);
+    const FrameBuilder& getFrame() const { return frame_; }
 
     /**
      * @brief Présente l'image rendue à l'écran.
@@ -82,35 +76,6 @@ public:
      */
     void clear(const SDL_Color& color);
 
-    /**
-     * @brief Récupère les triangles projetés des cubes de la scène.
-     * @param scene La scène contenant le cube.
-     * @return Un vecteur de triangles 2D projetés.
-     */
-    std::vector<Triangle2D> getProjectedTrianglesFromCubes(const Scene3D& scene) const;
-
-    /**
-     * @brief Récupère les triangles projetés des sphères de la scène.
-     * @param scene La scène contenant la sphère.
-     * @return Un vecteur de triangles 2D projetés.
-     */
-    std::vector<Triangle2D> getProjectedTrianglesFromSpheres(const Scene3D& scene) const;
-
-    /**
-     * @brief Récupère tous les triangles projetés de la scène.
-     * @param scene La scène 3D à partir de laquelle les triangles sont projetés.
-     * @return Un vecteur de triangles 2D projetés triés par profondeur.
-     */
-    std::vector<Triangle2D> getProjectedTriangles(const Scene3D& scene) const;
-
-    /**
-     * @brief Vérifie si un point est visible depuis la caméra.
-     * @param point Le point à vérifier.
-     * @param eye La position de l'œil.
-     * @return Vrai si le point est visible, faux sinon.
-     */
-    bool isPointVisible(const Point3D& point, const Point3D& eye) const;
-
     /**
      * @brief Accesseur pour la hauteur de la fenêtre.
      * @return La hauteur de la fenêtre.
@@ -128,62 +93,6 @@ public:
      * @return Un pointeur constant vers le renderer SDL.
      */
     SDL_Renderer* getRenderer() const { return renderer_; }
-
-    /**
-     * @brief Rend le pavé 3D en le projetant en 2D et en le dessinant sur l'écran.
-     * @param cube Un pointeur partagé vers l'objet Pave3D à rendre.
-     * @param translation2D La translation en 2D à appliquer (déplacement sur l'écran).
-     * @param translationZ La translation en profondeur (axe Z) à appliquer.
-     * @param scene La scène 3D contenant les informations sur la caméra et la projection.
-     */
-    void renderCube(const std::shared_ptr<Pave3D>& cube, const Point2D& translation2D, float translationZ, const Scene3D& scene);
-    
-    /**
-     * @brief Rend la sphère 3D en la projetant en 2D et en la dessinant sur l'écran.
-     * @param sphere Un pointeur partagé vers l'objet Sphere3D à rendre.
-     * @param translation La translation en 2D à appliquer (déplacement sur l'écran).
-     * @param translationZ La translation en profondeur (axe Z) à appliquer.
-     * @param scene La scène 3D contenant les informations sur la caméra et la projection.
-     */
-    void renderSphere(const std::shared_ptr<Sphere3D>& sphere, const Point2D& translation, float translationZ, const Scene3D& scene);
-
-    /**
-     * @brief Dessine un triangle rempli avec la couleur spécifiée.
-     * @param renderer Pointeur vers le SDL_Renderer utilisé pour le rendu.
-     * @param p1 Premier sommet du triangle en 2D.
-     * @param p2 Deuxième sommet du triangle en 2D.
-     * @param p3 Troisième sommet du triangle en 2D.
-     * @param color Couleur du triangle.
-     */
-    void drawFilledTriangle(SDL_Renderer* renderer, const Point2D& p1, const Point2D& p2, const Point2D& p3, const Couleur& color);
-
-    /**
-     * @brief Rendu d'un triangle 3D après application de la translation et de la projection.
-     * @param triangle Triangle 3D à rendre.
-     * @param color Couleur du triangle.
-     * @param translation Translation 2D à appliquer après la projection.
-     * @param translationZ Translation en Z à appliquer avant la projection.
-     * @param scene Scène 3D contenant les informations de caméra et de projection.
-     */
-    void renderTriangle(const Triangle3D& triangle, const Couleur& color, const Point2D& translation, float translationZ, const Scene3D& scene);
-
-    /**
-     * @brief Rendu d'un triangle 3D avec calcul automatique de la couleur.
-     * @param triangle Triangle 3D à rendre.
-     * @param translation Translation 2D à appliquer après la projection.
-     * @param translationZ Translation en Z à appliquer avant la projection.
-     * @param scene Scène 3D contenant les informations de caméra et de projection.
-     */
-    void renderTriangleWithColor(const Triangle3D& triangle, const Point2D& translation, float translationZ, const Scene3D& scene);
-
-    /**
-     * @brief Calcule la couleur d'un triangle 3D en fonction de divers paramètres.
-     * @param triangle Triangle 3D dont la couleur doit être calculée.
-     * @return Couleur calculée pour le triangle.
-     */
-    Couleur computeTriangleColor(const Triangle3D& triangle) const;
-
-
 };
 
 #endif // RENDERER_H
\ No newline at end of file